@@ -0,0 +1,313 @@
+#include "clkernels.h"
+#include <algorithm>
+
+//
+// Scaled dot-product attention of a batch of heads in one kernel.
+//
+//   O = softmax(scale * Q K^T) V
+//
+// where for each head Q is [seq_q][head_dim], K is [seq_k][head_dim],
+// V is [seq_k][value_dim] and O is [seq_q][value_dim]. Rows start every
+// "ld" elements and head h of batch b starts at b*stride_batch +
+// h*stride_head, so both [batch][heads][seq][dim] and
+// [batch][seq][heads][dim] are read in place. Every element reached must
+// lie in its buffer, and O must not overlap K or V.
+//
+// The score matrix is never stored. A work-group takes a block of query
+// rows and streams K and V through local memory in blocks of "bc" keys.
+// "LANES" work-items share a query row: the row of Q is in local memory,
+// the lanes compute the scores of the key block together, and each lane
+// keeps every LANES-th column of the output accumulator in registers
+// (at most "valuesPerItem"), with the running maximum and sum. The
+// accumulator is rescaled once per key block when the maximum grows
+// (online softmax), so the memory is linear in the sequence length.
+//
+// With the causal mask, query i sees the keys j <= i + seq_k - seq_q
+// (the last query sees all keys, as with a key/value cache); blocks of
+// keys that no query of a work-group sees are not loaded. A query that
+// sees no key gets zeros.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t maxHeadDim = 256;
+const size_t valuesPerItem = 8;
+const size_t maxLanes = 32;
+const size_t groupSize = 128;
+const size_t keyBlock = 64;
+const size_t localBytes = 32768;
+
+const char *attentionSource = R"CLC(
+__kernel void attention(
+    const int heads, const int seq_q, const int seq_k,
+    const REAL scale, const int causal,
+    __global const STORAGE *q, const ulong q_offset, const int q_ld,
+    const ulong q_stride_batch, const ulong q_stride_head,
+    __global const STORAGE *k, const ulong k_offset, const int k_ld,
+    const ulong k_stride_batch, const ulong k_stride_head,
+    __global const STORAGE *v, const ulong v_offset, const int v_ld,
+    const ulong v_stride_batch, const ulong v_stride_head,
+    __global STORAGE *o, const ulong o_offset, const int o_ld,
+    const ulong o_stride_batch, const ulong o_stride_head)
+{
+    __local REAL qs[BR*HEAD_DIM];
+    __local REAL kt[BC*HEAD_DIM];
+    __local REAL vt[BC*VALUE_DIM];
+    __local REAL sc[BR*BC];
+    const int lane = get_local_id(0);
+    const int row = get_local_id(1);
+    const int tid = row*LANES + lane;
+    const int first = get_group_id(1)*BR;
+    const int i = first + row;
+    const int b = get_group_id(2)/heads;
+    const int h = get_group_id(2)%heads;
+    const ulong qo = q_offset + b*q_stride_batch + h*q_stride_head;
+    const ulong ko = k_offset + b*k_stride_batch + h*k_stride_head;
+    const ulong vo = v_offset + b*v_stride_batch + h*v_stride_head;
+    const ulong oo = o_offset + b*o_stride_batch + h*o_stride_head;
+
+    for(int t=tid; t<BR*HEAD_DIM; t+=BR*LANES) {
+        const int r = first + t/HEAD_DIM;
+        qs[t] = (r<seq_q) ? LOAD(q, qo + (ulong)r*q_ld + t%HEAD_DIM)*scale : 0;
+    }
+    // column lane + e*LANES of the output
+    REAL acc[DV];
+    for(int e=0; e<DV; e++) {
+        acc[e] = 0;
+    }
+    REAL mx = -INFINITY;
+    REAL sm = 0;
+
+    // the last key seen by this query and the end of the keys seen by the work-group
+    const int shift = seq_k - seq_q;
+    const int last = causal ? min(i, seq_q-1) + shift : seq_k-1;
+    const int end = causal ? min(seq_k, min(first+BR, seq_q) + shift) : seq_k;
+    for(int j0=0; j0<end; j0+=BC) {
+        const int bc = min(BC, end-j0);
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for(int t=tid; t<bc*HEAD_DIM; t+=BR*LANES) {
+            kt[t] = LOAD(k, ko + (ulong)(j0+t/HEAD_DIM)*k_ld + t%HEAD_DIM);
+        }
+        for(int t=tid; t<bc*VALUE_DIM; t+=BR*LANES) {
+            vt[t] = LOAD(v, vo + (ulong)(j0+t/VALUE_DIM)*v_ld + t%VALUE_DIM);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for(int jj=lane; jj<bc; jj+=LANES) {
+            REAL s = 0;
+            for(int d=0; d<HEAD_DIM; d++) {
+                s += qs[row*HEAD_DIM+d]*kt[jj*HEAD_DIM+d];
+            }
+            sc[row*BC+jj] = (j0+jj<=last) ? s : (REAL)(-INFINITY);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        // every lane of the row does the same update of mx and sm
+        REAL bmx = -INFINITY;
+        for(int jj=0; jj<bc; jj++) {
+            bmx = fmax(bmx, sc[row*BC+jj]);
+        }
+        if(bmx==-INFINITY) {
+            continue;
+        }
+        const REAL nmx = fmax(mx, bmx);
+        const REAL correction = exp(mx-nmx);
+        sm *= correction;
+        for(int e=0; e<DV; e++) {
+            acc[e] *= correction;
+        }
+        for(int jj=0; jj<bc; jj++) {
+            const REAL p = exp(sc[row*BC+jj]-nmx);
+            sm += p;
+            for(int e=0; e<DV; e++) {
+                const int c = lane + e*LANES;
+                if(c<VALUE_DIM) {
+                    acc[e] += p*vt[jj*VALUE_DIM+c];
+                }
+            }
+        }
+        mx = nmx;
+    }
+    if(i<seq_q) {
+        const REAL inv = (sm>0) ? 1/sm : 0;
+        for(int e=0; e<DV; e++) {
+            const int c = lane + e*LANES;
+            if(c<VALUE_DIM) {
+                STORE(acc[e]*inv, o, oo + (ulong)i*o_ld + c);
+            }
+        }
+    }
+}
+)CLC";
+
+struct HeadLayout {
+    size_t ld, stride_batch, stride_head;
+};
+
+template <typename T>
+void Attention(const CLBlastPrecision precision, const bool causal,
+               const size_t batch_count, const size_t heads,
+               const size_t seq_q, const size_t seq_k,
+               const size_t head_dim, const size_t value_dim, const T scale,
+               const cl_mem q_buffer, const size_t q_offset, const HeadLayout &q_layout,
+               const cl_mem k_buffer, const size_t k_offset, const HeadLayout &k_layout,
+               const cl_mem v_buffer, const size_t v_offset, const HeadLayout &v_layout,
+               cl_mem o_buffer, const size_t o_offset, const HeadLayout &o_layout,
+               cl_command_queue* queue, cl_event* event)
+{
+    if(head_dim==0 || value_dim==0 || head_dim>maxHeadDim || value_dim>maxHeadDim) {
+        throw Error(CL_INVALID_VALUE, "Attention: head_dim and value_dim must be 1 to "+std::to_string(maxHeadDim));
+    }
+    if(q_layout.ld<head_dim || k_layout.ld<head_dim || v_layout.ld<value_dim || o_layout.ld<value_dim) {
+        throw Error(CL_INVALID_VALUE, "Attention: invalid leading dimension");
+    }
+    const size_t element_size = SizeOf(precision);
+    const size_t q_shape[] = {batch_count, heads, seq_q, head_dim};
+    const size_t k_shape[] = {batch_count, heads, seq_k, head_dim};
+    const size_t v_shape[] = {batch_count, heads, seq_k, value_dim};
+    const size_t o_shape[] = {batch_count, heads, seq_q, value_dim};
+    const cl_long q_strides[] = {(cl_long)q_layout.stride_batch, (cl_long)q_layout.stride_head, (cl_long)q_layout.ld, 1};
+    const cl_long k_strides[] = {(cl_long)k_layout.stride_batch, (cl_long)k_layout.stride_head, (cl_long)k_layout.ld, 1};
+    const cl_long v_strides[] = {(cl_long)v_layout.stride_batch, (cl_long)v_layout.stride_head, (cl_long)v_layout.ld, 1};
+    const cl_long o_strides[] = {(cl_long)o_layout.stride_batch, (cl_long)o_layout.stride_head, (cl_long)o_layout.ld, 1};
+    CheckBuffer("Attention", "Q", q_buffer, element_size, q_offset, 4, q_shape, q_strides);
+    CheckBuffer("Attention", "K", k_buffer, element_size, k_offset, 4, k_shape, k_strides);
+    CheckBuffer("Attention", "V", v_buffer, element_size, v_offset, 4, v_shape, v_strides);
+    CheckBuffer("Attention", "O", o_buffer, element_size, o_offset, 4, o_shape, o_strides);
+    CheckOverlap("Attention", "O", 4, o_shape, o_strides);
+    // every work-group reads all of K and V while others write O
+    const auto o_extent = Extent(o_offset, 4, o_shape, o_strides);
+    CheckDisjoint("Attention", "O", o_buffer, o_extent,
+        "K", k_buffer, Extent(k_offset, 4, k_shape, k_strides));
+    CheckDisjoint("Attention", "O", o_buffer, o_extent,
+        "V", v_buffer, Extent(v_offset, 4, v_shape, v_strides));
+    if(batch_count==0 || heads==0 || seq_q==0) {
+        Marker(*queue, event);
+        return;
+    }
+    // lanes per query row so that each keeps at most valuesPerItem columns
+    const size_t max_group = std::min(groupSize, MaxWorkGroupSize(*queue));
+    size_t lanes = 1;
+    while(lanes<maxLanes && CeilDiv(value_dim, lanes)>valuesPerItem) {
+        lanes <<= 1;
+    }
+    lanes = std::min(lanes, max_group);
+    size_t br = max_group/lanes;
+    while(br>1 && br/2>=seq_q) {
+        br >>= 1;
+    }
+    const size_t element = (precision==CLBlastPrecisionDouble) ? sizeof(double) : sizeof(float);
+    const size_t budget = std::min(localBytes, LocalMemSize(*queue));
+    auto bytes = [&](size_t rows, size_t keys) {
+        return (rows*head_dim + keys*(head_dim+value_dim) + rows*keys)*element;
+    };
+    size_t bc = keyBlock;
+    while(bc>1 && bytes(br, bc)>budget) {
+        bc >>= 1;
+    }
+    while(br>1 && bytes(br, bc)>budget) {
+        br >>= 1;
+    }
+    if(bytes(br, bc)>budget) {
+        throw Error(CL_OUT_OF_RESOURCES, "Attention: not enough local memory for head_dim and value_dim");
+    }
+    const std::string source = Preamble(precision) +
+        "#define HEAD_DIM " + std::to_string(head_dim) + "\n" +
+        "#define VALUE_DIM " + std::to_string(value_dim) + "\n" +
+        "#define LANES " + std::to_string(lanes) + "\n" +
+        "#define DV " + std::to_string(CeilDiv(value_dim, lanes)) + "\n" +
+        "#define BR " + std::to_string(br) + "\n" +
+        "#define BC " + std::to_string(bc) + "\n" +
+        attentionSource;
+    Launch(*queue, Kernel(*queue, source, "attention"),
+        {lanes, CeilDiv(seq_q, br)*br, batch_count*heads}, {lanes, br, 1}, event,
+        (cl_int)heads, (cl_int)seq_q, (cl_int)seq_k,
+        scale, (cl_int)causal,
+        q_buffer, (cl_ulong)q_offset, (cl_int)q_layout.ld,
+        (cl_ulong)q_layout.stride_batch, (cl_ulong)q_layout.stride_head,
+        k_buffer, (cl_ulong)k_offset, (cl_int)k_layout.ld,
+        (cl_ulong)k_layout.stride_batch, (cl_ulong)k_layout.stride_head,
+        v_buffer, (cl_ulong)v_offset, (cl_int)v_layout.ld,
+        (cl_ulong)v_layout.stride_batch, (cl_ulong)v_layout.stride_head,
+        o_buffer, (cl_ulong)o_offset, (cl_int)o_layout.ld,
+        (cl_ulong)o_layout.stride_batch, (cl_ulong)o_layout.stride_head);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastHattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const float scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Attention<float>(CLBlastPrecisionHalf, causal!=0, batch_count, heads,
+            seq_q, seq_k, head_dim, value_dim, scale,
+            q_buffer, q_offset, {q_ld, q_stride_batch, q_stride_head},
+            k_buffer, k_offset, {k_ld, k_stride_batch, k_stride_head},
+            v_buffer, v_offset, {v_ld, v_stride_batch, v_stride_head},
+            o_buffer, o_offset, {o_ld, o_stride_batch, o_stride_head},
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const float scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Attention<float>(CLBlastPrecisionSingle, causal!=0, batch_count, heads,
+            seq_q, seq_k, head_dim, value_dim, scale,
+            q_buffer, q_offset, {q_ld, q_stride_batch, q_stride_head},
+            k_buffer, k_offset, {k_ld, k_stride_batch, k_stride_head},
+            v_buffer, v_offset, {v_ld, v_stride_batch, v_stride_head},
+            o_buffer, o_offset, {o_ld, o_stride_batch, o_stride_head},
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const double scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Attention<double>(CLBlastPrecisionDouble, causal!=0, batch_count, heads,
+            seq_q, seq_k, head_dim, value_dim, scale,
+            q_buffer, q_offset, {q_ld, q_stride_batch, q_stride_head},
+            k_buffer, k_offset, {k_ld, k_stride_batch, k_stride_head},
+            v_buffer, v_offset, {v_ld, v_stride_batch, v_stride_head},
+            o_buffer, o_offset, {o_ld, o_stride_batch, o_stride_head},
+            queue, event);
+    });
+}
+}
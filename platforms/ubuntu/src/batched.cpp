@@ -0,0 +1,380 @@
+#include "clkernels.h"
+
+//
+// Strided batched forms of Trsm, Trmm, Syrk and Gemv.
+//
+// Trsm and Trmm with a triangle of up to "smallTriangle" rows run one
+// kernel where each work-item solves or multiplies one column (Left) or
+// row (Right) of one B. Gemv runs one kernel where each work-item
+// computes one element of one y. Larger problems and Syrk loop over the
+// batch with the CLBlast routines inside this library, so each is still
+// one call from PHP.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t smallTriangle = 64;
+const size_t smallGemv = 65536;     // elements of one A
+
+const char *batchedSource = R"CLC(
+#define ELEM(x,off,ld,r,c) x[(off) + (row_major ? (ulong)(r)*(ld)+(c) : (ulong)(c)*(ld)+(r))]
+
+// B := alpha * op(A)^-1 * B  or  B := alpha * op(A) * B  (Left),
+// B := alpha * B * op(A)^-1  or  B := alpha * B * op(A)  (Right),
+// done as M*v for each vector v of B, where M is op(A) for Left and
+// op(A)^T for Right.
+__kernel void triangular_batched(
+    const int solve, const int t, const int vectors,
+    const int row_major, const int right, const int lower, const int trans, const int unit,
+    const REAL alpha,
+    __global const REAL *a, ulong a_offset, const int lda, const ulong a_stride,
+    __global REAL *b, ulong b_offset, const int ldb, const ulong b_stride)
+{
+    const int v = get_global_id(0);
+    const int batch = get_global_id(1);
+    if(v>=vectors) {
+        return;
+    }
+    a_offset += batch*a_stride;
+    b_offset += batch*b_stride;
+    const int flip = trans ^ right;
+    const int eff_lower = lower ^ flip;
+    #define MA(i,k) (flip ? ELEM(a,a_offset,lda,k,i) : ELEM(a,a_offset,lda,i,k))
+    #define V(i) (*(right ? &ELEM(b,b_offset,ldb,v,i) : &ELEM(b,b_offset,ldb,i,v)))
+
+    if(solve) {
+        for(int step=0; step<t; step++) {
+            const int i = eff_lower ? step : t-1-step;
+            REAL s = alpha*V(i);
+            const int k0 = eff_lower ? 0 : i+1;
+            const int k1 = eff_lower ? i : t;
+            for(int k=k0; k<k1; k++) {
+                s -= MA(i,k)*V(k);
+            }
+            V(i) = unit ? s : s/MA(i,i);
+        }
+    } else {
+        // overwrite in the order that keeps the unread elements intact
+        for(int step=0; step<t; step++) {
+            const int i = eff_lower ? t-1-step : step;
+            REAL s = unit ? V(i) : MA(i,i)*V(i);
+            const int k0 = eff_lower ? 0 : i+1;
+            const int k1 = eff_lower ? i : t;
+            for(int k=k0; k<k1; k++) {
+                s += MA(i,k)*V(k);
+            }
+            V(i) = alpha*s;
+        }
+    }
+    #undef MA
+    #undef V
+}
+
+// y := alpha * op(A) * x + beta * y
+__kernel void gemv_batched(
+    const int rows, const int len, const int row_major, const int trans,
+    const REAL alpha,
+    __global const REAL *a, ulong a_offset, const int lda, const ulong a_stride,
+    __global const REAL *x, ulong x_offset, const int x_inc, const ulong x_stride,
+    const REAL beta,
+    __global REAL *y, ulong y_offset, const int y_inc, const ulong y_stride)
+{
+    const int i = get_global_id(0);
+    const int batch = get_global_id(1);
+    if(i>=rows) {
+        return;
+    }
+    a_offset += batch*a_stride;
+    x_offset += batch*x_stride;
+    y_offset += batch*y_stride;
+    REAL s = 0;
+    for(int l=0; l<len; l++) {
+        const REAL av = trans ? ELEM(a,a_offset,lda,l,i) : ELEM(a,a_offset,lda,i,l);
+        s += av*x[x_offset+(ulong)l*x_inc];
+    }
+    const ulong o = y_offset+(ulong)i*y_inc;
+    REAL value = alpha*s;
+    if(beta!=0) {
+        value += beta*y[o];
+    }
+    y[o] = value;
+}
+)CLC";
+
+template <typename T>
+std::string Source()
+{
+    return Preamble(PrecisionOf<T>()) + batchedSource;
+}
+
+template <typename T>
+void TriangularStridedBatched(const bool solve,
+                              const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                              const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event)
+{
+    const bool right = (side==CLBlastSideRight);
+    const size_t t = right ? n : m;
+    const size_t vectors = right ? m : n;
+    if(t==0 || vectors==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < t || b_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, solve ? "TrsmStridedBatched: invalid leading dimension"
+                                            : "TrmmStridedBatched: invalid leading dimension");
+    }
+    if(t<=smallTriangle) {
+        Launch(*queue, Kernel(*queue, Source<T>(), "triangular_batched"), {vectors, batch_count}, {}, event,
+            (cl_int)solve, (cl_int)t, (cl_int)vectors,
+            (cl_int)row_major, (cl_int)right,
+            (cl_int)(triangle==CLBlastTriangleLower),
+            (cl_int)(a_transpose!=CLBlastTransposeNo),
+            (cl_int)(diagonal==CLBlastDiagonalUnit),
+            alpha,
+            a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+            b_buffer, (cl_ulong)b_offset, (cl_int)b_ld, (cl_ulong)b_stride);
+        return;
+    }
+    for(size_t i=0; i<batch_count; i++) {
+        cl_event *last = (i+1==batch_count) ? event : nullptr;
+        if(solve) {
+            Check(::clblast::Trsm<T>(
+                static_cast<::clblast::Layout>(layout),
+                static_cast<::clblast::Side>(side),
+                static_cast<::clblast::Triangle>(triangle),
+                static_cast<::clblast::Transpose>(a_transpose),
+                static_cast<::clblast::Diagonal>(diagonal),
+                m, n, alpha,
+                a_buffer, a_offset+i*a_stride, a_ld,
+                b_buffer, b_offset+i*b_stride, b_ld,
+                queue, last), "Trsm");
+        } else {
+            Check(::clblast::Trmm<T>(
+                static_cast<::clblast::Layout>(layout),
+                static_cast<::clblast::Side>(side),
+                static_cast<::clblast::Triangle>(triangle),
+                static_cast<::clblast::Transpose>(a_transpose),
+                static_cast<::clblast::Diagonal>(diagonal),
+                m, n, alpha,
+                a_buffer, a_offset+i*a_stride, a_ld,
+                b_buffer, b_offset+i*b_stride, b_ld,
+                queue, last), "Trmm");
+        }
+    }
+}
+
+template <typename T>
+void SyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                        const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event)
+{
+    if(n==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    for(size_t i=0; i<batch_count; i++) {
+        Check(::clblast::Syrk<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Triangle>(triangle),
+            static_cast<::clblast::Transpose>(a_transpose),
+            n, k, alpha,
+            a_buffer, a_offset+i*a_stride, a_ld,
+            beta,
+            c_buffer, c_offset+i*c_stride, c_ld,
+            queue, (i+1==batch_count) ? event : nullptr), "Syrk");
+    }
+}
+
+template <typename T>
+void GemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                        const size_t m, const size_t n,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                        const T beta,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event)
+{
+    const bool trans = (a_transpose!=CLBlastTransposeNo);
+    const size_t rows = trans ? n : m;
+    const size_t len = trans ? m : n;
+    if(rows==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, "GemvStridedBatched: invalid leading dimension");
+    }
+    if(m*n<=smallGemv) {
+        Launch(*queue, Kernel(*queue, Source<T>(), "gemv_batched"), {rows, batch_count}, {}, event,
+            (cl_int)rows, (cl_int)len, (cl_int)row_major, (cl_int)trans,
+            alpha,
+            a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+            x_buffer, (cl_ulong)x_offset, (cl_int)x_inc, (cl_ulong)x_stride,
+            beta,
+            y_buffer, (cl_ulong)y_offset, (cl_int)y_inc, (cl_ulong)y_stride);
+        return;
+    }
+    for(size_t i=0; i<batch_count; i++) {
+        Check(::clblast::Gemv<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Transpose>(a_transpose),
+            m, n, alpha,
+            a_buffer, a_offset+i*a_stride, a_ld,
+            x_buffer, x_offset+i*x_stride, x_inc,
+            beta,
+            y_buffer, y_offset+i*y_stride, y_inc,
+            queue, (i+1==batch_count) ? event : nullptr), "Gemv");
+    }
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TriangularStridedBatched<float>(true, layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TriangularStridedBatched<double>(true, layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastStrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TriangularStridedBatched<float>(false, layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TriangularStridedBatched<double>(false, layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        SyrkStridedBatched<float>(layout, triangle, a_transpose, n, k, alpha,
+            a_buffer, a_offset, a_ld, a_stride, beta, c_buffer, c_offset, c_ld, c_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        SyrkStridedBatched<double>(layout, triangle, a_transpose, n, k, alpha,
+            a_buffer, a_offset, a_ld, a_stride, beta, c_buffer, c_offset, c_ld, c_stride,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const float beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemvStridedBatched<float>(layout, a_transpose, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            x_buffer, x_offset, x_inc, x_stride,
+            beta,
+            y_buffer, y_offset, y_inc, y_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const double beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemvStridedBatched<double>(layout, a_transpose, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            x_buffer, x_offset, x_inc, x_stride,
+            beta,
+            y_buffer, y_offset, y_inc, y_stride,
+            batch_count, queue, event);
+    });
+}
+}
@@ -0,0 +1,243 @@
+#include "clkernels.h"
+#include <algorithm>
+
+//
+// Cholesky factorization of a symmetric positive definite matrix
+// and the solve with its factor.
+//
+//   potrf  A = L*L^T (lower) or A = U^T*U (upper)
+//   potrs  A*X = B with the factor of potrf
+//
+// potrf is blocked and right-looking. The diagonal blocks are factorized
+// by one work-group in local memory, the panel below is solved by Trsm
+// and the trailing matrix is updated by Syrk.
+//
+// An upper factor in one layout is the lower factor in the other layout,
+// so potrf always computes a lower factor.
+//
+// info receives 0, or i+1 when the leading minor of order i+1 is not
+// positive definite (the first failure is kept).
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t blockSize = 32;
+
+const char *choleskySource = R"CLC(
+#define AT(i,j) (a_offset + (row_major ? (ulong)(i)*lda+(j) : (ulong)(j)*lda+(i)))
+
+__kernel void potf2_block(
+    const int n, const int row_major,
+    __global REAL *a, const ulong a_offset, const int lda,
+    __global int *info, const ulong info_offset, const int base)
+{
+    __local REAL l[NB*NB];
+    __local int failed;
+    const int lid = get_local_id(0);
+    const int lsz = get_local_size(0);
+
+    for(int idx=lid; idx<n*n; idx+=lsz) {
+        const int i = idx/n;
+        const int j = idx%n;
+        l[i*NB+j] = (j<=i) ? a[AT(i,j)] : 0;
+    }
+    if(lid==0) {
+        failed = 0;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for(int j=0; j<n; j++) {
+        if(lid==0) {
+            const REAL d = l[j*NB+j];
+            if(!(d>0)) {
+                failed = 1;
+                atomic_cmpxchg(&info[info_offset], 0, base+j+1);
+            } else {
+                l[j*NB+j] = sqrt(d);
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if(failed) {
+            break;
+        }
+        const REAL d = l[j*NB+j];
+        for(int i=j+1+lid; i<n; i+=lsz) {
+            l[i*NB+j] /= d;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        const int rest = n-j-1;
+        for(int idx=lid; idx<rest*rest; idx+=lsz) {
+            const int i = j+1+idx/rest;
+            const int c = j+1+idx%rest;
+            if(c<=i) {
+                l[i*NB+c] -= l[i*NB+j]*l[c*NB+j];
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    for(int idx=lid; idx<n*n; idx+=lsz) {
+        const int i = idx/n;
+        const int j = idx%n;
+        if(j<=i) {
+            a[AT(i,j)] = l[i*NB+j];
+        }
+    }
+}
+)CLC";
+
+template <typename T>
+std::string Source()
+{
+    return Preamble(PrecisionOf<T>()) +
+        "#define NB " + std::to_string(blockSize) + "\n" +
+        choleskySource;
+}
+
+template <typename T>
+void Potrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+           const size_t n,
+           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           cl_mem info_buffer, const size_t info_offset,
+           cl_command_queue* queue, cl_event* event)
+{
+    if(a_ld < n) {
+        throw Error(CL_INVALID_VALUE, "Potrf: invalid leading dimension");
+    }
+    const cl_int zero = 0;
+    if(n==0) {
+        CheckCL(clEnqueueFillBuffer(*queue, info_buffer, &zero, sizeof(cl_int), info_offset*sizeof(cl_int), sizeof(cl_int),
+            0, nullptr, event), "clEnqueueFillBuffer");
+        return;
+    }
+    CheckCL(clEnqueueFillBuffer(*queue, info_buffer, &zero, sizeof(cl_int), info_offset*sizeof(cl_int), sizeof(cl_int),
+        0, nullptr, nullptr), "clEnqueueFillBuffer");
+
+    // the upper factor is the lower factor of the transposed storage
+    const bool row_major = (layout==CLBlastLayoutRowMajor) == (triangle==CLBlastTriangleLower);
+    const ::clblast::Layout lay = row_major ? ::clblast::Layout::kRowMajor : ::clblast::Layout::kColMajor;
+    auto at = [&](size_t i, size_t j) {
+        return a_offset + (row_major ? i*a_ld+j : j*a_ld+i);
+    };
+    cl_kernel potf2 = Kernel(*queue, Source<T>(), "potf2_block");
+    const size_t local = std::min<size_t>(256, MaxWorkGroupSize(*queue));
+
+    for(size_t k=0; k<n; k+=blockSize) {
+        const size_t kb = std::min(blockSize, n-k);
+        const size_t rest = n-k-kb;
+        Launch(*queue, potf2, {local}, {local}, (rest==0) ? event : nullptr,
+            (cl_int)kb, (cl_int)row_major,
+            a_buffer, (cl_ulong)at(k,k), (cl_int)a_ld,
+            info_buffer, (cl_ulong)info_offset, (cl_int)k);
+        if(rest==0) {
+            break;
+        }
+        // A21 := A21 * L11^-T
+        Check(::clblast::Trsm<T>(lay,
+            ::clblast::Side::kRight, ::clblast::Triangle::kLower,
+            ::clblast::Transpose::kYes, ::clblast::Diagonal::kNonUnit,
+            rest, kb, T(1),
+            a_buffer, at(k,k), a_ld,
+            a_buffer, at(k+kb,k), a_ld,
+            queue, nullptr), "Trsm");
+        // A22 := A22 - A21 * A21^T
+        Check(::clblast::Syrk<T>(lay,
+            ::clblast::Triangle::kLower, ::clblast::Transpose::kNo,
+            rest, kb, T(-1),
+            a_buffer, at(k+kb,k), a_ld,
+            T(1),
+            a_buffer, at(k+kb,k+kb), a_ld,
+            queue, nullptr), "Syrk");
+    }
+}
+
+template <typename T>
+void Potrs(const CLBlastLayout layout, const CLBlastTriangle triangle,
+           const size_t n, const size_t nrhs,
+           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+           cl_command_queue* queue, cl_event* event)
+{
+    if(a_ld < n || b_ld < LeadingDimension(layout==CLBlastLayoutRowMajor, CLBlastTransposeNo, n, nrhs)) {
+        throw Error(CL_INVALID_VALUE, "Potrs: invalid leading dimension");
+    }
+    if(n==0 || nrhs==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const ::clblast::Layout lay = static_cast<::clblast::Layout>(layout);
+    const ::clblast::Triangle tri = static_cast<::clblast::Triangle>(triangle);
+    const bool lower = (triangle==CLBlastTriangleLower);
+    // lower: L*(L^T*X) = B,  upper: U^T*(U*X) = B
+    const ::clblast::Transpose first = lower ? ::clblast::Transpose::kNo : ::clblast::Transpose::kYes;
+    const ::clblast::Transpose second = lower ? ::clblast::Transpose::kYes : ::clblast::Transpose::kNo;
+    Check(::clblast::Trsm<T>(lay, ::clblast::Side::kLeft, tri, first, ::clblast::Diagonal::kNonUnit,
+        n, nrhs, T(1),
+        a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld,
+        queue, nullptr), "Trsm");
+    Check(::clblast::Trsm<T>(lay, ::clblast::Side::kLeft, tri, second, ::clblast::Diagonal::kNonUnit,
+        n, nrhs, T(1),
+        a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld,
+        queue, event), "Trsm");
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Potrf<float>(layout, triangle, n,
+            a_buffer, a_offset, a_ld,
+            info_buffer, info_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Potrf<double>(layout, triangle, n,
+            a_buffer, a_offset, a_ld,
+            info_buffer, info_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Potrs<float>(layout, triangle, n, nrhs,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Potrs<double>(layout, triangle, n, nrhs,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,255 @@
+#include "clkernels.h"
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+namespace rindow {
+namespace clblast {
+
+namespace {
+
+const char *preambleHalf =
+    "#define REAL float\n"
+    "#define STORAGE half\n"
+    "#define LOAD(p,i) vload_half((i),(p))\n"
+    "#define STORE(v,p,i) vstore_half((v),(i),(p))\n";
+
+const char *preambleSingle =
+    "#define REAL float\n"
+    "#define STORAGE float\n"
+    "#define LOAD(p,i) ((p)[(i)])\n"
+    "#define STORE(v,p,i) ((p)[(i)]=(v))\n";
+
+const char *preambleDouble =
+    "#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n"
+    "#define REAL double\n"
+    "#define STORAGE double\n"
+    "#define LOAD(p,i) ((p)[(i)])\n"
+    "#define STORE(v,p,i) ((p)[(i)]=(v))\n";
+
+typedef std::tuple<cl_context,cl_device_id,std::string> ProgramKey;
+typedef std::tuple<cl_program,std::string> KernelKey;
+
+std::mutex cacheMutex;
+std::map<ProgramKey,cl_program> programs;
+std::map<KernelKey,cl_kernel> kernels;
+
+cl_program BuildProgram(cl_context context, cl_device_id device, const std::string &source)
+{
+    cl_int status;
+    const char *text = source.c_str();
+    size_t length = source.size();
+    cl_program program = clCreateProgramWithSource(context, 1, &text, &length, &status);
+    CheckCL(status, "clCreateProgramWithSource");
+    status = clBuildProgram(program, 1, &device, "", nullptr, nullptr);
+    if(status!=CL_SUCCESS) {
+        size_t size = 0;
+        clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, 0, nullptr, &size);
+        std::string log(size, '\0');
+        clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, size, &log[0], nullptr);
+        clReleaseProgram(program);
+        throw Error(status, "clBuildProgram error="+std::to_string(status)+"\n"+log);
+    }
+    return program;
+}
+
+} // namespace
+
+std::string Preamble(CLBlastPrecision precision)
+{
+    switch(precision) {
+        case CLBlastPrecisionHalf:   return preambleHalf;
+        case CLBlastPrecisionSingle: return preambleSingle;
+        case CLBlastPrecisionDouble: return preambleDouble;
+        default:
+            throw Error(CL_INVALID_VALUE, "Unsupported precision");
+    }
+}
+
+size_t SizeOf(CLBlastPrecision precision)
+{
+    switch(precision) {
+        case CLBlastPrecisionHalf:   return 2;
+        case CLBlastPrecisionSingle: return 4;
+        case CLBlastPrecisionDouble: return 8;
+        default:
+            throw Error(CL_INVALID_VALUE, "Unsupported precision");
+    }
+}
+
+cl_context ContextOf(cl_command_queue queue)
+{
+    cl_context context;
+    CheckCL(clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT, sizeof(context), &context, nullptr),
+        "clGetCommandQueueInfo");
+    return context;
+}
+
+cl_device_id DeviceOf(cl_command_queue queue)
+{
+    cl_device_id device;
+    CheckCL(clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(device), &device, nullptr),
+        "clGetCommandQueueInfo");
+    return device;
+}
+
+size_t MaxWorkGroupSize(cl_command_queue queue)
+{
+    size_t size;
+    CheckCL(clGetDeviceInfo(DeviceOf(queue), CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size), &size, nullptr),
+        "clGetDeviceInfo");
+    return size;
+}
+
+size_t MaxMemAllocSize(cl_command_queue queue)
+{
+    cl_ulong size;
+    CheckCL(clGetDeviceInfo(DeviceOf(queue), CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(size), &size, nullptr),
+        "clGetDeviceInfo");
+    return (size_t)size;
+}
+
+size_t LocalMemSize(cl_command_queue queue)
+{
+    cl_ulong size;
+    CheckCL(clGetDeviceInfo(DeviceOf(queue), CL_DEVICE_LOCAL_MEM_SIZE, sizeof(size), &size, nullptr),
+        "clGetDeviceInfo");
+    return (size_t)size;
+}
+
+cl_kernel Kernel(cl_command_queue queue, const std::string &source, const char *name)
+{
+    cl_context context = ContextOf(queue);
+    cl_device_id device = DeviceOf(queue);
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    ProgramKey programKey(context, device, source);
+    cl_program program;
+    auto p = programs.find(programKey);
+    if(p!=programs.end()) {
+        program = p->second;
+    } else {
+        program = BuildProgram(context, device, source);
+        // Keep the context alive so that its handle is never reused
+        // by another context while the program is cached.
+        clRetainContext(context);
+        programs[programKey] = program;
+    }
+
+    KernelKey kernelKey(program, name);
+    auto k = kernels.find(kernelKey);
+    if(k!=kernels.end()) {
+        return k->second;
+    }
+    cl_int status;
+    cl_kernel kernel = clCreateKernel(program, name, &status);
+    CheckCL(status, "clCreateKernel");
+    kernels[kernelKey] = kernel;
+    return kernel;
+}
+
+std::pair<cl_long,cl_long> Extent(size_t offset, size_t rank, const size_t *shape, const cl_long *strides)
+{
+    cl_long lowest = (cl_long)offset;
+    cl_long highest = (cl_long)offset;
+    for(size_t d=0; d<rank; d++) {
+        if(shape[d]==0) {
+            return {1, 0};
+        }
+        const cl_long extent = strides[d]*(cl_long)(shape[d]-1);
+        if(extent<0) {
+            lowest += extent;
+        } else {
+            highest += extent;
+        }
+    }
+    return {lowest, highest};
+}
+
+void CheckBuffer(const char *where, const char *operand,
+                 cl_mem buffer, size_t element_size, size_t offset,
+                 size_t rank, const size_t *shape, const cl_long *strides,
+                 cl_int status)
+{
+    const auto extent = Extent(offset, rank, shape, strides);
+    if(extent.first>extent.second) {
+        return;
+    }
+    size_t bytes;
+    CheckCL(clGetMemObjectInfo(buffer, CL_MEM_SIZE, sizeof(bytes), &bytes, nullptr), "clGetMemObjectInfo");
+    if(extent.first<0 || (size_t)extent.second >= bytes/element_size) {
+        throw Error(status, std::string(where)+": "+operand+" is out of the buffer");
+    }
+}
+
+void CheckOverlap(const char *where, const char *operand,
+                  size_t rank, const size_t *shape, const cl_long *strides)
+{
+    // sorted by the stride, each dimension must step over the whole
+    // extent of the dimensions before it
+    std::vector<std::pair<cl_long,size_t>> dims;
+    for(size_t d=0; d<rank; d++) {
+        if(shape[d]>1) {
+            dims.emplace_back(strides[d]<0 ? -strides[d] : strides[d], shape[d]);
+        }
+    }
+    std::sort(dims.begin(), dims.end());
+    cl_long extent = 0;
+    for(const auto &dim : dims) {
+        if(dim.first<=extent) {
+            throw Error(CL_INVALID_VALUE, std::string(where)+": elements of "+operand+" overlap");
+        }
+        extent += dim.first*(cl_long)(dim.second-1);
+    }
+}
+
+void CheckDisjoint(const char *where,
+                   const char *a_operand, cl_mem a_buffer, const std::pair<cl_long,cl_long> &a_extent,
+                   const char *b_operand, cl_mem b_buffer, const std::pair<cl_long,cl_long> &b_extent)
+{
+    if(a_buffer==b_buffer &&
+        a_extent.first<=b_extent.second && b_extent.first<=a_extent.second) {
+        throw Error(CL_INVALID_VALUE, std::string(where)+": "+a_operand+" and "+b_operand+" overlap");
+    }
+}
+
+namespace detail {
+std::mutex &LaunchMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+} // namespace detail
+
+Workspace::Workspace(cl_command_queue queue, size_t bytes)
+    : buffer_(nullptr)
+{
+    if(bytes==0) {
+        return;
+    }
+    cl_int status;
+    buffer_ = clCreateBuffer(ContextOf(queue), CL_MEM_READ_WRITE, bytes, nullptr, &status);
+    CheckCL(status, "clCreateBuffer");
+}
+
+Workspace::Workspace(cl_command_queue queue, size_t bytes, const void *data)
+    : buffer_(nullptr)
+{
+    if(bytes==0) {
+        return;
+    }
+    cl_int status;
+    buffer_ = clCreateBuffer(ContextOf(queue), CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR,
+        bytes, const_cast<void *>(data), &status);
+    CheckCL(status, "clCreateBuffer");
+}
+
+Workspace::~Workspace()
+{
+    if(buffer_!=nullptr) {
+        clReleaseMemObject(buffer_);
+    }
+}
+
+} // namespace clblast
+} // namespace rindow
@@ -0,0 +1,231 @@
+#ifndef RINDOW_CLBLAST_CLKERNELS_H_
+#define RINDOW_CLBLAST_CLKERNELS_H_
+
+#define CL_TARGET_OPENCL_VERSION 120
+#include <CL/cl.h>
+#include <stdio.h>
+#include <clblast.h>
+#include <clblast_c.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <utility>
+
+//
+// Helpers for the routines of librindowclblast that run their own
+// OpenCL kernels in addition to (or instead of) the CLBlast routines.
+//
+namespace rindow {
+namespace clblast {
+
+//
+// Error carrying an OpenCL or CLBlast status code.
+//
+class Error : public std::runtime_error {
+public:
+    Error(cl_int status, const std::string &message)
+        : std::runtime_error(message), status_(status) {}
+    cl_int status() const { return status_; }
+private:
+    cl_int status_;
+};
+
+inline void CheckCL(cl_int status, const char *where)
+{
+    if(status!=CL_SUCCESS) {
+        throw Error(status, std::string(where)+" error="+std::to_string(status));
+    }
+}
+
+inline void Check(::clblast::StatusCode status, const char *where)
+{
+    if(status!=::clblast::StatusCode::kSuccess) {
+        throw Error((cl_int)status, std::string(where)+" error="+std::to_string((int)status));
+    }
+}
+
+//
+// Run a routine body and translate exceptions to a status code
+// in the same way as the complex wrappers do.
+//
+template <typename F>
+CLBlastStatusCode Invoke(F body) noexcept
+{
+    try {
+        body();
+    } catch(Error &e) {
+        fprintf(stderr,"CLBlast:%s\n",e.what());
+        return (CLBlastStatusCode)e.status();
+    } catch(std::exception &e) {
+        fprintf(stderr,"CLBlast:%s\n",e.what());
+        return (CLBlastStatusCode)-1;
+    } catch (...) {
+        fprintf(stderr,"CLBlast: unknown error\n");
+        return (CLBlastStatusCode)-1;
+    }
+    return CLBlastSuccess;
+}
+
+//
+// Source preamble for the element type.
+//   REAL       arithmetic type
+//   STORAGE    type of the buffer elements
+//   LOAD/STORE access to the buffer elements
+//
+std::string Preamble(CLBlastPrecision precision);
+
+size_t SizeOf(CLBlastPrecision precision);
+
+template <typename T> CLBlastPrecision PrecisionOf();
+template <> inline CLBlastPrecision PrecisionOf<float>() { return CLBlastPrecisionSingle; }
+template <> inline CLBlastPrecision PrecisionOf<double>() { return CLBlastPrecisionDouble; }
+
+//
+// Compiled kernels are cached per context, device and source text.
+//
+cl_kernel Kernel(cl_command_queue queue, const std::string &source, const char *name);
+
+cl_context ContextOf(cl_command_queue queue);
+cl_device_id DeviceOf(cl_command_queue queue);
+size_t MaxWorkGroupSize(cl_command_queue queue);
+size_t MaxMemAllocSize(cl_command_queue queue);
+size_t LocalMemSize(cl_command_queue queue);
+
+inline size_t RoundUp(size_t value, size_t multiple)
+{
+    return ((value+multiple-1)/multiple)*multiple;
+}
+
+inline size_t CeilDiv(size_t value, size_t divisor)
+{
+    return (value+divisor-1)/divisor;
+}
+
+//
+// Minimum leading dimension of a matrix stored for op(X) of rows x cols.
+//
+inline size_t LeadingDimension(bool row_major, CLBlastTranspose trans, size_t rows, size_t cols)
+{
+    const bool no = (trans==CLBlastTransposeNo);
+    if(row_major) {
+        return no ? cols : rows;
+    }
+    return no ? rows : cols;
+}
+
+//
+// Check a strided operand of "shape" against its buffer. Every element
+// from offset + sum of index[d]*strides[d] must lie in the buffer, or
+// Error of "status" is thrown (a routine standing in for CLBlast gives
+// the status code CLBlast would, e.g. CLBlastInsufficientMemoryA).
+// CheckOverlap rejects an output whose elements would share a location
+// (a stride of 0 or interleaved strides), since the work-items writing
+// them would race. Extent is the lowest and the highest element reached
+// (lowest > highest when the shape is empty), and CheckDisjoint rejects
+// an output whose extent meets the extent of an input in the same buffer.
+//
+std::pair<cl_long,cl_long> Extent(size_t offset, size_t rank, const size_t *shape, const cl_long *strides);
+void CheckBuffer(const char *where, const char *operand,
+                 cl_mem buffer, size_t element_size, size_t offset,
+                 size_t rank, const size_t *shape, const cl_long *strides,
+                 cl_int status=CL_INVALID_VALUE);
+void CheckOverlap(const char *where, const char *operand,
+                  size_t rank, const size_t *shape, const cl_long *strides);
+void CheckDisjoint(const char *where,
+                   const char *a_operand, cl_mem a_buffer, const std::pair<cl_long,cl_long> &a_extent,
+                   const char *b_operand, cl_mem b_buffer, const std::pair<cl_long,cl_long> &b_extent);
+
+//
+// Check a contiguous operand of "size" elements against its buffer.
+//
+inline void CheckArray(const char *where, const char *operand,
+                       cl_mem buffer, size_t element_size, size_t offset, size_t size,
+                       cl_int status=CL_INVALID_VALUE)
+{
+    const size_t shape[] = {size};
+    const cl_long strides[] = {1};
+    CheckBuffer(where, operand, buffer, element_size, offset, 1, shape, strides, status);
+}
+
+//
+// Size of a __local argument.
+//
+struct LocalMemory {
+    size_t bytes;
+};
+
+namespace detail {
+inline void SetArgs(cl_kernel, cl_uint) {}
+
+template <typename T, typename... Rest>
+void SetArgs(cl_kernel kernel, cl_uint index, const T &value, const Rest&... rest);
+
+template <typename... Rest>
+void SetArgs(cl_kernel kernel, cl_uint index, const LocalMemory &value, const Rest&... rest)
+{
+    CheckCL(clSetKernelArg(kernel, index, value.bytes, nullptr), "clSetKernelArg");
+    SetArgs(kernel, index+1, rest...);
+}
+
+template <typename T, typename... Rest>
+void SetArgs(cl_kernel kernel, cl_uint index, const T &value, const Rest&... rest)
+{
+    CheckCL(clSetKernelArg(kernel, index, sizeof(T), &value), "clSetKernelArg");
+    SetArgs(kernel, index+1, rest...);
+}
+
+std::mutex &LaunchMutex();
+} // namespace detail
+
+//
+// Set the arguments and enqueue the kernel.
+// The argument types must match the kernel signature exactly
+// (use cl_int/cl_ulong/REAL explicitly).
+// An empty "local" lets the driver choose the work-group size.
+//
+template <typename... Args>
+void Launch(cl_command_queue queue, cl_kernel kernel,
+            const std::vector<size_t> &global, const std::vector<size_t> &local,
+            cl_event *event, const Args&... args)
+{
+    std::lock_guard<std::mutex> lock(detail::LaunchMutex());
+    detail::SetArgs(kernel, 0, args...);
+    CheckCL(clEnqueueNDRangeKernel(queue, kernel, (cl_uint)global.size(), nullptr,
+        global.data(), local.empty() ? nullptr : local.data(),
+        0, nullptr, event), "clEnqueueNDRangeKernel");
+}
+
+//
+// Give the caller an event when a routine has nothing to enqueue.
+//
+inline void Marker(cl_command_queue queue, cl_event *event)
+{
+    if(event!=nullptr) {
+        CheckCL(clEnqueueMarkerWithWaitList(queue, 0, nullptr, event), "clEnqueueMarkerWithWaitList");
+    }
+}
+
+//
+// Temporary device memory for one call.
+// It is allocated once per call and carved into regions, and released
+// after the commands using it are enqueued (OpenCL keeps it alive
+// until they complete). Given "data", the buffer is read-only and
+// initialized with a copy of it, without a command on the queue.
+//
+class Workspace {
+public:
+    Workspace(cl_command_queue queue, size_t bytes);
+    Workspace(cl_command_queue queue, size_t bytes, const void *data);
+    ~Workspace();
+    Workspace(const Workspace &) = delete;
+    Workspace &operator=(const Workspace &) = delete;
+    cl_mem buffer() const { return buffer_; }
+private:
+    cl_mem buffer_;
+};
+
+} // namespace clblast
+} // namespace rindow
+
+#endif // RINDOW_CLBLAST_CLKERNELS_H_
@@ -205,6 +205,21 @@ CLBlastStatusCode RindowCLBlastZgemmStridedBatched(const CLBlastLayout layout, c
                                                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
                                                         const size_t batch_count,
                                                         cl_command_queue* queue, cl_event* event);
-
+CLBlastStatusCode RindowCLBlastCgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const void *alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const void *beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastZgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const void *alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const void *beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event);
 
 
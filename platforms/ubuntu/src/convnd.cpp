@@ -0,0 +1,680 @@
+#include "clkernels.h"
+
+//
+// Convolution of 1 to 3 spatial dimensions by implicit GEMM.
+//
+//   im      [batch][channels][spatial...]
+//   kernel  [num_kernels][channels][kernel spatial...]
+//   result  [batch][num_kernels][output spatial...]
+//
+// The layouts and the kernel modes are those of Convgemm of CLBlast, with
+// the kernel position reversed for the convolution mode.
+//
+//   forward          result = kernel x im2col(im)            for each image
+//   backward data    im     = col2im(kernel^T x result)      for each image
+//   backward filter  kernel = sum of result x im2col(im)^T   over the batch
+//
+// The columns are never stored; each tile of the GEMM is loaded from the
+// image or the result directly into local memory. Missing spatial
+// dimensions are given a size of 1, so one kernel serves all ranks.
+// The image, the kernel and the result are checked against their buffers.
+//
+// The grouped convolution splits the channels and the kernels into
+// "groups" independent convolutions; the kernel is then
+// [num_kernels][channels/groups][kernel spatial...]. The depthwise
+// convolution is the case of groups = channels.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t maxSpatial = 3;
+// groups of up to this many channels are computed directly
+const size_t directChannels = 4;
+const size_t groupSize = 256;
+
+enum ConvPass {
+    PassForward = 0,
+    PassBackwardData = 1,
+    PassBackwardFilter = 2,
+};
+
+// Kernel argument passed by value. It must match "Geometry" in the source.
+struct Geometry {
+    cl_int in[maxSpatial];
+    cl_int kernel[maxSpatial];
+    cl_int out[maxSpatial];
+    cl_int pad[maxSpatial];
+    cl_int stride[maxSpatial];
+    cl_int dilation[maxSpatial];
+};
+
+const char *convSource = R"CLC(
+typedef struct {
+    int in[3];
+    int kernel[3];
+    int out[3];
+    int pad[3];
+    int stride[3];
+    int dilation[3];
+} Geometry;
+
+// position in the image read by output position o at kernel position kp,
+// or -1 in the padding
+int input_index(const Geometry *g, int o, int kp)
+{
+    int index = 0;
+    int step = 1;
+    for(int d=2; d>=0; d--) {
+        const int od = o % g->out[d]; o /= g->out[d];
+        const int kd = kp % g->kernel[d]; kp /= g->kernel[d];
+        const int i = od*g->stride[d] - g->pad[d] + kd*g->dilation[d];
+        if(i<0 || i>=g->in[d]) {
+            return -1;
+        }
+        index += i*step;
+        step *= g->in[d];
+    }
+    return index;
+}
+
+// output position that reads image position p at kernel position kp,
+// or -1 if there is none
+int output_index(const Geometry *g, int p, int kp)
+{
+    int index = 0;
+    int step = 1;
+    for(int d=2; d>=0; d--) {
+        const int pd = p % g->in[d]; p /= g->in[d];
+        const int kd = kp % g->kernel[d]; kp /= g->kernel[d];
+        const int t = pd + g->pad[d] - kd*g->dilation[d];
+        if(t<0 || t%g->stride[d]!=0 || t/g->stride[d]>=g->out[d]) {
+            return -1;
+        }
+        index += (t/g->stride[d])*step;
+        step *= g->out[d];
+    }
+    return index;
+}
+
+#define KERNEL_POSITION(kp) (CONVOLUTION ? kernel_size-1-(kp) : (kp))
+)CLC";
+
+//
+// Each group is a GEMM of its own channels and kernels; global id 2 runs
+// over the images and the groups.
+//
+const char *convGemmSource = R"CLC(
+// element (row,col) of the left matrix of the GEMM of group "grp"
+REAL load_a(__global const REAL *a, const ulong a_offset,
+            const int channels, const int num_kernels, const int groups, const int kernel_size,
+            const int out_size, const int grp, const int row, const int col)
+{
+#if PASS==0
+    // kernel[grp,row][c][kp]
+    const int c = col / kernel_size;
+    const int kp = col % kernel_size;
+    return a[a_offset + (((ulong)grp*num_kernels + row)*channels + c)*kernel_size + KERNEL_POSITION(kp)];
+#elif PASS==1
+    // kernel[grp,k][row][kp]
+    const int k = col / kernel_size;
+    const int kp = col % kernel_size;
+    return a[a_offset + (((ulong)grp*num_kernels + k)*channels + row)*kernel_size + KERNEL_POSITION(kp)];
+#else
+    // result[b][grp,row][o]
+    const int b = col / out_size;
+    const int o = col % out_size;
+    return a[a_offset + (((ulong)b*groups + grp)*num_kernels + row)*out_size + o];
+#endif
+}
+
+// element (row,col) of the right matrix of the GEMM of group "grp" of the image "batch"
+REAL load_b(const Geometry *g, __global const REAL *b, const ulong b_offset,
+            const int channels, const int num_kernels, const int groups, const int kernel_size,
+            const int in_size, const int out_size,
+            const int batch, const int grp, const int row, const int col)
+{
+#if PASS==0
+    // im2col(im)[c,kp][col]
+    const int c = row / kernel_size;
+    const int kp = row % kernel_size;
+    const int p = input_index(g, col, kp);
+    return (p<0) ? (REAL)0 : b[b_offset + (((ulong)batch*groups + grp)*channels + c)*in_size + p];
+#elif PASS==1
+    // result[batch][grp,k][o] read by image position col
+    const int k = row / kernel_size;
+    const int kp = row % kernel_size;
+    const int o = output_index(g, col, kp);
+    return (o<0) ? (REAL)0 : b[b_offset + (((ulong)batch*groups + grp)*num_kernels + k)*out_size + o];
+#else
+    // im2col(im)^T[b,o][c,kp]
+    const int bt = row / out_size;
+    const int o = row % out_size;
+    const int c = col / kernel_size;
+    const int kp = col % kernel_size;
+    const int p = input_index(g, o, kp);
+    return (p<0) ? (REAL)0 : b[b_offset + (((ulong)bt*groups + grp)*channels + c)*in_size + p];
+#endif
+}
+
+// "channels" and "num_kernels" are those of one group
+__kernel __attribute__((reqd_work_group_size(TILE, TILE, 1)))
+void conv_implicit_gemm(
+    const Geometry g,
+    const int m, const int n, const int k,
+    const int channels, const int num_kernels, const int groups, const int kernel_size,
+    const int in_size, const int out_size,
+    __global const REAL *a, const ulong a_offset,
+    __global const REAL *b, const ulong b_offset,
+    __global REAL *c, const ulong c_offset)
+{
+    __local REAL ta[TILE][TILE+1];
+    __local REAL tb[TILE][TILE+1];
+    const int tj = get_local_id(0);
+    const int ti = get_local_id(1);
+    const int j = get_group_id(0)*TILE + tj;
+    const int i = get_group_id(1)*TILE + ti;
+    const int batch = get_global_id(2) / groups;
+    const int grp = get_global_id(2) % groups;
+
+    REAL acc = 0;
+    for(int l0=0; l0<k; l0+=TILE) {
+        ta[ti][tj] = (i<m && l0+tj<k) ?
+            load_a(a, a_offset, channels, num_kernels, groups, kernel_size, out_size, grp, i, l0+tj) : (REAL)0;
+        tb[ti][tj] = (l0+ti<k && j<n) ?
+            load_b(&g, b, b_offset, channels, num_kernels, groups, kernel_size, in_size, out_size, batch, grp, l0+ti, j) : (REAL)0;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for(int t=0; t<TILE; t++) {
+            acc += ta[ti][t]*tb[t][tj];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(i>=m || j>=n) {
+        return;
+    }
+#if PASS==0 || PASS==1
+    // result or im [batch][grp,i][j]
+    c[c_offset + (((ulong)batch*groups + grp)*m + i)*n + j] = acc;
+#else
+    // kernel[grp,i][ch][kp]
+    const int ch = j / kernel_size;
+    const int kp = j % kernel_size;
+    c[c_offset + (((ulong)grp*num_kernels + i)*channels + ch)*kernel_size + KERNEL_POSITION(kp)] = acc;
+#endif
+}
+)CLC";
+
+//
+// Groups of a few channels, as the depthwise convolution, waste most of a
+// GEMM tile. They are computed directly, one output element per work-item
+// and one work-group per kernel element for the backward filter.
+//
+const char *convDirectSource = R"CLC(
+// "channels" and "num_kernels" are those of one group
+__kernel void conv_direct_forward(
+    const Geometry g, const ulong total,
+    const int channels, const int num_kernels, const int groups, const int kernel_size,
+    const int in_size, const int out_size,
+    __global const REAL *w, const ulong w_offset,
+    __global const REAL *x, const ulong x_offset,
+    __global REAL *y, const ulong y_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    const int o = gid % out_size;
+    const ulong r = gid / out_size;
+    const int k = r % (groups*num_kernels);
+    const ulong b = r / (groups*num_kernels);
+    const int grp = k / num_kernels;
+    REAL acc = 0;
+    for(int c=0; c<channels; c++) {
+        const ulong xo = x_offset + ((b*groups + grp)*channels + c)*in_size;
+        const ulong wo = w_offset + ((ulong)k*channels + c)*kernel_size;
+        for(int kp=0; kp<kernel_size; kp++) {
+            const int p = input_index(&g, o, kp);
+            if(p>=0) {
+                acc += w[wo + KERNEL_POSITION(kp)]*x[xo + p];
+            }
+        }
+    }
+    y[y_offset + gid] = acc;
+}
+
+__kernel void conv_direct_data(
+    const Geometry g, const ulong total,
+    const int channels, const int num_kernels, const int groups, const int kernel_size,
+    const int in_size, const int out_size,
+    __global const REAL *w, const ulong w_offset,
+    __global const REAL *dy, const ulong dy_offset,
+    __global REAL *dx, const ulong dx_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    const int p = gid % in_size;
+    const ulong r = gid / in_size;
+    const int c = r % (groups*channels);
+    const ulong b = r / (groups*channels);
+    const int grp = c / channels;
+    const int cg = c % channels;
+    REAL acc = 0;
+    for(int kg=0; kg<num_kernels; kg++) {
+        const int k = grp*num_kernels + kg;
+        const ulong yo = dy_offset + (b*groups*num_kernels + k)*out_size;
+        const ulong wo = w_offset + ((ulong)k*channels + cg)*kernel_size;
+        for(int kp=0; kp<kernel_size; kp++) {
+            const int o = output_index(&g, p, kp);
+            if(o>=0) {
+                acc += w[wo + KERNEL_POSITION(kp)]*dy[yo + o];
+            }
+        }
+    }
+    dx[dx_offset + gid] = acc;
+}
+
+__kernel __attribute__((reqd_work_group_size(GROUP, 1, 1)))
+void conv_direct_filter(
+    const Geometry g, const int batch_count,
+    const int channels, const int num_kernels, const int groups, const int kernel_size,
+    const int in_size, const int out_size,
+    __global const REAL *x, const ulong x_offset,
+    __global const REAL *dy, const ulong dy_offset,
+    __global REAL *dw, const ulong dw_offset)
+{
+    __local REAL partial[GROUP];
+    const int lid = get_local_id(0);
+    const int id = get_group_id(0);
+    const int kp = id % kernel_size;
+    const int cg = (id / kernel_size) % channels;
+    const int k = id / (kernel_size*channels);
+    const int c = (k / num_kernels)*channels + cg;
+    const int total = batch_count*out_size;
+    REAL acc = 0;
+    for(int l=lid; l<total; l+=GROUP) {
+        const int b = l / out_size;
+        const int o = l % out_size;
+        const int p = input_index(&g, o, kp);
+        if(p>=0) {
+            acc += dy[dy_offset + ((ulong)b*groups*num_kernels + k)*out_size + o]*
+                   x[x_offset + ((ulong)b*groups*channels + c)*in_size + p];
+        }
+    }
+    partial[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            partial[lid] += partial[lid+s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(lid==0) {
+        dw[dw_offset + ((ulong)k*channels + cg)*kernel_size + KERNEL_POSITION(kp)] = partial[0];
+    }
+}
+)CLC";
+
+struct ConvShape {
+    Geometry g;
+    size_t in_size;
+    size_t kernel_size;
+    size_t out_size;
+};
+
+ConvShape MakeShape(const size_t rank, const size_t *input_shape,
+                    const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations)
+{
+    if(rank<1 || rank>maxSpatial) {
+        throw Error(CL_INVALID_VALUE, "ConvgemmNd: spatial rank must be 1 to 3");
+    }
+    ConvShape shape;
+    Geometry &g = shape.g;
+    shape.in_size = 1;
+    shape.kernel_size = 1;
+    shape.out_size = 1;
+    for(size_t d=0; d<maxSpatial; d++) {
+        g.in[d] = g.kernel[d] = g.out[d] = g.stride[d] = g.dilation[d] = 1;
+        g.pad[d] = 0;
+    }
+    for(size_t i=0; i<rank; i++) {
+        const size_t d = maxSpatial-rank+i;
+        if(kernel_shape[i]==0 || strides[i]==0 || dilations[i]==0) {
+            throw Error(CL_INVALID_VALUE, "ConvgemmNd: kernel, stride and dilation must be greater than zero");
+        }
+        const size_t span = dilations[i]*(kernel_shape[i]-1)+1;
+        const size_t padded = input_shape[i]+2*pads[i];
+        const size_t out = (padded<span) ? 0 : (padded-span)/strides[i]+1;
+        g.in[d] = (cl_int)input_shape[i];
+        g.kernel[d] = (cl_int)kernel_shape[i];
+        g.out[d] = (cl_int)out;
+        g.pad[d] = (cl_int)pads[i];
+        g.stride[d] = (cl_int)strides[i];
+        g.dilation[d] = (cl_int)dilations[i];
+        shape.in_size *= input_shape[i];
+        shape.kernel_size *= kernel_shape[i];
+        shape.out_size *= out;
+    }
+    return shape;
+}
+
+// "channels" and "num_kernels" are the totals of all groups
+template <typename T>
+void ConvgemmNd(const ConvPass pass, const CLBlastKernelMode kernel_mode,
+                const size_t rank, const size_t channels, const size_t *input_shape,
+                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                const size_t num_kernels, const size_t groups, const size_t batch_count,
+                const cl_mem a_buffer, const size_t a_offset,
+                const cl_mem b_buffer, const size_t b_offset,
+                cl_mem c_buffer, const size_t c_offset,
+                cl_command_queue* queue, cl_event* event)
+{
+    const ConvShape shape = MakeShape(rank, input_shape, kernel_shape, pads, strides, dilations);
+    if(groups==0 || channels%groups!=0 || num_kernels%groups!=0) {
+        throw Error(CL_INVALID_VALUE, "ConvgemmNd: channels and num_kernels must be multiples of groups");
+    }
+    const size_t group_channels = channels/groups;
+    const size_t group_kernels = num_kernels/groups;
+    const size_t in_size = shape.in_size;
+    const size_t kernel_size = shape.kernel_size;
+    const size_t out_size = shape.out_size;
+
+    // GEMM of m x n for each of "batches" from a reduction of k
+    size_t m, n, k, batches;
+    switch(pass) {
+        case PassForward:
+            m = group_kernels; n = out_size; k = group_channels*kernel_size; batches = batch_count*groups;
+            break;
+        case PassBackwardData:
+            m = group_channels; n = in_size; k = group_kernels*kernel_size; batches = batch_count*groups;
+            break;
+        default:
+            m = group_kernels; n = group_channels*kernel_size; k = batch_count*out_size; batches = groups;
+            break;
+    }
+    if(m==0 || n==0 || batches==0) {
+        Marker(*queue, event);
+        return;
+    }
+    // a, b and c are the kernel, the image and the result in the order of the pass
+    const size_t im_elements = batch_count*channels*in_size;
+    const size_t kernel_elements = num_kernels*group_channels*kernel_size;
+    const size_t result_elements = batch_count*num_kernels*out_size;
+    switch(pass) {
+        case PassForward:
+            CheckArray("ConvgemmNd", "kernel", a_buffer, sizeof(T), a_offset, kernel_elements);
+            CheckArray("ConvgemmNd", "im", b_buffer, sizeof(T), b_offset, im_elements);
+            CheckArray("ConvgemmNd", "result", c_buffer, sizeof(T), c_offset, result_elements);
+            break;
+        case PassBackwardData:
+            CheckArray("ConvgemmNd", "kernel", a_buffer, sizeof(T), a_offset, kernel_elements);
+            CheckArray("ConvgemmNd", "result", b_buffer, sizeof(T), b_offset, result_elements);
+            CheckArray("ConvgemmNd", "im", c_buffer, sizeof(T), c_offset, im_elements);
+            break;
+        default:
+            CheckArray("ConvgemmNd", "result", a_buffer, sizeof(T), a_offset, result_elements);
+            CheckArray("ConvgemmNd", "im", b_buffer, sizeof(T), b_offset, im_elements);
+            CheckArray("ConvgemmNd", "kernel", c_buffer, sizeof(T), c_offset, kernel_elements);
+            break;
+    }
+    const size_t max_group = MaxWorkGroupSize(*queue);
+    std::string source = Preamble(PrecisionOf<T>()) +
+        "#define PASS " + std::to_string((int)pass) + "\n" +
+        "#define CONVOLUTION " + (kernel_mode==CLBlastKernelModeConvolution ? "1" : "0") + "\n";
+
+    if(groups>1 && group_channels<=directChannels) {
+        size_t group = groupSize;
+        while(group>max_group || (group>1 && group/2>=k)) {
+            group >>= 1;
+        }
+        source += "#define GROUP " + std::to_string(group) + "\n" + convSource + convDirectSource;
+        switch(pass) {
+            case PassForward:
+                Launch(*queue, Kernel(*queue, source, "conv_direct_forward"),
+                    {RoundUp(batch_count*num_kernels*out_size, 64)}, {}, event,
+                    shape.g, (cl_ulong)(batch_count*num_kernels*out_size),
+                    (cl_int)group_channels, (cl_int)group_kernels, (cl_int)groups, (cl_int)kernel_size,
+                    (cl_int)in_size, (cl_int)out_size,
+                    a_buffer, (cl_ulong)a_offset,
+                    b_buffer, (cl_ulong)b_offset,
+                    c_buffer, (cl_ulong)c_offset);
+                break;
+            case PassBackwardData:
+                Launch(*queue, Kernel(*queue, source, "conv_direct_data"),
+                    {RoundUp(batch_count*channels*in_size, 64)}, {}, event,
+                    shape.g, (cl_ulong)(batch_count*channels*in_size),
+                    (cl_int)group_channels, (cl_int)group_kernels, (cl_int)groups, (cl_int)kernel_size,
+                    (cl_int)in_size, (cl_int)out_size,
+                    a_buffer, (cl_ulong)a_offset,
+                    b_buffer, (cl_ulong)b_offset,
+                    c_buffer, (cl_ulong)c_offset);
+                break;
+            default:
+                Launch(*queue, Kernel(*queue, source, "conv_direct_filter"),
+                    {num_kernels*group_channels*kernel_size*group}, {group}, event,
+                    shape.g, (cl_int)batch_count,
+                    (cl_int)group_channels, (cl_int)group_kernels, (cl_int)groups, (cl_int)kernel_size,
+                    (cl_int)in_size, (cl_int)out_size,
+                    b_buffer, (cl_ulong)b_offset,
+                    a_buffer, (cl_ulong)a_offset,
+                    c_buffer, (cl_ulong)c_offset);
+                break;
+        }
+        return;
+    }
+
+    const size_t tile = (max_group>=256) ? 16 : 8;
+    source += "#define TILE " + std::to_string(tile) + "\n" + convSource + convGemmSource;
+    Launch(*queue, Kernel(*queue, source, "conv_implicit_gemm"),
+        {RoundUp(n, tile), RoundUp(m, tile), batches}, {tile, tile, 1}, event,
+        shape.g,
+        (cl_int)m, (cl_int)n, (cl_int)k,
+        (cl_int)group_channels, (cl_int)group_kernels, (cl_int)groups, (cl_int)kernel_size,
+        (cl_int)in_size, (cl_int)out_size,
+        a_buffer, (cl_ulong)a_offset,
+        b_buffer, (cl_ulong)b_offset,
+        c_buffer, (cl_ulong)c_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSconvgemmNd(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassForward, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            kernel_buffer, kernel_offset, im_buffer, im_offset, result_buffer, result_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmNd(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassForward, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            kernel_buffer, kernel_offset, im_buffer, im_offset, result_buffer, result_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmNdBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassBackwardData, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            kernel_buffer, kernel_offset, result_buffer, result_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmNdBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassBackwardData, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            kernel_buffer, kernel_offset, result_buffer, result_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmNdBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassBackwardFilter, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            result_buffer, result_offset, im_buffer, im_offset, kernel_buffer, kernel_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmNdBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassBackwardFilter, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, 1, batch_count,
+            result_buffer, result_offset, im_buffer, im_offset, kernel_buffer, kernel_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmGrouped(const CLBlastKernelMode kernel_mode,
+                                                     const size_t rank, const size_t channels, const size_t *input_shape,
+                                                     const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                     const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                     const cl_mem im_buffer, const size_t im_offset,
+                                                     const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                     cl_mem result_buffer, const size_t result_offset,
+                                                     cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassForward, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            kernel_buffer, kernel_offset, im_buffer, im_offset, result_buffer, result_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmGrouped(const CLBlastKernelMode kernel_mode,
+                                                     const size_t rank, const size_t channels, const size_t *input_shape,
+                                                     const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                     const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                     const cl_mem im_buffer, const size_t im_offset,
+                                                     const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                     cl_mem result_buffer, const size_t result_offset,
+                                                     cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassForward, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            kernel_buffer, kernel_offset, im_buffer, im_offset, result_buffer, result_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmGroupedBackwardData(const CLBlastKernelMode kernel_mode,
+                                                                 const size_t rank, const size_t channels, const size_t *input_shape,
+                                                                 const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                                 const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                                 const cl_mem result_buffer, const size_t result_offset,
+                                                                 const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                                 cl_mem im_buffer, const size_t im_offset,
+                                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassBackwardData, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            kernel_buffer, kernel_offset, result_buffer, result_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmGroupedBackwardData(const CLBlastKernelMode kernel_mode,
+                                                                 const size_t rank, const size_t channels, const size_t *input_shape,
+                                                                 const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                                 const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                                 const cl_mem result_buffer, const size_t result_offset,
+                                                                 const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                                 cl_mem im_buffer, const size_t im_offset,
+                                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassBackwardData, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            kernel_buffer, kernel_offset, result_buffer, result_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmGroupedBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                                   const size_t rank, const size_t channels, const size_t *input_shape,
+                                                                   const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                                   const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                                   const cl_mem result_buffer, const size_t result_offset,
+                                                                   cl_mem kernel_buffer, const size_t kernel_offset,
+                                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<float>(PassBackwardFilter, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            result_buffer, result_offset, im_buffer, im_offset, kernel_buffer, kernel_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmGroupedBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                                   const size_t rank, const size_t channels, const size_t *input_shape,
+                                                                   const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                                   const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                                   const cl_mem result_buffer, const size_t result_offset,
+                                                                   cl_mem kernel_buffer, const size_t kernel_offset,
+                                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmNd<double>(PassBackwardFilter, kernel_mode, rank, channels, input_shape,
+            kernel_shape, pads, strides, dilations, num_kernels, groups, batch_count,
+            result_buffer, result_offset, im_buffer, im_offset, kernel_buffer, kernel_offset,
+            queue, event);
+    });
+}
+}
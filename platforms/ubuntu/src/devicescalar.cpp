@@ -0,0 +1,364 @@
+#include "clkernels.h"
+
+//
+// BLAS routines with alpha and beta in device memory.
+//
+// The scalars are read by the kernels, so a value produced by a previous
+// command (e.g. Dot or Nrm2) can be used without reading it back to the host.
+// Scal and Axpy are done by own kernels. Gemv and Gemm run CLBlast with
+// alpha=1 and beta=0 into a workspace and scale the result into y or C.
+// The operands the own kernels touch are checked against their buffers
+// here, since CLBlast does not see them.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const char *deviceScalarSource = R"CLC(
+__kernel void scal_dev(
+    const int n,
+    __global const REAL *alpha, const ulong alpha_offset,
+    __global REAL *x, const ulong x_offset, const int x_inc)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const ulong o = x_offset + (ulong)i*x_inc;
+    x[o] = alpha[alpha_offset]*x[o];
+}
+
+__kernel void axpy_dev(
+    const int n,
+    __global const REAL *alpha, const ulong alpha_offset,
+    __global const REAL *x, const ulong x_offset, const int x_inc,
+    __global REAL *y, const ulong y_offset, const int y_inc)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const ulong o = y_offset + (ulong)i*y_inc;
+    y[o] += alpha[alpha_offset]*x[x_offset + (ulong)i*x_inc];
+}
+
+// C := alpha*T + beta*C for rows x cols, T and C in the same layout
+__kernel void axpby_dev(
+    const int rows, const int cols,
+    __global const REAL *alpha, const ulong alpha_offset,
+    __global const REAL *beta, const ulong beta_offset,
+    __global const REAL *t, const ulong t_offset, const int t_ld, const int t_inc,
+    __global REAL *c, const ulong c_offset, const int c_ld, const int c_inc)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(i>=rows || j>=cols) {
+        return;
+    }
+    const REAL b = beta[beta_offset];
+    const ulong o = c_offset + (ulong)i*c_ld + (ulong)j*c_inc;
+    REAL value = alpha[alpha_offset]*t[t_offset + (ulong)i*t_ld + (ulong)j*t_inc];
+    if(b!=0) {
+        value += b*c[o];
+    }
+    c[o] = value;
+}
+)CLC";
+
+template <typename T>
+std::string Source()
+{
+    return Preamble(PrecisionOf<T>()) + deviceScalarSource;
+}
+
+// alpha, beta or a vector of n elements with the increment "inc"
+void CheckVector(const char *where, const char *operand, cl_mem buffer, size_t element_size,
+                 size_t offset, size_t n, size_t inc, cl_int status)
+{
+    const size_t shape[] = {n};
+    const cl_long strides[] = {(cl_long)inc};
+    CheckBuffer(where, operand, buffer, element_size, offset, 1, shape, strides, status);
+}
+
+template <typename T>
+void ScalDevice(const size_t n,
+                const cl_mem alpha_buffer, const size_t alpha_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event)
+{
+    if(n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(x_inc==0) {
+        throw Error(CLBlastInvalidIncrementX, "ScalDevice: x_inc must not be zero");
+    }
+    CheckVector("ScalDevice", "alpha", alpha_buffer, sizeof(T), alpha_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    CheckVector("ScalDevice", "x", x_buffer, sizeof(T), x_offset, n, x_inc, CLBlastInsufficientMemoryX);
+    Launch(*queue, Kernel(*queue, Source<T>(), "scal_dev"), {n}, {}, event,
+        (cl_int)n,
+        alpha_buffer, (cl_ulong)alpha_offset,
+        x_buffer, (cl_ulong)x_offset, (cl_int)x_inc);
+}
+
+template <typename T>
+void AxpyDevice(const size_t n,
+                const cl_mem alpha_buffer, const size_t alpha_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event)
+{
+    if(n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(x_inc==0) {
+        throw Error(CLBlastInvalidIncrementX, "AxpyDevice: x_inc must not be zero");
+    }
+    if(y_inc==0) {
+        throw Error(CLBlastInvalidIncrementY, "AxpyDevice: y_inc must not be zero");
+    }
+    CheckVector("AxpyDevice", "alpha", alpha_buffer, sizeof(T), alpha_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    CheckVector("AxpyDevice", "x", x_buffer, sizeof(T), x_offset, n, x_inc, CLBlastInsufficientMemoryX);
+    CheckVector("AxpyDevice", "y", y_buffer, sizeof(T), y_offset, n, y_inc, CLBlastInsufficientMemoryY);
+    Launch(*queue, Kernel(*queue, Source<T>(), "axpy_dev"), {n}, {}, event,
+        (cl_int)n,
+        alpha_buffer, (cl_ulong)alpha_offset,
+        x_buffer, (cl_ulong)x_offset, (cl_int)x_inc,
+        y_buffer, (cl_ulong)y_offset, (cl_int)y_inc);
+}
+
+template <typename T>
+void GemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                const size_t m, const size_t n,
+                const cl_mem alpha_buffer, const size_t alpha_offset,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem beta_buffer, const size_t beta_offset,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event)
+{
+    const size_t y_len = (a_transpose==CLBlastTransposeNo) ? m : n;
+    if(y_len==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(y_inc==0) {
+        throw Error(CLBlastInvalidIncrementY, "GemvDevice: y_inc must not be zero");
+    }
+    CheckVector("GemvDevice", "alpha", alpha_buffer, sizeof(T), alpha_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    CheckVector("GemvDevice", "beta", beta_buffer, sizeof(T), beta_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    CheckVector("GemvDevice", "y", y_buffer, sizeof(T), y_offset, y_len, y_inc, CLBlastInsufficientMemoryY);
+    Workspace workspace(*queue, y_len*sizeof(T));
+    cl_mem t = workspace.buffer();
+    const size_t x_len = (a_transpose==CLBlastTransposeNo) ? n : m;
+    if(x_len==0) {
+        // op(A)*x is zero and Gemv of CLBlast rejects an empty x
+        const T zero = 0;
+        CheckCL(clEnqueueFillBuffer(*queue, t, &zero, sizeof(T), 0, y_len*sizeof(T), 0, nullptr, nullptr),
+            "clEnqueueFillBuffer");
+    } else {
+        Check(::clblast::Gemv<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Transpose>(a_transpose),
+            m, n,
+            T(1),
+            a_buffer, a_offset, a_ld,
+            x_buffer, x_offset, x_inc,
+            T(0),
+            t, 0, 1,
+            queue, nullptr), "Gemv");
+    }
+    Launch(*queue, Kernel(*queue, Source<T>(), "axpby_dev"), {y_len, 1}, {}, event,
+        (cl_int)1, (cl_int)y_len,
+        alpha_buffer, (cl_ulong)alpha_offset,
+        beta_buffer, (cl_ulong)beta_offset,
+        t, (cl_ulong)0, (cl_int)0, (cl_int)1,
+        y_buffer, (cl_ulong)y_offset, (cl_int)0, (cl_int)y_inc);
+}
+
+template <typename T>
+void GemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const cl_mem alpha_buffer, const size_t alpha_offset,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const cl_mem beta_buffer, const size_t beta_offset,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_command_queue* queue, cl_event* event)
+{
+    if(m==0 || n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    const size_t t_ld = row_major ? n : m;
+    if(c_ld<t_ld) {
+        throw Error(CLBlastInvalidLeadDimC, "GemmDevice: c_ld is too small");
+    }
+    CheckVector("GemmDevice", "alpha", alpha_buffer, sizeof(T), alpha_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    CheckVector("GemmDevice", "beta", beta_buffer, sizeof(T), beta_offset, 1, 1, CLBlastInsufficientMemoryScalar);
+    {
+        const size_t shape[] = {row_major ? m : n, row_major ? n : m};
+        const cl_long strides[] = {(cl_long)c_ld, 1};
+        CheckBuffer("GemmDevice", "c", c_buffer, sizeof(T), c_offset, 2, shape, strides,
+            CLBlastInsufficientMemoryC);
+    }
+    Workspace workspace(*queue, m*n*sizeof(T));
+    cl_mem t = workspace.buffer();
+    if(k==0) {
+        // op(A)*op(B) is zero and Gemm of CLBlast rejects k = 0
+        const T zero = 0;
+        CheckCL(clEnqueueFillBuffer(*queue, t, &zero, sizeof(T), 0, m*n*sizeof(T), 0, nullptr, nullptr),
+            "clEnqueueFillBuffer");
+    } else {
+        Check(::clblast::Gemm<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Transpose>(a_transpose),
+            static_cast<::clblast::Transpose>(b_transpose),
+            m, n, k,
+            T(1),
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            T(0),
+            t, 0, t_ld,
+            queue, nullptr), "Gemm");
+    }
+    // walk C in its storage order: "rows" are the stored rows
+    const size_t rows = row_major ? m : n;
+    const size_t cols = row_major ? n : m;
+    Launch(*queue, Kernel(*queue, Source<T>(), "axpby_dev"), {cols, rows}, {}, event,
+        (cl_int)rows, (cl_int)cols,
+        alpha_buffer, (cl_ulong)alpha_offset,
+        beta_buffer, (cl_ulong)beta_offset,
+        t, (cl_ulong)0, (cl_int)t_ld, (cl_int)1,
+        c_buffer, (cl_ulong)c_offset, (cl_int)c_ld, (cl_int)1);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSscalDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ScalDevice<float>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDscalDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ScalDevice<double>(n, alpha_buffer, alpha_offset, x_buffer, x_offset, x_inc, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSaxpyDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        AxpyDevice<float>(n, alpha_buffer, alpha_offset,
+            x_buffer, x_offset, x_inc,
+            y_buffer, y_offset, y_inc,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDaxpyDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        AxpyDevice<double>(n, alpha_buffer, alpha_offset,
+            x_buffer, x_offset, x_inc,
+            y_buffer, y_offset, y_inc,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgemvDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                      const size_t m, const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemvDevice<float>(layout, a_transpose, m, n,
+            alpha_buffer, alpha_offset,
+            a_buffer, a_offset, a_ld,
+            x_buffer, x_offset, x_inc,
+            beta_buffer, beta_offset,
+            y_buffer, y_offset, y_inc,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgemvDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                      const size_t m, const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemvDevice<double>(layout, a_transpose, m, n,
+            alpha_buffer, alpha_offset,
+            a_buffer, a_offset, a_ld,
+            x_buffer, x_offset, x_inc,
+            beta_buffer, beta_offset,
+            y_buffer, y_offset, y_inc,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgemmDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmDevice<float>(layout, a_transpose, b_transpose, m, n, k,
+            alpha_buffer, alpha_offset,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta_buffer, beta_offset,
+            c_buffer, c_offset, c_ld,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgemmDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmDevice<double>(layout, a_transpose, b_transpose, m, n, k,
+            alpha_buffer, alpha_offset,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta_buffer, beta_offset,
+            c_buffer, c_offset, c_ld,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,611 @@
+#include "clkernels.h"
+#include <regex>
+
+//
+// Elementwise operations over strided N-d arrays.
+//
+//   unary   Y[idx] := f(X[idx])            (alpha and beta are op parameters)
+//   binary  C[idx] := f(A[idx], B[idx])
+//   fused   Y[idx] := expression of X0[idx] ... X7[idx] and scalars
+//
+// Every operand has its own strides over the shape of the output, so
+// broadcasting is a stride of 0 and any view (transposed, sliced) can be
+// read or written in place. Every element reached must lie in its
+// buffer, and the elements of the output must not overlap.
+//
+// Before the launch, dimensions of size 1 are dropped and adjacent
+// dimensions that are contiguous in all operands are merged, so a dense
+// array becomes rank 1. Kernels are compiled per op, element type and
+// (merged) rank; the shape and strides are passed by value, or in a
+// constant buffer for a fused expression.
+//
+// A fused expression is one pass for a chain of operations, such as
+// "t0 = s0*x0 + x1; relu(t0)*x2". Statements before the last one define
+// temporaries t0, t1, ... The expression may use the inputs x0..x7,
+// the scalars s0..s7, numbers, the operators of C and the functions in
+// "fusedFunctions". Its kernel is compiled once per expression text.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t maxRank = 8;
+const size_t maxInputs = 8;
+const size_t maxScalars = 8;
+
+enum UnaryOp {
+    UnaryCopy = 0,
+    UnaryNeg,
+    UnaryAbs,
+    UnaryExp,
+    UnaryLog,
+    UnarySqrt,
+    UnarySquare,
+    UnaryTanh,
+    UnarySigmoid,
+    UnaryRelu,
+    UnaryClamp,
+    UnaryPow,
+    UnaryAffine,
+    UnaryOps
+};
+
+const char *unaryExpressions[UnaryOps] = {
+    "(x)",
+    "(-(x))",
+    "fabs(x)",
+    "exp(x)",
+    "log(x)",
+    "sqrt(x)",
+    "((x)*(x))",
+    "tanh(x)",
+    "((REAL)1/((REAL)1+exp(-(x))))",
+    "(((x)>0) ? (x) : (REAL)0)",
+    "fmin(fmax((x),alpha),beta)",
+    "pow((x),alpha)",
+    "(alpha*(x)+beta)",
+};
+
+enum BinaryOp {
+    BinaryAdd = 0,
+    BinarySub,
+    BinaryMul,
+    BinaryDiv,
+    BinaryPow,
+    BinaryMax,
+    BinaryMin,
+    BinaryOps
+};
+
+const char *binaryExpressions[BinaryOps] = {
+    "((a)+(b))",
+    "((a)-(b))",
+    "((a)*(b))",
+    "((a)/(b))",
+    "pow((a),(b))",
+    "fmax((a),(b))",
+    "fmin((a),(b))",
+};
+
+// Kernel argument passed by value. It must match "Layout" in the source.
+template <size_t Operands>
+struct Layout {
+    cl_long shape[maxRank];
+    cl_long stride[Operands][maxRank];
+};
+
+// Kernel argument passed by value. It must match "Scalars" in the source.
+template <typename T>
+struct Scalars {
+    T s[maxScalars];
+};
+
+const char *fusedFunctions[] = {
+    "exp", "log", "sqrt", "rsqrt", "tanh", "sin", "cos", "erf", "fabs",
+    "floor", "ceil", "fmax", "fmin", "pow", "relu", "sigmoid",
+};
+
+const char *elementwiseSource = R"CLC(
+typedef struct {
+    long shape[MAXRANK];
+    long stride[OPERANDS][MAXRANK];
+} Layout;
+
+// The layout is an argument by value of unary and binary. For the 9
+// operands of fused it is too large for CL_DEVICE_MAX_PARAMETER_SIZE
+// (1024 bytes at least) and is a __constant buffer instead.
+#if defined(STATEMENTS)
+#define LAYOUT_SPACE __constant
+#else
+#define LAYOUT_SPACE const
+#endif
+
+// offsets of the element of the linear index in each operand
+void locate(LAYOUT_SPACE Layout *layout, ulong gid, long *offsets)
+{
+    for(int d=RANK-1; d>=0; d--) {
+        const long c = gid % (ulong)layout->shape[d];
+        gid /= (ulong)layout->shape[d];
+        for(int o=0; o<OPERANDS; o++) {
+            offsets[o] += c*layout->stride[o][d];
+        }
+    }
+}
+
+#if defined(STATEMENTS)
+typedef struct {
+    REAL s[MAXSCALARS];
+} Scalars;
+
+#define relu(v) fmax((v),(REAL)0)
+#define sigmoid(v) ((REAL)1/((REAL)1+exp(-(v))))
+#define s0 scalars.s[0]
+#define s1 scalars.s[1]
+#define s2 scalars.s[2]
+#define s3 scalars.s[3]
+#define s4 scalars.s[4]
+#define s5 scalars.s[5]
+#define s6 scalars.s[6]
+#define s7 scalars.s[7]
+
+__kernel void fused(
+    const ulong total, __constant Layout *layout, const Scalars scalars,
+    __global const STORAGE *b0, const ulong o0,
+    __global const STORAGE *b1, const ulong o1,
+    __global const STORAGE *b2, const ulong o2,
+    __global const STORAGE *b3, const ulong o3,
+    __global const STORAGE *b4, const ulong o4,
+    __global const STORAGE *b5, const ulong o5,
+    __global const STORAGE *b6, const ulong o6,
+    __global const STORAGE *b7, const ulong o7,
+    __global STORAGE *y_buffer, const ulong y_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    long offsets[9] = {o0, o1, o2, o3, o4, o5, o6, o7, y_offset};
+    locate(layout, gid, offsets);
+    LOAD_INPUTS
+    STATEMENTS
+    STORE(RESULT, y_buffer, offsets[8]);
+}
+#elif OPERANDS==2
+__kernel void unary(
+    const ulong total, const Layout layout,
+    const REAL alpha, const REAL beta,
+    __global const STORAGE *x_buffer, const ulong x_offset,
+    __global STORAGE *y_buffer, const ulong y_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    long offsets[2] = {x_offset, y_offset};
+    locate(&layout, gid, offsets);
+    const REAL x = LOAD(x_buffer, offsets[0]);
+    STORE(F, y_buffer, offsets[1]);
+}
+#else
+__kernel void binary(
+    const ulong total, const Layout layout,
+    __global const STORAGE *a_buffer, const ulong a_offset,
+    __global const STORAGE *b_buffer, const ulong b_offset,
+    __global STORAGE *c_buffer, const ulong c_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    long offsets[3] = {a_offset, b_offset, c_offset};
+    locate(&layout, gid, offsets);
+    const REAL a = LOAD(a_buffer, offsets[0]);
+    const REAL b = LOAD(b_buffer, offsets[1]);
+    STORE(F, c_buffer, offsets[2]);
+}
+#endif
+)CLC";
+
+//
+// Drop dimensions of 1 and merge contiguous dimensions of all operands.
+// Returns the number of elements.
+//
+template <size_t Operands>
+size_t Collapse(const size_t rank, const size_t *shape,
+                const cl_long *const *strides,
+                Layout<Operands> &layout, size_t &merged_rank)
+{
+    const size_t operands = Operands;
+    size_t total = 1;
+    size_t r = 0;
+    for(size_t d=0; d<rank; d++) {
+        total *= shape[d];
+        if(shape[d]==1) {
+            continue;
+        }
+        bool contiguous = (r>0);
+        for(size_t o=0; o<operands && contiguous; o++) {
+            if(layout.stride[o][r-1] != strides[o][d]*(cl_long)shape[d]) {
+                contiguous = false;
+            }
+        }
+        if(contiguous) {
+            layout.shape[r-1] *= shape[d];
+            for(size_t o=0; o<operands; o++) {
+                layout.stride[o][r-1] = strides[o][d];
+            }
+            continue;
+        }
+        if(r>=maxRank) {
+            throw Error(CL_INVALID_VALUE, "Elementwise: too many dimensions");
+        }
+        layout.shape[r] = shape[d];
+        for(size_t o=0; o<operands; o++) {
+            layout.stride[o][r] = strides[o][d];
+        }
+        r++;
+    }
+    if(r==0) {
+        layout.shape[0] = 1;
+        r = 1;
+    }
+    merged_rank = r;
+    return total;
+}
+
+std::string Source(CLBlastPrecision precision, const char *expression, size_t operands, size_t rank)
+{
+    return Preamble(precision) +
+        "#define MAXRANK " + std::to_string(maxRank) + "\n" +
+        "#define RANK " + std::to_string(rank) + "\n" +
+        "#define OPERANDS " + std::to_string(operands) + "\n" +
+        "#define F " + expression + "\n" +
+        elementwiseSource;
+}
+
+template <typename T>
+void Unary(const CLBlastPrecision precision, const int op,
+           const size_t rank, const size_t *shape,
+           const T alpha, const T beta,
+           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+           cl_command_queue* queue, cl_event* event)
+{
+    if(op<0 || op>=UnaryOps) {
+        throw Error(CL_INVALID_VALUE, "Unary: unknown operation");
+    }
+    Layout<2> layout = {};
+    const cl_long *strides[2] = {x_strides, y_strides};
+    size_t merged_rank;
+    const size_t total = Collapse(rank, shape, strides, layout, merged_rank);
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t element_size = SizeOf(precision);
+    CheckBuffer("Unary", "x", x_buffer, element_size, x_offset, rank, shape, x_strides);
+    CheckBuffer("Unary", "y", y_buffer, element_size, y_offset, rank, shape, y_strides);
+    CheckOverlap("Unary", "y", rank, shape, y_strides);
+    const std::string source = Source(precision, unaryExpressions[op], 2, merged_rank);
+    Launch(*queue, Kernel(*queue, source, "unary"), {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total, layout,
+        alpha, beta,
+        x_buffer, (cl_ulong)x_offset,
+        y_buffer, (cl_ulong)y_offset);
+}
+
+void Binary(const CLBlastPrecision precision, const int op,
+            const size_t rank, const size_t *shape,
+            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+            cl_command_queue* queue, cl_event* event)
+{
+    if(op<0 || op>=BinaryOps) {
+        throw Error(CL_INVALID_VALUE, "Binary: unknown operation");
+    }
+    Layout<3> layout = {};
+    const cl_long *strides[3] = {a_strides, b_strides, c_strides};
+    size_t merged_rank;
+    const size_t total = Collapse(rank, shape, strides, layout, merged_rank);
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t element_size = SizeOf(precision);
+    CheckBuffer("Binary", "a", a_buffer, element_size, a_offset, rank, shape, a_strides);
+    CheckBuffer("Binary", "b", b_buffer, element_size, b_offset, rank, shape, b_strides);
+    CheckBuffer("Binary", "c", c_buffer, element_size, c_offset, rank, shape, c_strides);
+    CheckOverlap("Binary", "c", rank, shape, c_strides);
+    const std::string source = Source(precision, binaryExpressions[op], 3, merged_rank);
+    Launch(*queue, Kernel(*queue, source, "binary"), {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total, layout,
+        a_buffer, (cl_ulong)a_offset,
+        b_buffer, (cl_ulong)b_offset,
+        c_buffer, (cl_ulong)c_offset);
+}
+
+//
+// Check the tokens of one expression: only the inputs, scalars, defined
+// temporaries, known functions, numbers and operators are accepted.
+//
+void CheckExpression(const std::string &text, size_t inputs, size_t scalars, size_t temporaries)
+{
+    static const std::regex token(
+        R"(\s+|([A-Za-z_][A-Za-z0-9_]*)|([0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?)|(==|!=|<=|>=|&&|\|\||[-+*/(),?:<>!]))");
+    auto it = text.cbegin();
+    std::smatch match;
+    while(it!=text.cend()) {
+        if(!std::regex_search(it, text.cend(), match, token, std::regex_constants::match_continuous)) {
+            throw Error(CL_INVALID_VALUE, "Fused: invalid character in \""+text+"\"");
+        }
+        if(match[1].matched) {
+            const std::string name = match[1].str();
+            bool known = false;
+            for(const char *function : fusedFunctions) {
+                known = known || (name==function);
+            }
+            static const std::regex variable("([xst])([0-9])");
+            std::smatch parts;
+            if(!known && std::regex_match(name, parts, variable)) {
+                const size_t index = std::stoul(parts[2].str());
+                const char kind = parts[1].str()[0];
+                known = (kind=='x' && index<inputs) ||
+                        (kind=='s' && index<scalars) ||
+                        (kind=='t' && index<temporaries);
+            }
+            if(!known) {
+                throw Error(CL_INVALID_VALUE, "Fused: unknown name \""+name+"\"");
+            }
+        }
+        it += match.length(0);
+    }
+}
+
+//
+// Kernel source of the statements "t0 = ...; t1 = ...; result".
+//
+std::string FusedSource(CLBlastPrecision precision, std::string expression,
+                        size_t inputs, size_t scalars, size_t rank)
+{
+    // the statements go into one-line macros
+    for(char &c : expression) {
+        if(c=='\n' || c=='\r' || c=='\t') {
+            c = ' ';
+        }
+    }
+    std::vector<std::string> statements;
+    size_t begin = 0;
+    while(true) {
+        const size_t end = expression.find(';', begin);
+        statements.push_back(expression.substr(begin, end==std::string::npos ? end : end-begin));
+        if(end==std::string::npos) {
+            break;
+        }
+        begin = end+1;
+    }
+    static const std::regex assignment(R"(^\s*t([0-9])\s*=([^=].*)$)");
+    std::string body;
+    for(size_t i=0; i+1<statements.size(); i++) {
+        std::smatch parts;
+        if(!std::regex_match(statements[i], parts, assignment) || std::stoul(parts[1].str())!=i) {
+            throw Error(CL_INVALID_VALUE, "Fused: statement "+std::to_string(i)+" must be \"t"+std::to_string(i)+" = ...\"");
+        }
+        CheckExpression(parts[2].str(), inputs, scalars, i);
+        body += "const REAL t"+std::to_string(i)+" = ("+parts[2].str()+"); ";
+    }
+    const std::string result = statements.back();
+    if(result.find_first_not_of(" \t\r\n")==std::string::npos) {
+        throw Error(CL_INVALID_VALUE, "Fused: empty expression");
+    }
+    CheckExpression(result, inputs, scalars, statements.size()-1);
+    std::string loads;
+    for(size_t i=0; i<inputs; i++) {
+        const std::string n = std::to_string(i);
+        loads += "const REAL x"+n+" = LOAD(b"+n+", offsets["+n+"]); ";
+    }
+    return Preamble(precision) +
+        "#define MAXRANK " + std::to_string(maxRank) + "\n" +
+        "#define MAXSCALARS " + std::to_string(maxScalars) + "\n" +
+        "#define RANK " + std::to_string(rank) + "\n" +
+        "#define OPERANDS " + std::to_string(maxInputs+1) + "\n" +
+        "#define LOAD_INPUTS " + loads + "\n" +
+        "#define STATEMENTS " + body + "\n" +
+        "#define RESULT (" + result + ")\n" +
+        elementwiseSource;
+}
+
+template <typename T>
+void Fused(const CLBlastPrecision precision, const char *expression,
+           const size_t rank, const size_t *shape,
+           const size_t inputs,
+           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+           const size_t scalar_count, const T *scalars,
+           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+           cl_command_queue* queue, cl_event* event)
+{
+    if(inputs>maxInputs || scalar_count>maxScalars) {
+        throw Error(CL_INVALID_VALUE, "Fused: too many inputs or scalars");
+    }
+    // the strides of input i are x_strides[i*rank ... i*rank+rank-1]
+    const cl_long *strides[maxInputs+1];
+    for(size_t i=0; i<maxInputs; i++) {
+        strides[i] = (i<inputs) ? x_strides+i*rank : y_strides;
+    }
+    strides[maxInputs] = y_strides;
+    Layout<maxInputs+1> layout = {};
+    size_t merged_rank;
+    const size_t total = Collapse(rank, shape, strides, layout, merged_rank);
+    const std::string source = FusedSource(precision, expression, inputs, scalar_count, merged_rank);
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t element_size = SizeOf(precision);
+    for(size_t i=0; i<inputs; i++) {
+        const std::string name = "x"+std::to_string(i);
+        CheckBuffer("Fused", name.c_str(), x_buffers[i], element_size, x_offsets[i],
+            rank, shape, x_strides+i*rank);
+    }
+    CheckBuffer("Fused", "y", y_buffer, element_size, y_offset, rank, shape, y_strides);
+    CheckOverlap("Fused", "y", rank, shape, y_strides);
+    Workspace layout_buffer(*queue, sizeof(layout), &layout);
+    Scalars<T> values = {};
+    for(size_t i=0; i<scalar_count; i++) {
+        values.s[i] = scalars[i];
+    }
+    // unused inputs are bound to the output and never read
+    cl_mem b[maxInputs];
+    cl_ulong o[maxInputs];
+    for(size_t i=0; i<maxInputs; i++) {
+        b[i] = (i<inputs) ? x_buffers[i] : y_buffer;
+        o[i] = (i<inputs) ? (cl_ulong)x_offsets[i] : (cl_ulong)y_offset;
+    }
+    Launch(*queue, Kernel(*queue, source, "fused"), {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total, layout_buffer.buffer(), values,
+        b[0], o[0], b[1], o[1], b[2], o[2], b[3], o[3],
+        b[4], o[4], b[5], o[5], b[6], o[6], b[7], o[7],
+        y_buffer, (cl_ulong)y_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastHunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const float alpha, const float beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Unary<float>(CLBlastPrecisionHalf, op, rank, shape, alpha, beta,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const float alpha, const float beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Unary<float>(CLBlastPrecisionSingle, op, rank, shape, alpha, beta,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const double alpha, const double beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Unary<double>(CLBlastPrecisionDouble, op, rank, shape, alpha, beta,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastHbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Binary(CLBlastPrecisionHalf, op, rank, shape,
+            a_buffer, a_offset, a_strides,
+            b_buffer, b_offset, b_strides,
+            c_buffer, c_offset, c_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Binary(CLBlastPrecisionSingle, op, rank, shape,
+            a_buffer, a_offset, a_strides,
+            b_buffer, b_offset, b_strides,
+            c_buffer, c_offset, c_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Binary(CLBlastPrecisionDouble, op, rank, shape,
+            a_buffer, a_offset, a_strides,
+            b_buffer, b_offset, b_strides,
+            c_buffer, c_offset, c_strides,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastHfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const float *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Fused<float>(CLBlastPrecisionHalf, expression, rank, shape, inputs,
+            x_buffers, x_offsets, x_strides,
+            scalar_count, scalars,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const float *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Fused<float>(CLBlastPrecisionSingle, expression, rank, shape, inputs,
+            x_buffers, x_offsets, x_strides,
+            scalar_count, scalars,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const double *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Fused<double>(CLBlastPrecisionDouble, expression, rank, shape, inputs,
+            x_buffers, x_offsets, x_strides,
+            scalar_count, scalars,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,169 @@
+#include "clkernels.h"
+
+//
+// GEMM followed by a fused epilogue on C.
+//
+//   C := act(alpha * op(A) * op(B) + beta * C + bias)
+//
+// bias is none, one value per row of C (m) or one value per column (n),
+// and is checked against its buffer.
+// act is none, ReLU or GELU (the erf form).
+//
+// The product is computed by Gemm of CLBlast; the bias and activation
+// run in one pass right after it, while C is still in the device cache
+// for all but the largest matrices. Compared with a separate bias add
+// and activation this reads and writes C once instead of twice.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+enum EpilogueBias {
+    BiasNone = 0,
+    BiasRow = 1,
+    BiasColumn = 2,
+};
+
+enum EpilogueActivation {
+    ActivationNone = 0,
+    ActivationRelu = 1,
+    ActivationGelu = 2,
+};
+
+const char *epilogueSource = R"CLC(
+__kernel void gemm_epilogue(
+    const int m, const int n, const int row_major,
+    __global REAL *c, const ulong c_offset, const int ldc,
+    const int bias_mode, __global const REAL *bias, const ulong bias_offset)
+{
+    const int inner = get_global_id(0);
+    const int outer = get_global_id(1);
+    const int i = row_major ? outer : inner;
+    const int j = row_major ? inner : outer;
+    if(i>=m || j>=n) {
+        return;
+    }
+    const ulong o = c_offset + (ulong)outer*ldc + inner;
+    REAL v = c[o];
+    if(bias_mode==1) {
+        v += bias[bias_offset+i];
+    } else if(bias_mode==2) {
+        v += bias[bias_offset+j];
+    }
+#if ACTIVATION==1
+    v = (v>0) ? v : (REAL)0;
+#elif ACTIVATION==2
+    v = (REAL)0.5*v*((REAL)1+erf(v*(REAL)0.70710678118654752440));
+#endif
+    c[o] = v;
+}
+)CLC";
+
+template <typename T>
+void GemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                  const int bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                  const int activation,
+                  cl_command_queue* queue, cl_event* event)
+{
+    if(bias_mode<BiasNone || bias_mode>BiasColumn) {
+        throw Error(CL_INVALID_VALUE, "GemmEpilogue: unknown bias mode");
+    }
+    if(activation<ActivationNone || activation>ActivationGelu) {
+        throw Error(CL_INVALID_VALUE, "GemmEpilogue: unknown activation");
+    }
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(c_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, "GemmEpilogue: invalid leading dimension");
+    }
+    if(m==0 || n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    // checked before Gemm so that a bad bias leaves C untouched
+    if(bias_mode!=BiasNone) {
+        CheckArray("GemmEpilogue", "bias", bias_buffer, sizeof(T), bias_offset,
+            (bias_mode==BiasRow) ? m : n);
+    }
+    Check(::clblast::Gemm<T>(
+        static_cast<::clblast::Layout>(layout),
+        static_cast<::clblast::Transpose>(a_transpose),
+        static_cast<::clblast::Transpose>(b_transpose),
+        m, n, k,
+        alpha,
+        a_buffer, a_offset, a_ld,
+        b_buffer, b_offset, b_ld,
+        beta,
+        c_buffer, c_offset, c_ld,
+        queue, nullptr), "Gemm");
+    if(bias_mode==BiasNone && activation==ActivationNone) {
+        Marker(*queue, event);
+        return;
+    }
+    const std::string source = Preamble(PrecisionOf<T>()) +
+        "#define ACTIVATION " + std::to_string(activation) + "\n" +
+        epilogueSource;
+    const size_t inner = row_major ? n : m;
+    const size_t outer = row_major ? m : n;
+    Launch(*queue, Kernel(*queue, source, "gemm_epilogue"), {inner, outer}, {}, event,
+        (cl_int)m, (cl_int)n, (cl_int)row_major,
+        c_buffer, (cl_ulong)c_offset, (cl_int)c_ld,
+        (cl_int)bias_mode,
+        (bias_mode==BiasNone) ? c_buffer : bias_buffer, (cl_ulong)bias_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const int activation,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmEpilogue<float>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta,
+            c_buffer, c_offset, c_ld,
+            bias_mode, bias_buffer, bias_offset,
+            activation,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const int activation,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmEpilogue<double>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta,
+            c_buffer, c_offset, c_ld,
+            bias_mode, bias_buffer, bias_offset,
+            activation,
+            queue, event);
+    });
+}
+}
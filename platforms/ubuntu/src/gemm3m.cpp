@@ -0,0 +1,188 @@
+#include "clkernels.h"
+
+//
+// Complex GEMM with the 3M (Gauss) algorithm.
+//
+//   P1 = Ar*Br,  P2 = Ai*Bi,  P3 = (Ar+Ai)*(Br+Bi)
+//   Re(A*B) = P1 - P2,  Im(A*B) = P3 - P1 - P2
+//
+// The planes of op(A) and op(B) are split into a workspace, the three
+// products are computed by the real GEMM of CLBlast, and the result is
+// merged into C with alpha and beta. It needs 3 real GEMMs instead of
+// 4 real multiplies per complex multiply-add, at the cost of a slightly
+// larger rounding error in the imaginary part.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const char *gemm3mSource = R"CLC(
+__kernel void split_planes(
+    const int rows, const int cols,
+    const int row_major, const int trans, const int conj,
+    __global const REAL *x, const ulong x_offset, const int x_ld,
+    __global REAL *w, const ulong re_offset, const ulong im_offset, const ulong sum_offset)
+{
+    const int c = get_global_id(0);
+    const int r = get_global_id(1);
+    if(r>=rows || c>=cols) {
+        return;
+    }
+    const int i = trans ? c : r;
+    const int j = trans ? r : c;
+    const ulong idx = x_offset + (row_major ? (ulong)i*x_ld+j : (ulong)j*x_ld+i);
+    const REAL vr = x[2*idx];
+    const REAL vi = conj ? -x[2*idx+1] : x[2*idx+1];
+    const ulong o = (ulong)r*cols+c;
+    w[re_offset+o]  = vr;
+    w[im_offset+o]  = vi;
+    w[sum_offset+o] = vr+vi;
+}
+
+__kernel void merge_3m(
+    const int m, const int n, const int row_major,
+    const REAL alpha_r, const REAL alpha_i,
+    const REAL beta_r, const REAL beta_i,
+    __global const REAL *w, const ulong p1_offset, const ulong p2_offset, const ulong p3_offset,
+    __global REAL *c, const ulong c_offset, const int c_ld)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(i>=m || j>=n) {
+        return;
+    }
+    const ulong t = (ulong)i*n+j;
+    const REAL p1 = w[p1_offset+t];
+    const REAL p2 = w[p2_offset+t];
+    const REAL p3 = w[p3_offset+t];
+    const REAL pr = p1 - p2;
+    const REAL pi = p3 - p1 - p2;
+    REAL rr = alpha_r*pr - alpha_i*pi;
+    REAL ri = alpha_r*pi + alpha_i*pr;
+    const ulong idx = c_offset + (row_major ? (ulong)i*c_ld+j : (ulong)j*c_ld+i);
+    if(beta_r!=0 || beta_i!=0) {
+        const REAL cr = c[2*idx];
+        const REAL ci = c[2*idx+1];
+        rr += beta_r*cr - beta_i*ci;
+        ri += beta_r*ci + beta_i*cr;
+    }
+    c[2*idx]   = rr;
+    c[2*idx+1] = ri;
+}
+)CLC";
+
+template <typename T>
+void Gemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+            const size_t m, const size_t n, const size_t k,
+            const T alpha_r, const T alpha_i,
+            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+            const T beta_r, const T beta_i,
+            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+            cl_command_queue* queue, cl_event* event)
+{
+    if(m==0 || n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const cl_int row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < LeadingDimension(row_major, a_transpose, m, k) ||
+       b_ld < LeadingDimension(row_major, b_transpose, k, n) ||
+       c_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, "Gemm3m: invalid leading dimension");
+    }
+
+    // workspace layout: Ar Ai Ar+Ai | Br Bi Br+Bi | P1 P2 P3
+    const size_t mk = m*k, kn = k*n, mn = m*n;
+    const size_t ar = 0, ai = mk, as = 2*mk;
+    const size_t br = 3*mk, bi = br+kn, bs = br+2*kn;
+    const size_t p1 = 3*mk+3*kn, p2 = p1+mn, p3 = p1+2*mn;
+    Workspace workspace(*queue, (3*mk+3*kn+3*mn)*sizeof(T));
+    cl_mem w = workspace.buffer();
+
+    const std::string source = Preamble(PrecisionOf<T>()) + gemm3mSource;
+    cl_kernel split = Kernel(*queue, source, "split_planes");
+    cl_kernel merge = Kernel(*queue, source, "merge_3m");
+
+    if(k>0) {
+        Launch(*queue, split, {k, m}, {}, nullptr,
+            (cl_int)m, (cl_int)k,
+            row_major, (cl_int)(a_transpose!=CLBlastTransposeNo), (cl_int)(a_transpose==CLBlastTransposeConjugate),
+            a_buffer, (cl_ulong)a_offset, (cl_int)a_ld,
+            w, (cl_ulong)ar, (cl_ulong)ai, (cl_ulong)as);
+        Launch(*queue, split, {n, k}, {}, nullptr,
+            (cl_int)k, (cl_int)n,
+            row_major, (cl_int)(b_transpose!=CLBlastTransposeNo), (cl_int)(b_transpose==CLBlastTransposeConjugate),
+            b_buffer, (cl_ulong)b_offset, (cl_int)b_ld,
+            w, (cl_ulong)br, (cl_ulong)bi, (cl_ulong)bs);
+    }
+
+    const ::clblast::Layout rm = ::clblast::Layout::kRowMajor;
+    const ::clblast::Transpose no = ::clblast::Transpose::kNo;
+    const size_t products[3][3] = {{ar,br,p1},{ai,bi,p2},{as,bs,p3}};
+    if(k==0) {
+        // products of empty matrices are zero
+        const T zero = 0;
+        CheckCL(clEnqueueFillBuffer(*queue, w, &zero, sizeof(T), p1*sizeof(T), 3*mn*sizeof(T),
+            0, nullptr, nullptr), "clEnqueueFillBuffer");
+    }
+    for(int i=0;i<3 && k>0;i++) {
+        Check(::clblast::Gemm<T>(rm, no, no, m, n, k,
+            T(1),
+            w, products[i][0], k,
+            w, products[i][1], n,
+            T(0),
+            w, products[i][2], n,
+            queue, nullptr), "Gemm");
+    }
+
+    Launch(*queue, merge, {n, m}, {}, event,
+        (cl_int)m, (cl_int)n, row_major,
+        alpha_r, alpha_i, beta_r, beta_i,
+        w, (cl_ulong)p1, (cl_ulong)p2, (cl_ulong)p3,
+        c_buffer, (cl_ulong)c_offset, (cl_int)c_ld);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastCgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_float2 *alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_float2 *beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Gemm3m<float>(layout, a_transpose, b_transpose, m, n, k,
+            alpha->s[0], alpha->s[1],
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta->s[0], beta->s[1],
+            c_buffer, c_offset, c_ld,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastZgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_double2 *alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_double2 *beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Gemm3m<double>(layout, a_transpose, b_transpose, m, n, k,
+            alpha->s[0], alpha->s[1],
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta->s[0], beta->s[1],
+            c_buffer, c_offset, c_ld,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,149 @@
+#include "clkernels.h"
+#include <map>
+#include <tuple>
+
+//
+// Grouped GEMM: a batch of GEMMs with their own shapes.
+// Problems with the same shape and leading dimensions are bucketed and
+// each bucket is issued as one GemmBatched, so a batch with a few
+// distinct shapes needs only a few launches. A problem with k = 0 is
+// C := beta*C, which GemmBatched rejects, and is done by "scale_c".
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const char *scaleSource = R"CLC(
+__kernel void scale_c(
+    const int rows, const int cols, const REAL beta,
+    __global REAL *c, const ulong c_offset, const int c_ld)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(i>=rows || j>=cols) {
+        return;
+    }
+    const ulong o = c_offset + (ulong)i*c_ld + j;
+    c[o] = (beta!=0) ? beta*c[o] : (REAL)0;
+}
+)CLC";
+
+typedef std::tuple<size_t,size_t,size_t,size_t,size_t,size_t> ShapeKey;
+
+template <typename T>
+struct Bucket {
+    std::vector<T> alphas;
+    std::vector<T> betas;
+    std::vector<size_t> a_offsets;
+    std::vector<size_t> b_offsets;
+    std::vector<size_t> c_offsets;
+};
+
+template <typename T>
+void GemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                 const size_t *m, const size_t *n, const size_t *k,
+                 const T *alphas,
+                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                 const T *betas,
+                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                 const size_t group_count,
+                 cl_command_queue* queue, cl_event* event)
+{
+    std::map<ShapeKey,Bucket<T>> buckets;
+    std::vector<size_t> scaled;
+    for(size_t i=0;i<group_count;i++) {
+        if(m[i]==0 || n[i]==0) {
+            continue;
+        }
+        if(k[i]==0) {
+            scaled.push_back(i);
+            continue;
+        }
+        Bucket<T> &bucket = buckets[ShapeKey(m[i],n[i],k[i],a_lds[i],b_lds[i],c_lds[i])];
+        bucket.alphas.push_back(alphas[i]);
+        bucket.betas.push_back(betas[i]);
+        bucket.a_offsets.push_back(a_offsets[i]);
+        bucket.b_offsets.push_back(b_offsets[i]);
+        bucket.c_offsets.push_back(c_offsets[i]);
+    }
+    if(buckets.empty() && scaled.empty()) {
+        Marker(*queue, event);
+        return;
+    }
+    size_t remaining = buckets.size() + scaled.size();
+    for(auto &entry : buckets) {
+        const ShapeKey &key = entry.first;
+        Bucket<T> &bucket = entry.second;
+        remaining--;
+        Check(::clblast::GemmBatched<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Transpose>(a_transpose),
+            static_cast<::clblast::Transpose>(b_transpose),
+            std::get<0>(key), std::get<1>(key), std::get<2>(key),
+            bucket.alphas.data(),
+            a_buffer, bucket.a_offsets.data(), std::get<3>(key),
+            b_buffer, bucket.b_offsets.data(), std::get<4>(key),
+            bucket.betas.data(),
+            c_buffer, bucket.c_offsets.data(), std::get<5>(key),
+            bucket.alphas.size(),
+            queue, (remaining==0) ? event : nullptr), "GemmBatched");
+    }
+    // walk C in its storage order: "rows" are the stored rows
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    for(const size_t i : scaled) {
+        remaining--;
+        const size_t rows = row_major ? m[i] : n[i];
+        const size_t cols = row_major ? n[i] : m[i];
+        Launch(*queue, Kernel(*queue, Preamble(PrecisionOf<T>()) + scaleSource, "scale_c"),
+            {cols, rows}, {}, (remaining==0) ? event : nullptr,
+            (cl_int)rows, (cl_int)cols, betas[i],
+            c_buffer, (cl_ulong)c_offsets[i], (cl_int)c_lds[i]);
+    }
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *m, const size_t *n, const size_t *k,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const float *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmGrouped<float>(layout, a_transpose, b_transpose, m, n, k,
+            alphas,
+            a_buffer, a_offsets, a_lds,
+            b_buffer, b_offsets, b_lds,
+            betas,
+            c_buffer, c_offsets, c_lds,
+            group_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *m, const size_t *n, const size_t *k,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const double *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmGrouped<double>(layout, a_transpose, b_transpose, m, n, k,
+            alphas,
+            a_buffer, a_offsets, a_lds,
+            b_buffer, b_offsets, b_lds,
+            betas,
+            c_buffer, c_offsets, c_lds,
+            group_count, queue, event);
+    });
+}
+}
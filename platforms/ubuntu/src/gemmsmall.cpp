@@ -0,0 +1,264 @@
+#include "clkernels.h"
+#include <algorithm>
+
+//
+// Strided batched GEMM with a kernel specialized for small matrices.
+//
+// When m, n and k are all at most "smallMax", a kernel compiled for the
+// exact shape, transposes and layout is used. Several matrices are
+// processed per work-group: each one is staged in local memory and every
+// work-item keeps a register tile of up to 4x4 elements of C.
+// Other shapes go to GemmStridedBatched of CLBlast. The operands of the
+// small kernel are checked as CLBlast checks them, with its status codes.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t smallMax = 32;
+const size_t localBudget = 16384;   // bytes of local memory per work-group
+const size_t groupBudget = 256;     // work-items per work-group
+
+const char *gemmSmallSource = R"CLC(
+// op(A)[i][l] and op(B)[l][j]
+#if ROW_MAJOR
+#define ELEM(x,off,ld,r,c) x[(off)+(ulong)(r)*(ld)+(c)]
+#else
+#define ELEM(x,off,ld,r,c) x[(off)+(ulong)(c)*(ld)+(r)]
+#endif
+#if TRANS_A
+#define OPA(i,l) ELEM(a,a_off,lda,l,i)
+#else
+#define OPA(i,l) ELEM(a,a_off,lda,i,l)
+#endif
+#if TRANS_B
+#define OPB(l,j) ELEM(b,b_off,ldb,j,l)
+#else
+#define OPB(l,j) ELEM(b,b_off,ldb,l,j)
+#endif
+#define THREADS (TM*TN)
+#define RM ((M+TM-1)/TM)
+#define RN ((N+TN-1)/TN)
+
+__kernel __attribute__((reqd_work_group_size(MPG*THREADS,1,1)))
+void gemm_small_batched(
+    const int batch_count,
+    const REAL alpha, const REAL beta,
+    __global const REAL *a, const ulong a_offset, const int lda, const ulong a_stride,
+    __global const REAL *b, const ulong b_offset, const int ldb, const ulong b_stride,
+    __global REAL *c, const ulong c_offset, const int ldc, const ulong c_stride)
+{
+    __local REAL la[MPG][M*K];
+    __local REAL lb[MPG][K*N];
+    const int lid = get_local_id(0);
+    const int slot = lid/THREADS;
+    const int t = lid%THREADS;
+    const int batch = get_group_id(0)*MPG + slot;
+
+    if(batch<batch_count) {
+        const ulong a_off = a_offset + batch*a_stride;
+        const ulong b_off = b_offset + batch*b_stride;
+        for(int idx=t; idx<M*K; idx+=THREADS) {
+            la[slot][idx] = OPA(idx/K, idx%K);
+        }
+        for(int idx=t; idx<K*N; idx+=THREADS) {
+            lb[slot][idx] = OPB(idx/N, idx%N);
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if(batch>=batch_count) {
+        return;
+    }
+
+    const int ti = t/TN;
+    const int tj = t%TN;
+    REAL acc[RM][RN];
+    #pragma unroll
+    for(int r=0; r<RM; r++) {
+        #pragma unroll
+        for(int s=0; s<RN; s++) {
+            acc[r][s] = 0;
+        }
+    }
+    #pragma unroll
+    for(int l=0; l<K; l++) {
+        REAL av[RM];
+        REAL bv[RN];
+        #pragma unroll
+        for(int r=0; r<RM; r++) {
+            const int i = ti+r*TM;
+            av[r] = (i<M) ? la[slot][i*K+l] : 0;
+        }
+        #pragma unroll
+        for(int s=0; s<RN; s++) {
+            const int j = tj+s*TN;
+            bv[s] = (j<N) ? lb[slot][l*N+j] : 0;
+        }
+        #pragma unroll
+        for(int r=0; r<RM; r++) {
+            #pragma unroll
+            for(int s=0; s<RN; s++) {
+                acc[r][s] += av[r]*bv[s];
+            }
+        }
+    }
+
+    const ulong c_off = c_offset + batch*c_stride;
+    #pragma unroll
+    for(int r=0; r<RM; r++) {
+        const int i = ti+r*TM;
+        #pragma unroll
+        for(int s=0; s<RN; s++) {
+            const int j = tj+s*TN;
+            if(i<M && j<N) {
+                REAL value = alpha*acc[r][s];
+                if(beta!=0) {
+                    value += beta*ELEM(c,c_off,ldc,i,j);
+                }
+                ELEM(c,c_off,ldc,i,j) = value;
+            }
+        }
+    }
+}
+)CLC";
+
+// Check a batch of matrices op(X) of rows x cols as GemmStridedBatched
+// of CLBlast does, with its status codes.
+void CheckMatrices(const char *operand, bool row_major, CLBlastTranspose trans,
+                   size_t rows, size_t cols, cl_mem buffer, size_t element_size,
+                   size_t offset, size_t ld, size_t stride, size_t batch_count,
+                   cl_int lead_dim_status, cl_int memory_status)
+{
+    if(ld < LeadingDimension(row_major, trans, rows, cols)) {
+        throw Error(lead_dim_status, std::string("GemmStridedBatched: invalid leading dimension of ")+operand);
+    }
+    // the stored matrix is "outer" vectors of "inner" elements, ld apart
+    const bool outer_rows = (row_major == (trans==CLBlastTransposeNo));
+    const size_t shape[] = {batch_count, outer_rows ? rows : cols, outer_rows ? cols : rows};
+    const cl_long strides[] = {(cl_long)stride, (cl_long)ld, 1};
+    CheckBuffer("GemmStridedBatched", operand, buffer, element_size, offset, 3, shape, strides,
+        memory_status);
+}
+
+struct SmallShape {
+    size_t tm, tn, mpg;
+};
+
+// Returns false when the small kernel does not fit the shape or device.
+template <typename T>
+bool SelectSmall(cl_command_queue queue, size_t m, size_t n, size_t k, SmallShape &shape)
+{
+    if(m>smallMax || n>smallMax || k>smallMax) {
+        return false;
+    }
+    shape.tm = std::min<size_t>(m, 8);
+    shape.tn = std::min<size_t>(n, 8);
+    const size_t threads = shape.tm*shape.tn;
+    const size_t bytes = (m*k + k*n)*sizeof(T);
+    const size_t max_group = std::min(groupBudget, MaxWorkGroupSize(queue));
+    if(threads>max_group || bytes>localBudget) {
+        return false;
+    }
+    shape.mpg = std::max<size_t>(1, std::min(max_group/threads, localBudget/bytes));
+    return true;
+}
+
+template <typename T>
+void GemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event)
+{
+    SmallShape shape;
+    if(m==0 || n==0 || k==0 || batch_count==0 || !SelectSmall<T>(*queue, m, n, k, shape)) {
+        Check(::clblast::GemmStridedBatched<T>(
+            static_cast<::clblast::Layout>(layout),
+            static_cast<::clblast::Transpose>(a_transpose),
+            static_cast<::clblast::Transpose>(b_transpose),
+            m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            beta,
+            c_buffer, c_offset, c_ld, c_stride,
+            batch_count,
+            queue, event), "GemmStridedBatched");
+        return;
+    }
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    CheckMatrices("a", row_major, a_transpose, m, k, a_buffer, sizeof(T), a_offset, a_ld, a_stride,
+        batch_count, CLBlastInvalidLeadDimA, CLBlastInsufficientMemoryA);
+    CheckMatrices("b", row_major, b_transpose, k, n, b_buffer, sizeof(T), b_offset, b_ld, b_stride,
+        batch_count, CLBlastInvalidLeadDimB, CLBlastInsufficientMemoryB);
+    CheckMatrices("c", row_major, CLBlastTransposeNo, m, n, c_buffer, sizeof(T), c_offset, c_ld, c_stride,
+        batch_count, CLBlastInvalidLeadDimC, CLBlastInsufficientMemoryC);
+    const std::string source = Preamble(PrecisionOf<T>()) +
+        "#define M " + std::to_string(m) + "\n" +
+        "#define N " + std::to_string(n) + "\n" +
+        "#define K " + std::to_string(k) + "\n" +
+        "#define TM " + std::to_string(shape.tm) + "\n" +
+        "#define TN " + std::to_string(shape.tn) + "\n" +
+        "#define MPG " + std::to_string(shape.mpg) + "\n" +
+        "#define ROW_MAJOR " + (row_major ? "1" : "0") + "\n" +
+        "#define TRANS_A " + (a_transpose!=CLBlastTransposeNo ? "1" : "0") + "\n" +
+        "#define TRANS_B " + (b_transpose!=CLBlastTransposeNo ? "1" : "0") + "\n" +
+        gemmSmallSource;
+    const size_t local = shape.mpg*shape.tm*shape.tn;
+    const size_t groups = CeilDiv(batch_count, shape.mpg);
+    Launch(*queue, Kernel(*queue, source, "gemm_small_batched"), {groups*local}, {local}, event,
+        (cl_int)batch_count,
+        alpha, beta,
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+        b_buffer, (cl_ulong)b_offset, (cl_int)b_ld, (cl_ulong)b_stride,
+        c_buffer, (cl_ulong)c_offset, (cl_int)c_ld, (cl_ulong)c_stride);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmStridedBatched<float>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            beta,
+            c_buffer, c_offset, c_ld, c_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmStridedBatched<double>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            beta,
+            c_buffer, c_offset, c_ld, c_stride,
+            batch_count, queue, event);
+    });
+}
+}
@@ -0,0 +1,235 @@
+#include "clkernels.h"
+
+//
+// im2col and col2im of a batch of images with independent pad, stride
+// and dilation for the height and the width.
+//
+// The layouts are those of Im2col and Col2im of CLBlast:
+//   im   [batch][channels][height][width]
+//   col  [batch][channels][kernel_h][kernel_w][output_h][output_w]
+// where the kernel position is reversed for the convolution mode.
+// col2im adds to im. Both arrays are checked against their buffers.
+//
+// col2im gathers the contributions of each pixel of im instead of
+// scattering the columns, so no atomics are needed.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const char *im2colSource = R"CLC(
+__kernel void im2col_batched(
+    const ulong total, const int convolution,
+    const int channels, const int height, const int width,
+    const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w,
+    const int dilation_h, const int dilation_w,
+    const int output_h, const int output_w,
+    __global const REAL *im, const ulong im_offset,
+    __global REAL *col, const ulong col_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    ulong rest = gid;
+    const int ow = rest % output_w; rest /= output_w;
+    const int oh = rest % output_h; rest /= output_h;
+    const int kw = rest % kernel_w; rest /= kernel_w;
+    const int kh = rest % kernel_h; rest /= kernel_h;
+    const int c = rest % channels;
+    const ulong b = rest / channels;
+
+    const int y = oh*stride_h - pad_h + kh*dilation_h;
+    const int x = ow*stride_w - pad_w + kw*dilation_w;
+    REAL value = 0;
+    if(y>=0 && y<height && x>=0 && x<width) {
+        value = im[im_offset + ((b*channels + c)*height + y)*width + x];
+    }
+    const int kernels = kernel_h*kernel_w;
+    const int kernel_index = convolution ? kernels-1-(kh*kernel_w+kw) : kh*kernel_w+kw;
+    col[col_offset + (((b*channels + c)*kernels + kernel_index)*output_h + oh)*output_w + ow] = value;
+}
+
+__kernel void col2im_batched(
+    const ulong total, const int convolution,
+    const int channels, const int height, const int width,
+    const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w,
+    const int dilation_h, const int dilation_w,
+    const int output_h, const int output_w,
+    __global const REAL *col, const ulong col_offset,
+    __global REAL *im, const ulong im_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    ulong rest = gid;
+    const int x = rest % width; rest /= width;
+    const int y = rest % height; rest /= height;
+    const int c = rest % channels;
+    const ulong b = rest / channels;
+
+    const int kernels = kernel_h*kernel_w;
+    const ulong base = col_offset + (b*channels + c)*kernels*output_h*output_w;
+    REAL value = 0;
+    for(int kh=0; kh<kernel_h; kh++) {
+        const int ty = y + pad_h - kh*dilation_h;
+        if(ty<0 || ty%stride_h!=0 || ty/stride_h>=output_h) {
+            continue;
+        }
+        const int oh = ty/stride_h;
+        for(int kw=0; kw<kernel_w; kw++) {
+            const int tx = x + pad_w - kw*dilation_w;
+            if(tx<0 || tx%stride_w!=0 || tx/stride_w>=output_w) {
+                continue;
+            }
+            const int ow = tx/stride_w;
+            const int kernel_index = convolution ? kernels-1-(kh*kernel_w+kw) : kh*kernel_w+kw;
+            value += col[base + ((ulong)kernel_index*output_h + oh)*output_w + ow];
+        }
+    }
+    im[im_offset + gid] += value;
+}
+)CLC";
+
+struct ConvShape {
+    size_t output_h, output_w;
+};
+
+ConvShape OutputShape(const size_t height, const size_t width,
+                      const size_t kernel_h, const size_t kernel_w,
+                      const size_t pad_h, const size_t pad_w,
+                      const size_t stride_h, const size_t stride_w,
+                      const size_t dilation_h, const size_t dilation_w)
+{
+    if(kernel_h==0 || kernel_w==0 || stride_h==0 || stride_w==0 || dilation_h==0 || dilation_w==0) {
+        throw Error(CL_INVALID_VALUE, "Im2col: kernel, stride and dilation must be greater than zero");
+    }
+    const size_t span_h = dilation_h*(kernel_h-1)+1;
+    const size_t span_w = dilation_w*(kernel_w-1)+1;
+    if(height+2*pad_h < span_h || width+2*pad_w < span_w) {
+        return {0, 0};
+    }
+    return {(height+2*pad_h-span_h)/stride_h+1, (width+2*pad_w-span_w)/stride_w+1};
+}
+
+template <typename T>
+void Im2colBatched(const bool to_col, const CLBlastKernelMode kernel_mode,
+                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                   const size_t kernel_h, const size_t kernel_w,
+                   const size_t pad_h, const size_t pad_w,
+                   const size_t stride_h, const size_t stride_w,
+                   const size_t dilation_h, const size_t dilation_w,
+                   const cl_mem src_buffer, const size_t src_offset,
+                   cl_mem dst_buffer, const size_t dst_offset,
+                   cl_command_queue* queue, cl_event* event)
+{
+    const ConvShape out = OutputShape(height, width, kernel_h, kernel_w,
+        pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w);
+    const size_t total = to_col ?
+        batch_count*channels*kernel_h*kernel_w*out.output_h*out.output_w :
+        batch_count*channels*height*width;
+    if(total==0 || out.output_h==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t im_size = batch_count*channels*height*width;
+    const size_t col_size = batch_count*channels*kernel_h*kernel_w*out.output_h*out.output_w;
+    if(to_col) {
+        CheckArray("Im2colBatched", "im", src_buffer, sizeof(T), src_offset, im_size);
+        CheckArray("Im2colBatched", "col", dst_buffer, sizeof(T), dst_offset, col_size);
+    } else {
+        CheckArray("Col2imBatched", "col", src_buffer, sizeof(T), src_offset, col_size);
+        CheckArray("Col2imBatched", "im", dst_buffer, sizeof(T), dst_offset, im_size);
+    }
+    const std::string source = Preamble(PrecisionOf<T>()) + im2colSource;
+    Launch(*queue, Kernel(*queue, source, to_col ? "im2col_batched" : "col2im_batched"),
+        {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total, (cl_int)(kernel_mode==CLBlastKernelModeConvolution),
+        (cl_int)channels, (cl_int)height, (cl_int)width,
+        (cl_int)kernel_h, (cl_int)kernel_w,
+        (cl_int)pad_h, (cl_int)pad_w,
+        (cl_int)stride_h, (cl_int)stride_w,
+        (cl_int)dilation_h, (cl_int)dilation_w,
+        (cl_int)out.output_h, (cl_int)out.output_w,
+        src_buffer, (cl_ulong)src_offset,
+        dst_buffer, (cl_ulong)dst_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSim2colBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                   cl_mem col_buffer, const size_t col_offset,
+                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Im2colBatched<float>(true, kernel_mode, batch_count, channels, height, width,
+            kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+            im_buffer, im_offset, col_buffer, col_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDim2colBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                   cl_mem col_buffer, const size_t col_offset,
+                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Im2colBatched<double>(true, kernel_mode, batch_count, channels, height, width,
+            kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+            im_buffer, im_offset, col_buffer, col_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastScol2imBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem col_buffer, const size_t col_offset,
+                                                   cl_mem im_buffer, const size_t im_offset,
+                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Im2colBatched<float>(false, kernel_mode, batch_count, channels, height, width,
+            kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+            col_buffer, col_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDcol2imBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem col_buffer, const size_t col_offset,
+                                                   cl_mem im_buffer, const size_t im_offset,
+                                                   cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Im2colBatched<double>(false, kernel_mode, batch_count, channels, height, width,
+            kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+            col_buffer, col_offset, im_buffer, im_offset,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,783 @@
+// Routines of librindowclblast that run their own kernels.
+// This file is loaded together with complexfuncs.h, which declares the types.
+
+CLBlastStatusCode RindowCLBlastSgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const size_t depth,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const size_t depth,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *m, const size_t *n, const size_t *k,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const float *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *m, const size_t *n, const size_t *k,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const double *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSscalDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDscalDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSaxpyDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDaxpyDeviceScalar(const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemvDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                      const size_t m, const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemvDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                      const size_t m, const size_t n,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemmDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemmDeviceScalar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k,
+                                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSsolve(const size_t method, const CLBlastLayout layout, const size_t n,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset,
+                                           cl_mem x_buffer, const size_t x_offset,
+                                           const float tol, const size_t max_iterations, const size_t check_interval,
+                                           size_t *iterations, float *residual,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDsolve(const size_t method, const CLBlastLayout layout, const size_t n,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset,
+                                           cl_mem x_buffer, const size_t x_offset,
+                                           const double tol, const size_t max_iterations, const size_t check_interval,
+                                           size_t *iterations, double *residual,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgetrfBatched(const CLBlastLayout layout, const size_t n,
+                                                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem info_buffer, const size_t info_offset,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgetrfBatched(const CLBlastLayout layout, const size_t n,
+                                                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem info_buffer, const size_t info_offset,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgetrsBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t n, const size_t nrhs,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgetrsBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t n, const size_t nrhs,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastStrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const float beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const double beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSreduce(const int op,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem a_buffer, const size_t a_offset,
+                                            cl_mem b_buffer, const size_t b_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDreduce(const int op,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem a_buffer, const size_t a_offset,
+                                            cl_mem b_buffer, const size_t b_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSreduceStats(const size_t m, const size_t n, const size_t k,
+                                                 const cl_mem a_buffer, const size_t a_offset,
+                                                 cl_mem b_buffer, const size_t b_offset,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDreduceStats(const size_t m, const size_t n, const size_t k,
+                                                 const cl_mem a_buffer, const size_t a_offset,
+                                                 cl_mem b_buffer, const size_t b_offset,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const float alpha, const float beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const float alpha, const float beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDunary(const int op,
+                                           const size_t rank, const size_t *shape,
+                                           const double alpha, const double beta,
+                                           const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDbinary(const int op,
+                                            const size_t rank, const size_t *shape,
+                                            const cl_mem a_buffer, const size_t a_offset, const cl_long *a_strides,
+                                            const cl_mem b_buffer, const size_t b_offset, const cl_long *b_strides,
+                                            cl_mem c_buffer, const size_t c_offset, const cl_long *c_strides,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const float *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const float *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDfused(const char *expression,
+                                           const size_t rank, const size_t *shape,
+                                           const size_t inputs,
+                                           const cl_mem *x_buffers, const size_t *x_offsets, const cl_long *x_strides,
+                                           const size_t scalar_count, const double *scalars,
+                                           cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const int activation,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const int activation,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSim2colBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                   cl_mem col_buffer, const size_t col_offset,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDim2colBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem im_buffer, const size_t im_offset,
+                                                   cl_mem col_buffer, const size_t col_offset,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastScol2imBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem col_buffer, const size_t col_offset,
+                                                   cl_mem im_buffer, const size_t im_offset,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDcol2imBatched(const CLBlastKernelMode kernel_mode,
+                                                   const size_t batch_count, const size_t channels, const size_t height, const size_t width,
+                                                   const size_t kernel_h, const size_t kernel_w,
+                                                   const size_t pad_h, const size_t pad_w,
+                                                   const size_t stride_h, const size_t stride_w,
+                                                   const size_t dilation_h, const size_t dilation_w,
+                                                   const cl_mem col_buffer, const size_t col_offset,
+                                                   cl_mem im_buffer, const size_t im_offset,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmNd(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmNd(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmNdBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmNdBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmNdBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmNdBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSwinogradFilter(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                    const size_t channels, const size_t num_kernels,
+                                                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                    cl_mem transformed_buffer, const size_t transformed_offset,
+                                                    cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDwinogradFilter(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                    const size_t channels, const size_t num_kernels,
+                                                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                    cl_mem transformed_buffer, const size_t transformed_offset,
+                                                    cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmWinograd(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                      const size_t channels, const size_t height, const size_t width,
+                                                      const size_t pad_h, const size_t pad_w,
+                                                      const size_t num_kernels, const size_t batch_count,
+                                                      const cl_mem im_buffer, const size_t im_offset,
+                                                      const cl_mem kernel_buffer, const size_t kernel_offset, const int kernel_transformed,
+                                                      cl_mem result_buffer, const size_t result_offset,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmWinograd(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                      const size_t channels, const size_t height, const size_t width,
+                                                      const size_t pad_h, const size_t pad_w,
+                                                      const size_t num_kernels, const size_t batch_count,
+                                                      const cl_mem im_buffer, const size_t im_offset,
+                                                      const cl_mem kernel_buffer, const size_t kernel_offset, const int kernel_transformed,
+                                                      cl_mem result_buffer, const size_t result_offset,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmGrouped(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmGrouped(const CLBlastKernelMode kernel_mode,
+                                                const size_t rank, const size_t channels, const size_t *input_shape,
+                                                const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                const cl_mem im_buffer, const size_t im_offset,
+                                                const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmGroupedBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmGroupedBackwardData(const CLBlastKernelMode kernel_mode,
+                                                            const size_t rank, const size_t channels, const size_t *input_shape,
+                                                            const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                            const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                            const cl_mem result_buffer, const size_t result_offset,
+                                                            const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                            cl_mem im_buffer, const size_t im_offset,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSconvgemmGroupedBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDconvgemmGroupedBackwardFilter(const CLBlastKernelMode kernel_mode,
+                                                              const size_t rank, const size_t channels, const size_t *input_shape,
+                                                              const size_t *kernel_shape, const size_t *pads, const size_t *strides, const size_t *dilations,
+                                                              const size_t num_kernels, const size_t groups, const size_t batch_count,
+                                                              const cl_mem im_buffer, const size_t im_offset,
+                                                              const cl_mem result_buffer, const size_t result_offset,
+                                                              cl_mem kernel_buffer, const size_t kernel_offset,
+                                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSpool2d(const int mode, const size_t batch_count, const size_t channels,
+                                            const size_t height, const size_t width,
+                                            const size_t pool_h, const size_t pool_w,
+                                            const size_t pad_h, const size_t pad_w,
+                                            const size_t stride_h, const size_t stride_w,
+                                            const cl_mem x_buffer, const size_t x_offset,
+                                            cl_mem y_buffer, const size_t y_offset,
+                                            cl_mem indices_buffer, const size_t indices_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDpool2d(const int mode, const size_t batch_count, const size_t channels,
+                                            const size_t height, const size_t width,
+                                            const size_t pool_h, const size_t pool_w,
+                                            const size_t pad_h, const size_t pad_w,
+                                            const size_t stride_h, const size_t stride_w,
+                                            const cl_mem x_buffer, const size_t x_offset,
+                                            cl_mem y_buffer, const size_t y_offset,
+                                            cl_mem indices_buffer, const size_t indices_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSpool2dBackward(const int mode, const size_t batch_count, const size_t channels,
+                                                    const size_t height, const size_t width,
+                                                    const size_t pool_h, const size_t pool_w,
+                                                    const size_t pad_h, const size_t pad_w,
+                                                    const size_t stride_h, const size_t stride_w,
+                                                    const cl_mem dy_buffer, const size_t dy_offset,
+                                                    const cl_mem indices_buffer, const size_t indices_offset,
+                                                    cl_mem dx_buffer, const size_t dx_offset,
+                                                    cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDpool2dBackward(const int mode, const size_t batch_count, const size_t channels,
+                                                    const size_t height, const size_t width,
+                                                    const size_t pool_h, const size_t pool_w,
+                                                    const size_t pad_h, const size_t pad_w,
+                                                    const size_t stride_h, const size_t stride_w,
+                                                    const cl_mem dy_buffer, const size_t dy_offset,
+                                                    const cl_mem indices_buffer, const size_t indices_offset,
+                                                    cl_mem dx_buffer, const size_t dx_offset,
+                                                    cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSglobalPool2d(const int mode, const size_t batch_count, const size_t channels,
+                                                  const size_t height, const size_t width,
+                                                  const cl_mem x_buffer, const size_t x_offset,
+                                                  cl_mem y_buffer, const size_t y_offset,
+                                                  cl_mem indices_buffer, const size_t indices_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDglobalPool2d(const int mode, const size_t batch_count, const size_t channels,
+                                                  const size_t height, const size_t width,
+                                                  const cl_mem x_buffer, const size_t x_offset,
+                                                  cl_mem y_buffer, const size_t y_offset,
+                                                  cl_mem indices_buffer, const size_t indices_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float epsilon, const float momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float epsilon, const float momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const double epsilon, const double momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const float epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const float epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const double epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const float scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const float scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDattention(const int causal,
+                                               const size_t batch_count, const size_t heads,
+                                               const size_t seq_q, const size_t seq_k,
+                                               const size_t head_dim, const size_t value_dim,
+                                               const double scale,
+                                               const cl_mem q_buffer, const size_t q_offset, const size_t q_ld,
+                                               const size_t q_stride_batch, const size_t q_stride_head,
+                                               const cl_mem k_buffer, const size_t k_offset, const size_t k_ld,
+                                               const size_t k_stride_batch, const size_t k_stride_head,
+                                               const cl_mem v_buffer, const size_t v_offset, const size_t v_ld,
+                                               const size_t v_stride_batch, const size_t v_stride_head,
+                                               cl_mem o_buffer, const size_t o_offset, const size_t o_ld,
+                                               const size_t o_stride_batch, const size_t o_stride_head,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastHpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n, const float alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n, const double alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastSomatcopyBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                     const size_t m, const size_t n, const float *alphas,
+                                                     const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                     cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                     const size_t batch_count,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDomatcopyBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                     const size_t m, const size_t n, const double *alphas,
+                                                     const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                     cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                     const size_t batch_count,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastStransposeInPlace(const size_t n, const float alpha,
+                                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                      const size_t batch_count,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode RindowCLBlastDtransposeInPlace(const size_t n, const double alpha,
+                                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                      const size_t batch_count,
+                                                      cl_command_queue* queue, cl_event* event);
@@ -0,0 +1,522 @@
+#include "clkernels.h"
+#include <algorithm>
+
+//
+// LU factorization with partial pivoting and the solve with its factors.
+//
+//   getrf  P*A = L*U  (L unit lower, U upper, both stored in A)
+//   getrs  A*X = B or A^T*X = B with the factors of getrf
+//
+// getrf is blocked and right-looking. A panel of "blockSize" columns is
+// factorized by one work-group (pivot search, row swap, scaling and the
+// rank-1 updates inside the panel), the interchanges are applied to the
+// other columns by a row-swap kernel, and the rest is updated by CLBlast
+// Trsm and Gemm.
+//
+// The batched routines factorize and solve many small square systems,
+// one work-group per matrix for getrf and one work-item per right hand
+// side for getrs.
+//
+// ipiv (int32) receives the 1-based row interchanged with row i, as in
+// LAPACK. info (int32) receives 0, or i+1 when U(i,i) is exactly zero.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t blockSize = 32;
+
+const char *luSource = R"CLC(
+#define AT(i,j) (a_offset + (row_major ? (ulong)(i)*lda+(j) : (ulong)(j)*lda+(i)))
+
+// Unblocked LU of an m x n panel by one work-group (one panel per group).
+// "base" is the row of the panel in the whole matrix.
+__kernel void getf2_panel(
+    const int m, const int n, const int row_major,
+    __global REAL *a, ulong a_offset, const int lda, const ulong a_stride,
+    __global int *ipiv, ulong ipiv_offset, const ulong ipiv_stride,
+    __global int *info, ulong info_offset,
+    const int base,
+    __local REAL *lval, __local int *lidx)
+{
+    const int lid = get_local_id(0);
+    const int lsz = get_local_size(0);
+    const int batch = get_group_id(0);
+    a_offset += batch*a_stride;
+    ipiv_offset += batch*ipiv_stride;
+    info_offset += batch;
+
+    const int steps = min(m,n);
+    for(int j=0; j<steps; j++) {
+        // pivot search
+        REAL best = -1;
+        int best_i = j;
+        for(int i=j+lid; i<m; i+=lsz) {
+            const REAL v = fabs(a[AT(i,j)]);
+            if(v>best) {
+                best = v;
+                best_i = i;
+            }
+        }
+        lval[lid] = best;
+        lidx[lid] = best_i;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for(int s=lsz/2; s>0; s>>=1) {
+            if(lid<s) {
+                if(lval[lid+s]>lval[lid] ||
+                    (lval[lid+s]==lval[lid] && lidx[lid+s]<lidx[lid])) {
+                    lval[lid] = lval[lid+s];
+                    lidx[lid] = lidx[lid+s];
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+        const int p = lidx[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if(lid==0) {
+            ipiv[ipiv_offset+base+j] = base+p+1;
+        }
+
+        // row interchange inside the panel
+        if(p!=j) {
+            for(int c=lid; c<n; c+=lsz) {
+                const REAL t = a[AT(j,c)];
+                a[AT(j,c)] = a[AT(p,c)];
+                a[AT(p,c)] = t;
+            }
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        // scale the column below the pivot
+        const REAL pivot = a[AT(j,j)];
+        if(pivot==0) {
+            if(lid==0) {
+                atomic_cmpxchg(&info[info_offset], 0, base+j+1);
+            }
+        } else {
+            for(int i=j+1+lid; i<m; i+=lsz) {
+                a[AT(i,j)] /= pivot;
+            }
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        // rank-1 update of the rest of the panel
+        const int rows = m-j-1;
+        const int cols = n-j-1;
+        for(int idx=lid; idx<rows*cols; idx+=lsz) {
+            const int i = j+1+idx/cols;
+            const int c = j+1+idx%cols;
+            a[AT(i,c)] -= a[AT(i,j)]*a[AT(j,c)];
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+    }
+}
+
+// Apply the interchanges of rows k1..k2-1 to "ncols" columns from "col".
+// Forward when reverse==0, backward otherwise.
+__kernel void laswp(
+    const int ncols, const int col, const int row_major,
+    __global REAL *a, const ulong a_offset, const int lda,
+    __global const int *ipiv, const ulong ipiv_offset,
+    const int k1, const int k2, const int reverse)
+{
+    const int c = get_global_id(0);
+    if(c>=ncols) {
+        return;
+    }
+    const int j = col+c;
+    for(int step=0; step<k2-k1; step++) {
+        const int i = reverse ? k2-1-step : k1+step;
+        const int p = ipiv[ipiv_offset+i]-1;
+        if(p!=i) {
+            const REAL t = a[AT(i,j)];
+            a[AT(i,j)] = a[AT(p,j)];
+            a[AT(p,j)] = t;
+        }
+    }
+}
+
+// One right hand side of one system per work-item.
+__kernel void getrs_batched(
+    const int n, const int nrhs, const int row_major, const int trans,
+    __global const REAL *a, ulong a_offset, const int lda, const ulong a_stride,
+    __global const int *ipiv, ulong ipiv_offset, const ulong ipiv_stride,
+    __global REAL *b, ulong b_offset, const int ldb, const ulong b_stride)
+{
+    const int r = get_global_id(0);
+    const int batch = get_global_id(1);
+    if(r>=nrhs) {
+        return;
+    }
+    a_offset += batch*a_stride;
+    ipiv_offset += batch*ipiv_stride;
+    b_offset += batch*b_stride;
+    #define BT(i) b[b_offset + (row_major ? (ulong)(i)*ldb+r : (ulong)r*ldb+(i))]
+
+    if(!trans) {
+        for(int i=0; i<n; i++) {
+            const int p = ipiv[ipiv_offset+i]-1;
+            if(p!=i) {
+                const REAL t = BT(i); BT(i) = BT(p); BT(p) = t;
+            }
+        }
+        for(int i=0; i<n; i++) {
+            REAL s = BT(i);
+            for(int c=0; c<i; c++) {
+                s -= a[AT(i,c)]*BT(c);
+            }
+            BT(i) = s;
+        }
+        for(int i=n-1; i>=0; i--) {
+            REAL s = BT(i);
+            for(int c=i+1; c<n; c++) {
+                s -= a[AT(i,c)]*BT(c);
+            }
+            BT(i) = s/a[AT(i,i)];
+        }
+    } else {
+        for(int i=0; i<n; i++) {
+            REAL s = BT(i);
+            for(int c=0; c<i; c++) {
+                s -= a[AT(c,i)]*BT(c);
+            }
+            BT(i) = s/a[AT(i,i)];
+        }
+        for(int i=n-1; i>=0; i--) {
+            REAL s = BT(i);
+            for(int c=i+1; c<n; c++) {
+                s -= a[AT(c,i)]*BT(c);
+            }
+            BT(i) = s;
+        }
+        for(int i=n-1; i>=0; i--) {
+            const int p = ipiv[ipiv_offset+i]-1;
+            if(p!=i) {
+                const REAL t = BT(i); BT(i) = BT(p); BT(p) = t;
+            }
+        }
+    }
+    #undef BT
+}
+)CLC";
+
+template <typename T>
+std::string Source()
+{
+    return Preamble(PrecisionOf<T>()) + luSource;
+}
+
+// work-group size of the panel kernel (a power of two for the reduction)
+size_t PanelGroupSize(cl_command_queue queue)
+{
+    const size_t limit = std::min<size_t>(256, MaxWorkGroupSize(queue));
+    size_t size = 1;
+    while(size*2<=limit) {
+        size *= 2;
+    }
+    return size;
+}
+
+void ClearInfo(cl_command_queue queue, cl_mem info_buffer, size_t info_offset, size_t count, cl_event *event)
+{
+    const cl_int zero = 0;
+    CheckCL(clEnqueueFillBuffer(queue, info_buffer, &zero, sizeof(cl_int), info_offset*sizeof(cl_int), count*sizeof(cl_int),
+        0, nullptr, event), "clEnqueueFillBuffer");
+}
+
+template <typename T>
+void Laswp(cl_command_queue queue, const bool row_major,
+           const size_t ncols, const size_t col,
+           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+           const size_t k1, const size_t k2, const bool reverse,
+           cl_event *event)
+{
+    Launch(queue, Kernel(queue, Source<T>(), "laswp"), {ncols}, {}, event,
+        (cl_int)ncols, (cl_int)col, (cl_int)row_major,
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld,
+        ipiv_buffer, (cl_ulong)ipiv_offset,
+        (cl_int)k1, (cl_int)k2, (cl_int)reverse);
+}
+
+template <typename T>
+void Getrf(const CLBlastLayout layout, const size_t m, const size_t n,
+           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           cl_mem ipiv_buffer, const size_t ipiv_offset,
+           cl_mem info_buffer, const size_t info_offset,
+           cl_command_queue* queue, cl_event* event)
+{
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, "Getrf: invalid leading dimension");
+    }
+    const size_t steps = std::min(m, n);
+    if(steps==0) {
+        ClearInfo(*queue, info_buffer, info_offset, 1, event);
+        return;
+    }
+    ClearInfo(*queue, info_buffer, info_offset, 1, nullptr);
+
+    const ::clblast::Layout lay = static_cast<::clblast::Layout>(layout);
+    auto at = [&](size_t i, size_t j) {
+        return a_offset + (row_major ? i*a_ld+j : j*a_ld+i);
+    };
+    cl_kernel panel = Kernel(*queue, Source<T>(), "getf2_panel");
+    const size_t local = PanelGroupSize(*queue);
+
+    for(size_t k=0; k<steps; k+=blockSize) {
+        const size_t kb = std::min(blockSize, steps-k);
+        const size_t right = n-k-kb;
+        const size_t below = m-k-kb;
+        Launch(*queue, panel, {local}, {local}, nullptr,
+            (cl_int)(m-k), (cl_int)kb, (cl_int)row_major,
+            a_buffer, (cl_ulong)at(k,k), (cl_int)a_ld, (cl_ulong)0,
+            ipiv_buffer, (cl_ulong)ipiv_offset, (cl_ulong)0,
+            info_buffer, (cl_ulong)info_offset,
+            (cl_int)k,
+            LocalMemory{local*sizeof(T)}, LocalMemory{local*sizeof(cl_int)});
+        // apply the interchanges of the panel to the other columns
+        if(k>0) {
+            Laswp<T>(*queue, row_major, k, 0, a_buffer, a_offset, a_ld,
+                ipiv_buffer, ipiv_offset, k, k+kb, false, nullptr);
+        }
+        if(right==0) {
+            continue;
+        }
+        Laswp<T>(*queue, row_major, right, k+kb, a_buffer, a_offset, a_ld,
+            ipiv_buffer, ipiv_offset, k, k+kb, false, nullptr);
+        // A12 := L11^-1 * A12
+        Check(::clblast::Trsm<T>(lay,
+            ::clblast::Side::kLeft, ::clblast::Triangle::kLower,
+            ::clblast::Transpose::kNo, ::clblast::Diagonal::kUnit,
+            kb, right, T(1),
+            a_buffer, at(k,k), a_ld,
+            a_buffer, at(k,k+kb), a_ld,
+            queue, nullptr), "Trsm");
+        if(below==0) {
+            continue;
+        }
+        // A22 := A22 - A21 * A12
+        Check(::clblast::Gemm<T>(lay,
+            ::clblast::Transpose::kNo, ::clblast::Transpose::kNo,
+            below, right, kb,
+            T(-1),
+            a_buffer, at(k+kb,k), a_ld,
+            a_buffer, at(k,k+kb), a_ld,
+            T(1),
+            a_buffer, at(k+kb,k+kb), a_ld,
+            queue, nullptr), "Gemm");
+    }
+    Marker(*queue, event);
+}
+
+template <typename T>
+void Getrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+           const size_t n, const size_t nrhs,
+           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+           cl_command_queue* queue, cl_event* event)
+{
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < n || b_ld < LeadingDimension(row_major, CLBlastTransposeNo, n, nrhs)) {
+        throw Error(CL_INVALID_VALUE, "Getrs: invalid leading dimension");
+    }
+    if(n==0 || nrhs==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const ::clblast::Layout lay = static_cast<::clblast::Layout>(layout);
+    const ::clblast::Side left = ::clblast::Side::kLeft;
+    const ::clblast::Triangle lower = ::clblast::Triangle::kLower;
+    const ::clblast::Triangle upper = ::clblast::Triangle::kUpper;
+    const ::clblast::Diagonal unit = ::clblast::Diagonal::kUnit;
+    const ::clblast::Diagonal nonunit = ::clblast::Diagonal::kNonUnit;
+    if(a_transpose==CLBlastTransposeNo) {
+        // L*U*X = P*B
+        Laswp<T>(*queue, row_major, nrhs, 0, b_buffer, b_offset, b_ld,
+            ipiv_buffer, ipiv_offset, 0, n, false, nullptr);
+        Check(::clblast::Trsm<T>(lay, left, lower, ::clblast::Transpose::kNo, unit,
+            n, nrhs, T(1), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            queue, nullptr), "Trsm");
+        Check(::clblast::Trsm<T>(lay, left, upper, ::clblast::Transpose::kNo, nonunit,
+            n, nrhs, T(1), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            queue, event), "Trsm");
+    } else {
+        // U^T*L^T*(P*X) = B
+        Check(::clblast::Trsm<T>(lay, left, upper, ::clblast::Transpose::kYes, nonunit,
+            n, nrhs, T(1), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            queue, nullptr), "Trsm");
+        Check(::clblast::Trsm<T>(lay, left, lower, ::clblast::Transpose::kYes, unit,
+            n, nrhs, T(1), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            queue, nullptr), "Trsm");
+        Laswp<T>(*queue, row_major, nrhs, 0, b_buffer, b_offset, b_ld,
+            ipiv_buffer, ipiv_offset, 0, n, true, event);
+    }
+}
+
+template <typename T>
+void GetrfBatched(const CLBlastLayout layout, const size_t n,
+                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                  cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                  cl_mem info_buffer, const size_t info_offset,
+                  const size_t batch_count,
+                  cl_command_queue* queue, cl_event* event)
+{
+    if(a_ld < n || ipiv_stride < n) {
+        throw Error(CL_INVALID_VALUE, "GetrfBatched: invalid leading dimension or stride");
+    }
+    if(batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(n==0) {
+        ClearInfo(*queue, info_buffer, info_offset, batch_count, event);
+        return;
+    }
+    ClearInfo(*queue, info_buffer, info_offset, batch_count, nullptr);
+    const size_t local = PanelGroupSize(*queue);
+    Launch(*queue, Kernel(*queue, Source<T>(), "getf2_panel"), {local*batch_count}, {local}, event,
+        (cl_int)n, (cl_int)n, (cl_int)(layout==CLBlastLayoutRowMajor),
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+        ipiv_buffer, (cl_ulong)ipiv_offset, (cl_ulong)ipiv_stride,
+        info_buffer, (cl_ulong)info_offset,
+        (cl_int)0,
+        LocalMemory{local*sizeof(T)}, LocalMemory{local*sizeof(cl_int)});
+}
+
+template <typename T>
+void GetrsBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                  const size_t n, const size_t nrhs,
+                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                  const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                  const size_t batch_count,
+                  cl_command_queue* queue, cl_event* event)
+{
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < n || b_ld < LeadingDimension(row_major, CLBlastTransposeNo, n, nrhs)) {
+        throw Error(CL_INVALID_VALUE, "GetrsBatched: invalid leading dimension");
+    }
+    if(n==0 || nrhs==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    Launch(*queue, Kernel(*queue, Source<T>(), "getrs_batched"), {nrhs, batch_count}, {}, event,
+        (cl_int)n, (cl_int)nrhs, (cl_int)row_major, (cl_int)(a_transpose!=CLBlastTransposeNo),
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+        ipiv_buffer, (cl_ulong)ipiv_offset, (cl_ulong)ipiv_stride,
+        b_buffer, (cl_ulong)b_offset, (cl_int)b_ld, (cl_ulong)b_stride);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Getrf<float>(layout, m, n, a_buffer, a_offset, a_ld,
+            ipiv_buffer, ipiv_offset, info_buffer, info_offset, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Getrf<double>(layout, m, n, a_buffer, a_offset, a_ld,
+            ipiv_buffer, ipiv_offset, info_buffer, info_offset, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Getrs<float>(layout, a_transpose, n, nrhs, a_buffer, a_offset, a_ld,
+            ipiv_buffer, ipiv_offset, b_buffer, b_offset, b_ld, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                           const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Getrs<double>(layout, a_transpose, n, nrhs, a_buffer, a_offset, a_ld,
+            ipiv_buffer, ipiv_offset, b_buffer, b_offset, b_ld, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgetrfBatched(const CLBlastLayout layout, const size_t n,
+                                                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem info_buffer, const size_t info_offset,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GetrfBatched<float>(layout, n, a_buffer, a_offset, a_ld, a_stride,
+            ipiv_buffer, ipiv_offset, ipiv_stride, info_buffer, info_offset,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgetrfBatched(const CLBlastLayout layout, const size_t n,
+                                                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem info_buffer, const size_t info_offset,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GetrfBatched<double>(layout, n, a_buffer, a_offset, a_ld, a_stride,
+            ipiv_buffer, ipiv_offset, ipiv_stride, info_buffer, info_offset,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSgetrsBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t n, const size_t nrhs,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GetrsBatched<float>(layout, a_transpose, n, nrhs,
+            a_buffer, a_offset, a_ld, a_stride,
+            ipiv_buffer, ipiv_offset, ipiv_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDgetrsBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t n, const size_t nrhs,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GetrsBatched<double>(layout, a_transpose, n, nrhs,
+            a_buffer, a_offset, a_ld, a_stride,
+            ipiv_buffer, ipiv_offset, ipiv_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+}
@@ -0,0 +1,727 @@
+#include "clkernels.h"
+
+//
+// Batch normalization, layer normalization and RMS normalization
+// in one kernel each.
+//
+// Batch normalization normalizes each channel j of X [m, n, k] over
+// the m*k elements X[i, j, l], so NCHW is (batch, channels, height*width)
+// and NHWC is (batch*height*width, channels, 1).
+//
+//   Y = gamma[j] * (X - mean[j]) / sqrt(var[j] + epsilon) + beta[j]
+//
+// The inference kernel uses the given mean and var. The training kernel
+// computes the mean and the variance of the batch, writes mean and
+// 1/sqrt(var+epsilon) for the backward kernel and updates the running
+// statistics as running := momentum*running + (1-momentum)*batch.
+//
+// Layer normalization normalizes each row of X [m, n], and RMS
+// normalization scales each row by 1/sqrt(mean(X^2) + epsilon).
+//
+//   Y = gamma[j] * (X - mean) / sqrt(var + epsilon) + beta[j]   (layer)
+//   Y = gamma[j] * X / sqrt(mean(X^2) + epsilon)                (rms)
+//
+// A segment (a channel or a row) is handled by one work-group, which
+// reads it once per statistic and once to write Y, so the variance is
+// computed from the deviations and does not cancel. The statistics and
+// gamma/beta have the type of X; half is computed in float.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t groupSize = 256;
+
+const char *normalizationSource = R"CLC(
+REAL group_sum(REAL v, __local REAL *buf)
+{
+    const int lid = get_local_id(0);
+    buf[lid] = v;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            buf[lid] += buf[lid+s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    const REAL sum = buf[0];
+    barrier(CLK_LOCAL_MEM_FENCE);
+    return sum;
+}
+
+// position of the p-th element of channel j
+#define CHANNEL_INDEX(p) ((((ulong)((p)/k))*n + j)*k + (p)%k)
+
+__kernel void batch_norm_inference(
+    const ulong total, const int n, const int k, const REAL epsilon,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *gamma, const ulong gamma_offset,
+    __global const STORAGE *beta, const ulong beta_offset,
+    __global const STORAGE *mean, const ulong mean_offset,
+    __global const STORAGE *var, const ulong var_offset,
+    __global STORAGE *y, const ulong y_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    const int j = (gid/k)%n;
+    const REAL scale = LOAD(gamma, gamma_offset+j) * rsqrt(LOAD(var, var_offset+j)+epsilon);
+    const REAL v = (LOAD(x, x_offset+gid) - LOAD(mean, mean_offset+j))*scale + LOAD(beta, beta_offset+j);
+    STORE(v, y, y_offset+gid);
+}
+
+__kernel void batch_norm_training(
+    const int m, const int n, const int k, const REAL epsilon, const REAL momentum,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *gamma, const ulong gamma_offset,
+    __global const STORAGE *beta, const ulong beta_offset,
+    __global STORAGE *y, const ulong y_offset,
+    __global STORAGE *running_mean, const ulong running_mean_offset,
+    __global STORAGE *running_var, const ulong running_var_offset,
+    __global STORAGE *saved_mean, const ulong saved_mean_offset,
+    __global STORAGE *saved_invstd, const ulong saved_invstd_offset)
+{
+    __local REAL buf[GROUP];
+    const int lid = get_local_id(0);
+    const int j = get_group_id(0);
+    const int count = m*k;
+    REAL s = 0;
+    for(int p=lid; p<count; p+=GROUP) {
+        s += LOAD(x, x_offset+CHANNEL_INDEX(p));
+    }
+    const REAL mu = group_sum(s, buf)/count;
+    s = 0;
+    for(int p=lid; p<count; p+=GROUP) {
+        const REAL d = LOAD(x, x_offset+CHANNEL_INDEX(p)) - mu;
+        s += d*d;
+    }
+    const REAL var = group_sum(s, buf)/count;
+    const REAL invstd = rsqrt(var+epsilon);
+    const REAL scale = LOAD(gamma, gamma_offset+j)*invstd;
+    const REAL shift = LOAD(beta, beta_offset+j);
+    for(int p=lid; p<count; p+=GROUP) {
+        const ulong idx = CHANNEL_INDEX(p);
+        STORE((LOAD(x, x_offset+idx)-mu)*scale + shift, y, y_offset+idx);
+    }
+    if(lid==0) {
+        STORE(mu, saved_mean, saved_mean_offset+j);
+        STORE(invstd, saved_invstd, saved_invstd_offset+j);
+        STORE(momentum*LOAD(running_mean, running_mean_offset+j) + (1-momentum)*mu,
+            running_mean, running_mean_offset+j);
+        STORE(momentum*LOAD(running_var, running_var_offset+j) + (1-momentum)*var,
+            running_var, running_var_offset+j);
+    }
+}
+
+__kernel void batch_norm_backward(
+    const int m, const int n, const int k,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *gamma, const ulong gamma_offset,
+    __global const STORAGE *saved_mean, const ulong saved_mean_offset,
+    __global const STORAGE *saved_invstd, const ulong saved_invstd_offset,
+    __global const STORAGE *dy, const ulong dy_offset,
+    __global STORAGE *dx, const ulong dx_offset,
+    __global STORAGE *dgamma, const ulong dgamma_offset,
+    __global STORAGE *dbeta, const ulong dbeta_offset)
+{
+    __local REAL buf[GROUP];
+    const int lid = get_local_id(0);
+    const int j = get_group_id(0);
+    const int count = m*k;
+    const REAL mu = LOAD(saved_mean, saved_mean_offset+j);
+    const REAL invstd = LOAD(saved_invstd, saved_invstd_offset+j);
+    REAL sdy = 0;
+    REAL sdyx = 0;
+    for(int p=lid; p<count; p+=GROUP) {
+        const ulong idx = CHANNEL_INDEX(p);
+        const REAL g = LOAD(dy, dy_offset+idx);
+        sdy += g;
+        sdyx += g*(LOAD(x, x_offset+idx)-mu)*invstd;
+    }
+    sdy = group_sum(sdy, buf);
+    sdyx = group_sum(sdyx, buf);
+    const REAL scale = LOAD(gamma, gamma_offset+j)*invstd;
+    for(int p=lid; p<count; p+=GROUP) {
+        const ulong idx = CHANNEL_INDEX(p);
+        const REAL xhat = (LOAD(x, x_offset+idx)-mu)*invstd;
+        const REAL v = scale*(LOAD(dy, dy_offset+idx) - (sdy + xhat*sdyx)/count);
+        STORE(v, dx, dx_offset+idx);
+    }
+    if(lid==0) {
+        STORE(sdyx, dgamma, dgamma_offset+j);
+        STORE(sdy, dbeta, dbeta_offset+j);
+    }
+}
+
+__kernel void layer_norm(
+    const int n, const REAL epsilon, const int save_stats,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *gamma, const ulong gamma_offset,
+    __global const STORAGE *beta, const ulong beta_offset,
+    __global STORAGE *y, const ulong y_offset,
+    __global STORAGE *saved_mean, const ulong saved_mean_offset,
+    __global STORAGE *saved_invstd, const ulong saved_invstd_offset)
+{
+    __local REAL buf[GROUP];
+    const int lid = get_local_id(0);
+    const int i = get_group_id(0);
+    const ulong xo = x_offset + (ulong)i*n;
+    const ulong yo = y_offset + (ulong)i*n;
+    REAL s = 0;
+#if RMS
+    const REAL mu = 0;
+#else
+    for(int j=lid; j<n; j+=GROUP) {
+        s += LOAD(x, xo+j);
+    }
+    const REAL mu = group_sum(s, buf)/n;
+    s = 0;
+#endif
+    for(int j=lid; j<n; j+=GROUP) {
+        const REAL d = LOAD(x, xo+j) - mu;
+        s += d*d;
+    }
+    const REAL invstd = rsqrt(group_sum(s, buf)/n + epsilon);
+    for(int j=lid; j<n; j+=GROUP) {
+        REAL v = (LOAD(x, xo+j)-mu)*invstd*LOAD(gamma, gamma_offset+j);
+#if !RMS
+        v += LOAD(beta, beta_offset+j);
+#endif
+        STORE(v, y, yo+j);
+    }
+    if(lid==0 && save_stats) {
+#if !RMS
+        STORE(mu, saved_mean, saved_mean_offset+i);
+#endif
+        STORE(invstd, saved_invstd, saved_invstd_offset+i);
+    }
+}
+
+__kernel void layer_norm_backward_data(
+    const int n,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *gamma, const ulong gamma_offset,
+    __global const STORAGE *saved_mean, const ulong saved_mean_offset,
+    __global const STORAGE *saved_invstd, const ulong saved_invstd_offset,
+    __global const STORAGE *dy, const ulong dy_offset,
+    __global STORAGE *dx, const ulong dx_offset)
+{
+    __local REAL buf[GROUP];
+    const int lid = get_local_id(0);
+    const int i = get_group_id(0);
+    const ulong o = (ulong)i*n;
+#if RMS
+    const REAL mu = 0;
+#else
+    const REAL mu = LOAD(saved_mean, saved_mean_offset+i);
+#endif
+    const REAL invstd = LOAD(saved_invstd, saved_invstd_offset+i);
+    REAL sg = 0;
+    REAL sgx = 0;
+    for(int j=lid; j<n; j+=GROUP) {
+        const REAL g = LOAD(dy, dy_offset+o+j)*LOAD(gamma, gamma_offset+j);
+        sg += g;
+        sgx += g*(LOAD(x, x_offset+o+j)-mu)*invstd;
+    }
+#if RMS
+    sg = 0;
+#else
+    sg = group_sum(sg, buf);
+#endif
+    sgx = group_sum(sgx, buf);
+    for(int j=lid; j<n; j+=GROUP) {
+        const REAL g = LOAD(dy, dy_offset+o+j)*LOAD(gamma, gamma_offset+j);
+        const REAL xhat = (LOAD(x, x_offset+o+j)-mu)*invstd;
+        STORE(invstd*(g - (sg + xhat*sgx)/n), dx, dx_offset+o+j);
+    }
+}
+
+// dgamma and dbeta are sums over the rows; adjacent work-items read adjacent columns
+__kernel void layer_norm_backward_params(
+    const int m, const int n,
+    __global const STORAGE *x, const ulong x_offset,
+    __global const STORAGE *saved_mean, const ulong saved_mean_offset,
+    __global const STORAGE *saved_invstd, const ulong saved_invstd_offset,
+    __global const STORAGE *dy, const ulong dy_offset,
+    __global STORAGE *dgamma, const ulong dgamma_offset,
+    __global STORAGE *dbeta, const ulong dbeta_offset)
+{
+    const int j = get_global_id(0);
+    if(j>=n) {
+        return;
+    }
+    REAL sdy = 0;
+    REAL sdyx = 0;
+    for(int i=0; i<m; i++) {
+        const ulong idx = (ulong)i*n + j;
+#if RMS
+        const REAL mu = 0;
+#else
+        const REAL mu = LOAD(saved_mean, saved_mean_offset+i);
+#endif
+        const REAL g = LOAD(dy, dy_offset+idx);
+        sdy += g;
+        sdyx += g*(LOAD(x, x_offset+idx)-mu)*LOAD(saved_invstd, saved_invstd_offset+i);
+    }
+    STORE(sdyx, dgamma, dgamma_offset+j);
+#if !RMS
+    STORE(sdy, dbeta, dbeta_offset+j);
+#endif
+}
+)CLC";
+
+size_t GroupFor(cl_command_queue queue, const size_t count)
+{
+    size_t group = groupSize;
+    const size_t max_group = MaxWorkGroupSize(queue);
+    while(group>max_group || (group>1 && group/2>=count)) {
+        group >>= 1;
+    }
+    return group;
+}
+
+std::string NormalizationSource(const CLBlastPrecision precision, const bool rms, const size_t group)
+{
+    return Preamble(precision) +
+        "#define RMS " + (rms ? "1" : "0") + "\n" +
+        "#define GROUP " + std::to_string(group) + "\n" +
+        normalizationSource;
+}
+
+template <typename T>
+void BatchNorm(const CLBlastPrecision precision, const bool training,
+               const size_t m, const size_t n, const size_t k,
+               const T epsilon, const T momentum,
+               const cl_mem x_buffer, const size_t x_offset,
+               const cl_mem gamma_buffer, const size_t gamma_offset,
+               const cl_mem beta_buffer, const size_t beta_offset,
+               cl_mem y_buffer, const size_t y_offset,
+               cl_mem mean_buffer, const size_t mean_offset,
+               cl_mem var_buffer, const size_t var_offset,
+               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+               cl_command_queue* queue, cl_event* event)
+{
+    const size_t elem = SizeOf(precision);
+    const size_t total = m*n*k;
+    CheckArray("BatchNorm", "X", x_buffer, elem, x_offset, total);
+    CheckArray("BatchNorm", "Y", y_buffer, elem, y_offset, total);
+    CheckArray("BatchNorm", "Gamma", gamma_buffer, elem, gamma_offset, n);
+    CheckArray("BatchNorm", "Beta", beta_buffer, elem, beta_offset, n);
+    CheckArray("BatchNorm", "Mean", mean_buffer, elem, mean_offset, n);
+    CheckArray("BatchNorm", "Var", var_buffer, elem, var_offset, n);
+    if(training) {
+        CheckArray("BatchNorm", "SavedMean", saved_mean_buffer, elem, saved_mean_offset, n);
+        CheckArray("BatchNorm", "SavedInvStd", saved_invstd_buffer, elem, saved_invstd_offset, n);
+    }
+    if(m*n*k==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(!training) {
+        Launch(*queue, Kernel(*queue, NormalizationSource(precision, false, 1), "batch_norm_inference"),
+            {RoundUp(total, 64)}, {}, event,
+            (cl_ulong)total, (cl_int)n, (cl_int)k, epsilon,
+            x_buffer, (cl_ulong)x_offset,
+            gamma_buffer, (cl_ulong)gamma_offset,
+            beta_buffer, (cl_ulong)beta_offset,
+            mean_buffer, (cl_ulong)mean_offset,
+            var_buffer, (cl_ulong)var_offset,
+            y_buffer, (cl_ulong)y_offset);
+        return;
+    }
+    const size_t group = GroupFor(*queue, m*k);
+    Launch(*queue, Kernel(*queue, NormalizationSource(precision, false, group), "batch_norm_training"),
+        {n*group}, {group}, event,
+        (cl_int)m, (cl_int)n, (cl_int)k, epsilon, momentum,
+        x_buffer, (cl_ulong)x_offset,
+        gamma_buffer, (cl_ulong)gamma_offset,
+        beta_buffer, (cl_ulong)beta_offset,
+        y_buffer, (cl_ulong)y_offset,
+        mean_buffer, (cl_ulong)mean_offset,
+        var_buffer, (cl_ulong)var_offset,
+        saved_mean_buffer, (cl_ulong)saved_mean_offset,
+        saved_invstd_buffer, (cl_ulong)saved_invstd_offset);
+}
+
+void BatchNormBackward(const CLBlastPrecision precision,
+                       const size_t m, const size_t n, const size_t k,
+                       const cl_mem x_buffer, const size_t x_offset,
+                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                       const cl_mem dy_buffer, const size_t dy_offset,
+                       cl_mem dx_buffer, const size_t dx_offset,
+                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                       cl_command_queue* queue, cl_event* event)
+{
+    const size_t elem = SizeOf(precision);
+    const size_t total = m*n*k;
+    CheckArray("BatchNormBackward", "X", x_buffer, elem, x_offset, total);
+    CheckArray("BatchNormBackward", "dY", dy_buffer, elem, dy_offset, total);
+    CheckArray("BatchNormBackward", "dX", dx_buffer, elem, dx_offset, total);
+    CheckArray("BatchNormBackward", "Gamma", gamma_buffer, elem, gamma_offset, n);
+    CheckArray("BatchNormBackward", "SavedMean", saved_mean_buffer, elem, saved_mean_offset, n);
+    CheckArray("BatchNormBackward", "SavedInvStd", saved_invstd_buffer, elem, saved_invstd_offset, n);
+    CheckArray("BatchNormBackward", "dGamma", dgamma_buffer, elem, dgamma_offset, n);
+    CheckArray("BatchNormBackward", "dBeta", dbeta_buffer, elem, dbeta_offset, n);
+    if(m*n*k==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t group = GroupFor(*queue, m*k);
+    Launch(*queue, Kernel(*queue, NormalizationSource(precision, false, group), "batch_norm_backward"),
+        {n*group}, {group}, event,
+        (cl_int)m, (cl_int)n, (cl_int)k,
+        x_buffer, (cl_ulong)x_offset,
+        gamma_buffer, (cl_ulong)gamma_offset,
+        saved_mean_buffer, (cl_ulong)saved_mean_offset,
+        saved_invstd_buffer, (cl_ulong)saved_invstd_offset,
+        dy_buffer, (cl_ulong)dy_offset,
+        dx_buffer, (cl_ulong)dx_offset,
+        dgamma_buffer, (cl_ulong)dgamma_offset,
+        dbeta_buffer, (cl_ulong)dbeta_offset);
+}
+
+template <typename T>
+void LayerNorm(const CLBlastPrecision precision, const bool rms, const bool save_stats,
+               const size_t m, const size_t n, const T epsilon,
+               const cl_mem x_buffer, const size_t x_offset,
+               const cl_mem gamma_buffer, const size_t gamma_offset,
+               const cl_mem beta_buffer, const size_t beta_offset,
+               cl_mem y_buffer, const size_t y_offset,
+               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+               cl_command_queue* queue, cl_event* event)
+{
+    // RMS normalization has no beta and no mean
+    const size_t elem = SizeOf(precision);
+    CheckArray("LayerNorm", "X", x_buffer, elem, x_offset, m*n);
+    CheckArray("LayerNorm", "Y", y_buffer, elem, y_offset, m*n);
+    CheckArray("LayerNorm", "Gamma", gamma_buffer, elem, gamma_offset, n);
+    if(!rms) {
+        CheckArray("LayerNorm", "Beta", beta_buffer, elem, beta_offset, n);
+    }
+    if(save_stats) {
+        if(!rms) {
+            CheckArray("LayerNorm", "SavedMean", saved_mean_buffer, elem, saved_mean_offset, m);
+        }
+        CheckArray("LayerNorm", "SavedInvStd", saved_invstd_buffer, elem, saved_invstd_offset, m);
+    }
+    if(m==0 || n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t group = GroupFor(*queue, n);
+    Launch(*queue, Kernel(*queue, NormalizationSource(precision, rms, group), "layer_norm"),
+        {m*group}, {group}, event,
+        (cl_int)n, epsilon, (cl_int)save_stats,
+        x_buffer, (cl_ulong)x_offset,
+        gamma_buffer, (cl_ulong)gamma_offset,
+        beta_buffer, (cl_ulong)beta_offset,
+        y_buffer, (cl_ulong)y_offset,
+        saved_mean_buffer, (cl_ulong)saved_mean_offset,
+        saved_invstd_buffer, (cl_ulong)saved_invstd_offset);
+}
+
+void LayerNormBackward(const CLBlastPrecision precision, const bool rms,
+                       const size_t m, const size_t n,
+                       const cl_mem x_buffer, const size_t x_offset,
+                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                       const cl_mem dy_buffer, const size_t dy_offset,
+                       cl_mem dx_buffer, const size_t dx_offset,
+                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                       cl_command_queue* queue, cl_event* event)
+{
+    const size_t elem = SizeOf(precision);
+    CheckArray("LayerNormBackward", "X", x_buffer, elem, x_offset, m*n);
+    CheckArray("LayerNormBackward", "dY", dy_buffer, elem, dy_offset, m*n);
+    CheckArray("LayerNormBackward", "dX", dx_buffer, elem, dx_offset, m*n);
+    CheckArray("LayerNormBackward", "Gamma", gamma_buffer, elem, gamma_offset, n);
+    CheckArray("LayerNormBackward", "dGamma", dgamma_buffer, elem, dgamma_offset, n);
+    if(!rms) {
+        CheckArray("LayerNormBackward", "SavedMean", saved_mean_buffer, elem, saved_mean_offset, m);
+        CheckArray("LayerNormBackward", "dBeta", dbeta_buffer, elem, dbeta_offset, n);
+    }
+    CheckArray("LayerNormBackward", "SavedInvStd", saved_invstd_buffer, elem, saved_invstd_offset, m);
+    if(n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t group = GroupFor(*queue, n);
+    const std::string source = NormalizationSource(precision, rms, group);
+    // the event of the last kernel covers the first one in the (in-order) queue
+    if(m>0) {
+        Launch(*queue, Kernel(*queue, source, "layer_norm_backward_data"),
+            {m*group}, {group}, nullptr,
+            (cl_int)n,
+            x_buffer, (cl_ulong)x_offset,
+            gamma_buffer, (cl_ulong)gamma_offset,
+            saved_mean_buffer, (cl_ulong)saved_mean_offset,
+            saved_invstd_buffer, (cl_ulong)saved_invstd_offset,
+            dy_buffer, (cl_ulong)dy_offset,
+            dx_buffer, (cl_ulong)dx_offset);
+    }
+    Launch(*queue, Kernel(*queue, source, "layer_norm_backward_params"),
+        {RoundUp(n, 64)}, {}, event,
+        (cl_int)m, (cl_int)n,
+        x_buffer, (cl_ulong)x_offset,
+        saved_mean_buffer, (cl_ulong)saved_mean_offset,
+        saved_invstd_buffer, (cl_ulong)saved_invstd_offset,
+        dy_buffer, (cl_ulong)dy_offset,
+        dgamma_buffer, (cl_ulong)dgamma_offset,
+        dbeta_buffer, (cl_ulong)dbeta_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastHbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float epsilon, const float momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNorm<float>(CLBlastPrecisionHalf, training!=0, m, n, k, epsilon, momentum,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset, mean_buffer, mean_offset, var_buffer, var_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float epsilon, const float momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNorm<float>(CLBlastPrecisionSingle, training!=0, m, n, k, epsilon, momentum,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset, mean_buffer, mean_offset, var_buffer, var_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDbatchNorm(const int training,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const double epsilon, const double momentum,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem mean_buffer, const size_t mean_offset,
+                                               cl_mem var_buffer, const size_t var_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNorm<double>(CLBlastPrecisionDouble, training!=0, m, n, k, epsilon, momentum,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset, mean_buffer, mean_offset, var_buffer, var_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastHbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNormBackward(CLBlastPrecisionHalf, m, n, k,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNormBackward(CLBlastPrecisionSingle, m, n, k,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDbatchNormBackward(const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        BatchNormBackward(CLBlastPrecisionDouble, m, n, k,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastHlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const float epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNorm<float>(CLBlastPrecisionHalf, rms!=0, save_stats!=0, m, n, epsilon,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const float epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNorm<float>(CLBlastPrecisionSingle, rms!=0, save_stats!=0, m, n, epsilon,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDlayerNorm(const int rms, const int save_stats,
+                                               const size_t m, const size_t n, const double epsilon,
+                                               const cl_mem x_buffer, const size_t x_offset,
+                                               const cl_mem gamma_buffer, const size_t gamma_offset,
+                                               const cl_mem beta_buffer, const size_t beta_offset,
+                                               cl_mem y_buffer, const size_t y_offset,
+                                               cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                               cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                               cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNorm<double>(CLBlastPrecisionDouble, rms!=0, save_stats!=0, m, n, epsilon,
+            x_buffer, x_offset, gamma_buffer, gamma_offset, beta_buffer, beta_offset,
+            y_buffer, y_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastHlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNormBackward(CLBlastPrecisionHalf, rms!=0, m, n,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNormBackward(CLBlastPrecisionSingle, rms!=0, m, n,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDlayerNormBackward(const int rms,
+                                                       const size_t m, const size_t n,
+                                                       const cl_mem x_buffer, const size_t x_offset,
+                                                       const cl_mem gamma_buffer, const size_t gamma_offset,
+                                                       const cl_mem saved_mean_buffer, const size_t saved_mean_offset,
+                                                       const cl_mem saved_invstd_buffer, const size_t saved_invstd_offset,
+                                                       const cl_mem dy_buffer, const size_t dy_offset,
+                                                       cl_mem dx_buffer, const size_t dx_offset,
+                                                       cl_mem dgamma_buffer, const size_t dgamma_offset,
+                                                       cl_mem dbeta_buffer, const size_t dbeta_offset,
+                                                       cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        LayerNormBackward(CLBlastPrecisionDouble, rms!=0, m, n,
+            x_buffer, x_offset, gamma_buffer, gamma_offset,
+            saved_mean_buffer, saved_mean_offset, saved_invstd_buffer, saved_invstd_offset,
+            dy_buffer, dy_offset, dx_buffer, dx_offset,
+            dgamma_buffer, dgamma_offset, dbeta_buffer, dbeta_offset,
+            queue, event);
+    });
+}
+}
@@ -0,0 +1,258 @@
+#include "clkernels.h"
+
+//
+// Copy of a strided N-d array to another strided N-d array.
+//
+//   Y[idx] := X[idx]  for every idx of shape
+//
+// Both operands have their own strides over the shape of Y, so a
+// permutation of the axes of X is a copy with the strides of X permuted
+// (see Math::permute), and NCHW to NHWC, head splitting or batch-major
+// to time-major are one launch. Every element reached must lie in its
+// buffer, and the elements of Y must not overlap.
+//
+// Dimensions of size 1 are dropped and adjacent dimensions that are
+// contiguous in both operands are merged first. When the unit-stride
+// axis of X is not the unit-stride axis of Y, a tile of those two axes
+// is read along X, transposed in local memory and written along Y, so
+// both the reads and the writes are coalesced; the other axes are the
+// third dimension of the range. Otherwise every work-item copies one
+// element.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t maxRank = 8;
+const size_t tileSize = 32;
+const size_t tileRows = 8;
+
+// Kernel argument passed by value. It must match "Layout" in the source.
+struct Layout {
+    cl_long shape[maxRank];
+    cl_long stride[2][maxRank];
+};
+
+const char *permuteSource = R"CLC(
+typedef struct {
+    long shape[MAXRANK];
+    long stride[2][MAXRANK];
+} Layout;
+
+// offsets of the element of the linear index in X and Y
+void locate(const Layout *layout, ulong gid, long *xo, long *yo)
+{
+    for(int d=RANK-1; d>=0; d--) {
+        const long c = gid % (ulong)layout->shape[d];
+        gid /= (ulong)layout->shape[d];
+        *xo += c*layout->stride[0][d];
+        *yo += c*layout->stride[1][d];
+    }
+}
+
+__kernel void permute_copy(
+    const ulong total, const Layout layout,
+    __global const STORAGE *x, const ulong x_offset,
+    __global STORAGE *y, const ulong y_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    long xo = x_offset;
+    long yo = y_offset;
+    locate(&layout, gid, &xo, &yo);
+    STORE(LOAD(x, xo), y, yo);
+}
+
+// a is the unit-stride axis of Y and b that of X
+__kernel void permute_tiled(
+    const int na, const int nb,
+    const long xa, const long ya, const long xb, const long yb,
+    const Layout rest,
+    __global const STORAGE *x, const ulong x_offset,
+    __global STORAGE *y, const ulong y_offset)
+{
+    __local REAL tile[TILE][TILE+1];
+    const int lx = get_local_id(0);
+    const int ly = get_local_id(1);
+    const int a0 = get_group_id(0)*TILE;
+    const int b0 = get_group_id(1)*TILE;
+    long xo = x_offset;
+    long yo = y_offset;
+    locate(&rest, get_global_id(2), &xo, &yo);
+    for(int t=ly; t<TILE; t+=ROWS) {
+        const int a = a0 + t;
+        const int b = b0 + lx;
+        if(a<na && b<nb) {
+            tile[t][lx] = LOAD(x, xo + a*xa + b*xb);
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int t=ly; t<TILE; t+=ROWS) {
+        const int a = a0 + lx;
+        const int b = b0 + t;
+        if(a<na && b<nb) {
+            STORE(tile[lx][t], y, yo + a*ya + b*yb);
+        }
+    }
+}
+)CLC";
+
+size_t Merge(const size_t rank, const size_t *shape,
+             const cl_long *x_strides, const cl_long *y_strides,
+             Layout &layout, size_t &merged_rank)
+{
+    size_t total = 1;
+    size_t r = 0;
+    for(size_t d=0; d<rank; d++) {
+        total *= shape[d];
+        if(shape[d]==1) {
+            continue;
+        }
+        if(r>0 &&
+            layout.stride[0][r-1]==x_strides[d]*(cl_long)shape[d] &&
+            layout.stride[1][r-1]==y_strides[d]*(cl_long)shape[d]) {
+            layout.shape[r-1] *= shape[d];
+            layout.stride[0][r-1] = x_strides[d];
+            layout.stride[1][r-1] = y_strides[d];
+            continue;
+        }
+        layout.shape[r] = shape[d];
+        layout.stride[0][r] = x_strides[d];
+        layout.stride[1][r] = y_strides[d];
+        r++;
+    }
+    merged_rank = r;
+    return total;
+}
+
+size_t UnitAxis(const Layout &layout, const size_t rank, const size_t operand)
+{
+    for(size_t d=0; d<rank; d++) {
+        if(layout.stride[operand][d]==1) {
+            return d;
+        }
+    }
+    return rank;
+}
+
+std::string PermuteSource(const CLBlastPrecision precision, const size_t rank,
+                          const size_t tile, const size_t rows)
+{
+    return Preamble(precision) +
+        "#define MAXRANK " + std::to_string(maxRank) + "\n" +
+        "#define RANK " + std::to_string(rank) + "\n" +
+        "#define TILE " + std::to_string(tile) + "\n" +
+        "#define ROWS " + std::to_string(rows) + "\n" +
+        permuteSource;
+}
+
+void Permute(const CLBlastPrecision precision,
+             const size_t rank, const size_t *shape,
+             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+             cl_command_queue* queue, cl_event* event)
+{
+    if(rank>maxRank) {
+        throw Error(CL_INVALID_VALUE, "Permute: too many dimensions");
+    }
+    Layout layout = {};
+    size_t merged_rank;
+    const size_t total = Merge(rank, shape, x_strides, y_strides, layout, merged_rank);
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t element_size = SizeOf(precision);
+    CheckBuffer("Permute", "x", x_buffer, element_size, x_offset, rank, shape, x_strides);
+    CheckBuffer("Permute", "y", y_buffer, element_size, y_offset, rank, shape, y_strides);
+    CheckOverlap("Permute", "y", rank, shape, y_strides);
+    const size_t a = UnitAxis(layout, merged_rank, 1);
+    const size_t b = UnitAxis(layout, merged_rank, 0);
+    if(a==merged_rank || b==merged_rank || a==b) {
+        if(merged_rank==0) {
+            layout.shape[0] = 1;
+            merged_rank = 1;
+        }
+        Launch(*queue, Kernel(*queue, PermuteSource(precision, merged_rank, 1, 1), "permute_copy"),
+            {RoundUp(total, 64)}, {}, event,
+            (cl_ulong)total, layout,
+            x_buffer, (cl_ulong)x_offset,
+            y_buffer, (cl_ulong)y_offset);
+        return;
+    }
+    size_t tile = tileSize;
+    size_t rows = tileRows;
+    if(tile*rows>MaxWorkGroupSize(*queue)) {
+        tile = 16;
+        rows = 4;
+    }
+    // the axes other than a and b
+    Layout rest = {};
+    size_t rest_rank = 0;
+    for(size_t d=0; d<merged_rank; d++) {
+        if(d==a || d==b) {
+            continue;
+        }
+        rest.shape[rest_rank] = layout.shape[d];
+        rest.stride[0][rest_rank] = layout.stride[0][d];
+        rest.stride[1][rest_rank] = layout.stride[1][d];
+        rest_rank++;
+    }
+    if(rest_rank==0) {
+        rest.shape[0] = 1;
+        rest_rank = 1;
+    }
+    const size_t na = layout.shape[a];
+    const size_t nb = layout.shape[b];
+    Launch(*queue, Kernel(*queue, PermuteSource(precision, rest_rank, tile, rows), "permute_tiled"),
+        {CeilDiv(na, tile)*tile, CeilDiv(nb, tile)*rows, total/(na*nb)}, {tile, rows, 1}, event,
+        (cl_int)na, (cl_int)nb,
+        layout.stride[0][a], layout.stride[1][a],
+        layout.stride[0][b], layout.stride[1][b],
+        rest,
+        x_buffer, (cl_ulong)x_offset,
+        y_buffer, (cl_ulong)y_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastHpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Permute(CLBlastPrecisionHalf, rank, shape,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Permute(CLBlastPrecisionSingle, rank, shape,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDpermute(const size_t rank, const size_t *shape,
+                                             const cl_mem x_buffer, const size_t x_offset, const cl_long *x_strides,
+                                             cl_mem y_buffer, const size_t y_offset, const cl_long *y_strides,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Permute(CLBlastPrecisionDouble, rank, shape,
+            x_buffer, x_offset, x_strides,
+            y_buffer, y_offset, y_strides,
+            queue, event);
+    });
+}
+}
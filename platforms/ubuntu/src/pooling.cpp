@@ -0,0 +1,422 @@
+#include "clkernels.h"
+
+//
+// Max and average pooling of images [batch][channels][height][width],
+// the layout of im2col, to [batch][channels][output_h][output_w].
+//
+// Max pooling also writes the position (y*width+x) of the maximum of each
+// window in its image, or -1 for a window entirely in the padding. The
+// backward pass routes each gradient to that position; it is computed per
+// image pixel from the windows that cover it, which is the same as the
+// scatter but needs no atomics when the windows overlap.
+//
+// Average pooling divides by the number of pixels of the window inside
+// the image, so the padding does not count.
+//
+// The global pooling reduces each plane with one work-group. Its backward
+// pass is the backward pass of a window of the whole image.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+enum PoolMode {
+    PoolMax = 0,
+    PoolAverage = 1,
+};
+
+const size_t groupSize = 256;
+
+const char *poolingSource = R"CLC(
+__kernel void pool_forward(
+    const ulong total,
+    const int height, const int width,
+    const int pool_h, const int pool_w,
+    const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w,
+    const int output_h, const int output_w,
+    __global const REAL *x, const ulong x_offset,
+    __global REAL *y, const ulong y_offset,
+    __global int *indices, const ulong indices_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    const int ow = gid % output_w;
+    const int oh = (gid / output_w) % output_h;
+    const ulong plane = gid / ((ulong)output_w*output_h);
+    const ulong xo = x_offset + plane*height*width;
+    const int y0 = oh*stride_h - pad_h;
+    const int x0 = ow*stride_w - pad_w;
+    const int ys = max(y0, 0);
+    const int ye = min(y0+pool_h, height);
+    const int xs = max(x0, 0);
+    const int xe = min(x0+pool_w, width);
+#if POOL_MODE==0
+    REAL best = 0;
+    int index = -1;
+    for(int iy=ys; iy<ye; iy++) {
+        for(int ix=xs; ix<xe; ix++) {
+            const REAL v = x[xo + iy*width + ix];
+            if(index<0 || v>best) {
+                best = v;
+                index = iy*width + ix;
+            }
+        }
+    }
+    y[y_offset + gid] = best;
+    indices[indices_offset + gid] = index;
+#else
+    REAL sum = 0;
+    for(int iy=ys; iy<ye; iy++) {
+        for(int ix=xs; ix<xe; ix++) {
+            sum += x[xo + iy*width + ix];
+        }
+    }
+    const int count = max(ye-ys, 0)*max(xe-xs, 0);
+    y[y_offset + gid] = (count>0) ? sum/count : (REAL)0;
+#endif
+}
+
+__kernel void pool_backward(
+    const ulong total,
+    const int height, const int width,
+    const int pool_h, const int pool_w,
+    const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w,
+    const int output_h, const int output_w,
+    __global const REAL *dy, const ulong dy_offset,
+    __global const int *indices, const ulong indices_offset,
+    __global REAL *dx, const ulong dx_offset)
+{
+    const ulong gid = get_global_id(0);
+    if(gid>=total) {
+        return;
+    }
+    const int ix = gid % width;
+    const int iy = (gid / width) % height;
+    const ulong plane = gid / ((ulong)width*height);
+    const ulong po = plane*output_h*output_w;
+    // windows oh with oh*stride_h-pad_h <= iy < oh*stride_h-pad_h+pool_h
+    const int th = iy + pad_h - pool_h + 1;
+    const int tw = ix + pad_w - pool_w + 1;
+    const int ohs = (th<=0) ? 0 : (th+stride_h-1)/stride_h;
+    const int ows = (tw<=0) ? 0 : (tw+stride_w-1)/stride_w;
+    const int ohe = min((iy+pad_h)/stride_h + 1, output_h);
+    const int owe = min((ix+pad_w)/stride_w + 1, output_w);
+    REAL acc = 0;
+    for(int oh=ohs; oh<ohe; oh++) {
+        for(int ow=ows; ow<owe; ow++) {
+            const ulong o = po + oh*output_w + ow;
+#if POOL_MODE==0
+            if(indices[indices_offset + o]==iy*width+ix) {
+                acc += dy[dy_offset + o];
+            }
+#else
+            const int y0 = oh*stride_h - pad_h;
+            const int x0 = ow*stride_w - pad_w;
+            const int count = (min(y0+pool_h, height)-max(y0, 0))*(min(x0+pool_w, width)-max(x0, 0));
+            acc += dy[dy_offset + o]/count;
+#endif
+        }
+    }
+    dx[dx_offset + gid] = acc;
+}
+
+__kernel __attribute__((reqd_work_group_size(GROUP, 1, 1)))
+void pool_global(
+    const int size,
+    __global const REAL *x, const ulong x_offset,
+    __global REAL *y, const ulong y_offset,
+    __global int *indices, const ulong indices_offset)
+{
+    __local REAL lvalue[GROUP];
+    __local int lindex[GROUP];
+    const int lid = get_local_id(0);
+    const ulong plane = get_group_id(0);
+    const ulong xo = x_offset + plane*size;
+#if POOL_MODE==0
+    REAL best = 0;
+    int index = -1;
+    for(int i=lid; i<size; i+=GROUP) {
+        const REAL v = x[xo + i];
+        if(index<0 || v>best) {
+            best = v;
+            index = i;
+        }
+    }
+    lvalue[lid] = best;
+    lindex[lid] = index;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            const int oi = lindex[lid+s];
+            const REAL ov = lvalue[lid+s];
+            // the first position wins a tie, as in pool_forward
+            if(oi>=0 && (lindex[lid]<0 || ov>lvalue[lid] || (ov==lvalue[lid] && oi<lindex[lid]))) {
+                lvalue[lid] = ov;
+                lindex[lid] = oi;
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(lid==0) {
+        y[y_offset + plane] = lvalue[0];
+        indices[indices_offset + plane] = lindex[0];
+    }
+#else
+    REAL sum = 0;
+    for(int i=lid; i<size; i+=GROUP) {
+        sum += x[xo + i];
+    }
+    lvalue[lid] = sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            lvalue[lid] += lvalue[lid+s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(lid==0) {
+        y[y_offset + plane] = lvalue[0]/size;
+    }
+#endif
+}
+)CLC";
+
+struct PoolShape {
+    size_t output_h, output_w;
+};
+
+PoolShape OutputShape(const int mode,
+                      const size_t height, const size_t width,
+                      const size_t pool_h, const size_t pool_w,
+                      const size_t pad_h, const size_t pad_w,
+                      const size_t stride_h, const size_t stride_w)
+{
+    if(mode!=PoolMax && mode!=PoolAverage) {
+        throw Error(CL_INVALID_VALUE, "Pool2d: unknown pooling mode");
+    }
+    if(pool_h==0 || pool_w==0 || stride_h==0 || stride_w==0) {
+        throw Error(CL_INVALID_VALUE, "Pool2d: pool size and stride must be greater than zero");
+    }
+    if(pad_h>=pool_h || pad_w>=pool_w) {
+        throw Error(CL_INVALID_VALUE, "Pool2d: pad must be smaller than the pool size");
+    }
+    if(height+2*pad_h < pool_h || width+2*pad_w < pool_w) {
+        return {0, 0};
+    }
+    return {(height+2*pad_h-pool_h)/stride_h+1, (width+2*pad_w-pool_w)/stride_w+1};
+}
+
+std::string PoolingSource(const CLBlastPrecision precision, const int mode, const size_t group)
+{
+    return Preamble(precision) +
+        "#define POOL_MODE " + std::to_string(mode) + "\n" +
+        "#define GROUP " + std::to_string(group) + "\n" +
+        poolingSource;
+}
+
+template <typename T>
+void Pool2d(const int mode, const size_t batch_count, const size_t channels,
+            const size_t height, const size_t width,
+            const size_t pool_h, const size_t pool_w,
+            const size_t pad_h, const size_t pad_w,
+            const size_t stride_h, const size_t stride_w,
+            const cl_mem x_buffer, const size_t x_offset,
+            cl_mem y_buffer, const size_t y_offset,
+            cl_mem indices_buffer, const size_t indices_offset,
+            cl_command_queue* queue, cl_event* event)
+{
+    const PoolShape out = OutputShape(mode, height, width, pool_h, pool_w, pad_h, pad_w, stride_h, stride_w);
+    if(mode==PoolMax && indices_buffer==nullptr) {
+        throw Error(CL_INVALID_VALUE, "Pool2d: max pooling needs the indices buffer");
+    }
+    const size_t total = batch_count*channels*out.output_h*out.output_w;
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    Launch(*queue, Kernel(*queue, PoolingSource(PrecisionOf<T>(), mode, 1), "pool_forward"),
+        {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total,
+        (cl_int)height, (cl_int)width,
+        (cl_int)pool_h, (cl_int)pool_w,
+        (cl_int)pad_h, (cl_int)pad_w,
+        (cl_int)stride_h, (cl_int)stride_w,
+        (cl_int)out.output_h, (cl_int)out.output_w,
+        x_buffer, (cl_ulong)x_offset,
+        y_buffer, (cl_ulong)y_offset,
+        (mode==PoolMax) ? indices_buffer : y_buffer, (cl_ulong)indices_offset);
+}
+
+template <typename T>
+void Pool2dBackward(const int mode, const size_t batch_count, const size_t channels,
+                    const size_t height, const size_t width,
+                    const size_t pool_h, const size_t pool_w,
+                    const size_t pad_h, const size_t pad_w,
+                    const size_t stride_h, const size_t stride_w,
+                    const cl_mem dy_buffer, const size_t dy_offset,
+                    const cl_mem indices_buffer, const size_t indices_offset,
+                    cl_mem dx_buffer, const size_t dx_offset,
+                    cl_command_queue* queue, cl_event* event)
+{
+    const PoolShape out = OutputShape(mode, height, width, pool_h, pool_w, pad_h, pad_w, stride_h, stride_w);
+    if(mode==PoolMax && indices_buffer==nullptr) {
+        throw Error(CL_INVALID_VALUE, "Pool2dBackward: max pooling needs the indices buffer");
+    }
+    const size_t total = batch_count*channels*height*width;
+    if(total==0) {
+        Marker(*queue, event);
+        return;
+    }
+    Launch(*queue, Kernel(*queue, PoolingSource(PrecisionOf<T>(), mode, 1), "pool_backward"),
+        {RoundUp(total, 64)}, {}, event,
+        (cl_ulong)total,
+        (cl_int)height, (cl_int)width,
+        (cl_int)pool_h, (cl_int)pool_w,
+        (cl_int)pad_h, (cl_int)pad_w,
+        (cl_int)stride_h, (cl_int)stride_w,
+        (cl_int)out.output_h, (cl_int)out.output_w,
+        dy_buffer, (cl_ulong)dy_offset,
+        (mode==PoolMax) ? indices_buffer : dy_buffer, (cl_ulong)indices_offset,
+        dx_buffer, (cl_ulong)dx_offset);
+}
+
+template <typename T>
+void GlobalPool2d(const int mode, const size_t batch_count, const size_t channels,
+                  const size_t height, const size_t width,
+                  const cl_mem x_buffer, const size_t x_offset,
+                  cl_mem y_buffer, const size_t y_offset,
+                  cl_mem indices_buffer, const size_t indices_offset,
+                  cl_command_queue* queue, cl_event* event)
+{
+    if(mode!=PoolMax && mode!=PoolAverage) {
+        throw Error(CL_INVALID_VALUE, "GlobalPool2d: unknown pooling mode");
+    }
+    if(mode==PoolMax && indices_buffer==nullptr) {
+        throw Error(CL_INVALID_VALUE, "GlobalPool2d: max pooling needs the indices buffer");
+    }
+    const size_t planes = batch_count*channels;
+    const size_t size = height*width;
+    if(planes==0) {
+        Marker(*queue, event);
+        return;
+    }
+    if(size==0) {
+        throw Error(CL_INVALID_VALUE, "GlobalPool2d: the image is empty");
+    }
+    size_t group = groupSize;
+    const size_t max_group = MaxWorkGroupSize(*queue);
+    while(group>max_group || (group>1 && group/2>=size)) {
+        group >>= 1;
+    }
+    Launch(*queue, Kernel(*queue, PoolingSource(PrecisionOf<T>(), mode, group), "pool_global"),
+        {planes*group}, {group}, event,
+        (cl_int)size,
+        x_buffer, (cl_ulong)x_offset,
+        y_buffer, (cl_ulong)y_offset,
+        (mode==PoolMax) ? indices_buffer : y_buffer, (cl_ulong)indices_offset);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSpool2d(const int mode, const size_t batch_count, const size_t channels,
+                                            const size_t height, const size_t width,
+                                            const size_t pool_h, const size_t pool_w,
+                                            const size_t pad_h, const size_t pad_w,
+                                            const size_t stride_h, const size_t stride_w,
+                                            const cl_mem x_buffer, const size_t x_offset,
+                                            cl_mem y_buffer, const size_t y_offset,
+                                            cl_mem indices_buffer, const size_t indices_offset,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Pool2d<float>(mode, batch_count, channels, height, width,
+            pool_h, pool_w, pad_h, pad_w, stride_h, stride_w,
+            x_buffer, x_offset, y_buffer, y_offset, indices_buffer, indices_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDpool2d(const int mode, const size_t batch_count, const size_t channels,
+                                            const size_t height, const size_t width,
+                                            const size_t pool_h, const size_t pool_w,
+                                            const size_t pad_h, const size_t pad_w,
+                                            const size_t stride_h, const size_t stride_w,
+                                            const cl_mem x_buffer, const size_t x_offset,
+                                            cl_mem y_buffer, const size_t y_offset,
+                                            cl_mem indices_buffer, const size_t indices_offset,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Pool2d<double>(mode, batch_count, channels, height, width,
+            pool_h, pool_w, pad_h, pad_w, stride_h, stride_w,
+            x_buffer, x_offset, y_buffer, y_offset, indices_buffer, indices_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSpool2dBackward(const int mode, const size_t batch_count, const size_t channels,
+                                                    const size_t height, const size_t width,
+                                                    const size_t pool_h, const size_t pool_w,
+                                                    const size_t pad_h, const size_t pad_w,
+                                                    const size_t stride_h, const size_t stride_w,
+                                                    const cl_mem dy_buffer, const size_t dy_offset,
+                                                    const cl_mem indices_buffer, const size_t indices_offset,
+                                                    cl_mem dx_buffer, const size_t dx_offset,
+                                                    cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Pool2dBackward<float>(mode, batch_count, channels, height, width,
+            pool_h, pool_w, pad_h, pad_w, stride_h, stride_w,
+            dy_buffer, dy_offset, indices_buffer, indices_offset, dx_buffer, dx_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDpool2dBackward(const int mode, const size_t batch_count, const size_t channels,
+                                                    const size_t height, const size_t width,
+                                                    const size_t pool_h, const size_t pool_w,
+                                                    const size_t pad_h, const size_t pad_w,
+                                                    const size_t stride_h, const size_t stride_w,
+                                                    const cl_mem dy_buffer, const size_t dy_offset,
+                                                    const cl_mem indices_buffer, const size_t indices_offset,
+                                                    cl_mem dx_buffer, const size_t dx_offset,
+                                                    cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Pool2dBackward<double>(mode, batch_count, channels, height, width,
+            pool_h, pool_w, pad_h, pad_w, stride_h, stride_w,
+            dy_buffer, dy_offset, indices_buffer, indices_offset, dx_buffer, dx_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSglobalPool2d(const int mode, const size_t batch_count, const size_t channels,
+                                                  const size_t height, const size_t width,
+                                                  const cl_mem x_buffer, const size_t x_offset,
+                                                  cl_mem y_buffer, const size_t y_offset,
+                                                  cl_mem indices_buffer, const size_t indices_offset,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GlobalPool2d<float>(mode, batch_count, channels, height, width,
+            x_buffer, x_offset, y_buffer, y_offset, indices_buffer, indices_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDglobalPool2d(const int mode, const size_t batch_count, const size_t channels,
+                                                  const size_t height, const size_t width,
+                                                  const cl_mem x_buffer, const size_t x_offset,
+                                                  cl_mem y_buffer, const size_t y_offset,
+                                                  cl_mem indices_buffer, const size_t indices_offset,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GlobalPool2d<double>(mode, batch_count, channels, height, width,
+            x_buffer, x_offset, y_buffer, y_offset, indices_buffer, indices_offset,
+            queue, event);
+    });
+}
+}
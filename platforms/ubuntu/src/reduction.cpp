@@ -0,0 +1,353 @@
+#include "clkernels.h"
+
+//
+// Reductions along the middle axis of an array of [m, n, k].
+//
+//   B[i, j] = op(A[i, 0, j] ... A[i, n-1, j])
+//
+// A 2D array of [rows, cols] is reduced per row with k=1 and per column
+// with m=1. The value ops write the type of A, argmax and argmin write
+// int32 indices (the first one among equal values). A and B are
+// contiguous and checked against their buffers.
+//
+// ReduceStats computes sum, sum of squares, min and max of each
+// segment in one pass and writes them as B[i, j, 0..3]. Rows are the
+// segments of layer normalization (k=1) and columns those of batch
+// normalization (m=1).
+//
+// max, min, argmax and argmin and the min and max of ReduceStats
+// propagate NaN: a segment with a NaN gives NaN, and argmax/argmin give
+// the index of the first NaN.
+//
+// Short axes are reduced by one work-item per output, where adjacent
+// work-items read adjacent elements when k>1. Long axes with few
+// outputs are reduced by one work-group per output.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+enum ReduceOp {
+    ReduceSum = 0,
+    ReduceMean = 1,
+    ReduceMax = 2,
+    ReduceMin = 3,
+    ReduceArgMax = 4,
+    ReduceArgMin = 5,
+};
+
+const size_t groupSize = 256;
+const size_t shortAxis = 64;
+const size_t manyOutputs = 8192;
+
+const char *reductionSource = R"CLC(
+#if OP==OP_SUM || OP==OP_MEAN
+#define INIT 0
+#define UPDATE(acc,idx,x,i) (acc) += (x)
+#define MERGE(acc,idx,o,oi) (acc) += (o)
+#else
+// NaN wins over any number, as in NumPy
+#if OP==OP_MAX || OP==OP_ARGMAX
+#define INIT (-INFINITY)
+#define BETTER(x,acc) (!isnan(acc) && (isnan(x) || (x)>(acc)))
+#else
+#define INIT INFINITY
+#define BETTER(x,acc) (!isnan(acc) && (isnan(x) || (x)<(acc)))
+#endif
+#define SAME(x,acc) ((x)==(acc) || (isnan(x) && isnan(acc)))
+#define UPDATE(acc,idx,x,i) if(BETTER(x,acc)) { (acc) = (x); (idx) = (i); }
+#define MERGE(acc,idx,o,oi) if(BETTER(o,acc) || (SAME(o,acc) && (oi)<(idx))) { (acc) = (o); (idx) = (oi); }
+#endif
+
+#if OP==OP_ARGMAX || OP==OP_ARGMIN
+#define OUTPUT __global int
+#define WRITE(acc,idx,n,b,o) (b)[o] = (idx)
+#else
+#define OUTPUT __global STORAGE
+#if OP==OP_MEAN
+#define WRITE(acc,idx,n,b,o) STORE((acc)/(n),b,o)
+#else
+#define WRITE(acc,idx,n,b,o) STORE(acc,b,o)
+#endif
+#endif
+
+__kernel void reduce_items(
+    const int m, const int n, const int k,
+    __global const STORAGE *a, const ulong a_offset,
+    OUTPUT *b, const ulong b_offset)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(j>=k || i>=m) {
+        return;
+    }
+    const ulong base = a_offset + (ulong)i*n*k + j;
+    REAL acc = INIT;
+    int idx = 0;
+    for(int l=0; l<n; l++) {
+        const REAL x = LOAD(a, base+(ulong)l*k);
+        UPDATE(acc,idx,x,l);
+    }
+    WRITE(acc,idx,(REAL)n,b,b_offset+(ulong)i*k+j);
+}
+
+__kernel void reduce_groups(
+    const int m, const int n, const int k,
+    __global const STORAGE *a, const ulong a_offset,
+    OUTPUT *b, const ulong b_offset)
+{
+    __local REAL lacc[GROUP];
+    __local int lidx[GROUP];
+    const int lid = get_local_id(0);
+    const int o = get_group_id(0);
+    const int i = o/k;
+    const int j = o%k;
+    const ulong base = a_offset + (ulong)i*n*k + j;
+    REAL acc = INIT;
+    int idx = 0;
+    for(int l=lid; l<n; l+=GROUP) {
+        const REAL x = LOAD(a, base+(ulong)l*k);
+        UPDATE(acc,idx,x,l);
+    }
+    lacc[lid] = acc;
+    lidx[lid] = idx;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            const REAL other = lacc[lid+s];
+            const int other_idx = lidx[lid+s];
+            MERGE(acc,idx,other,other_idx);
+            lacc[lid] = acc;
+            lidx[lid] = idx;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(lid==0) {
+        WRITE(acc,idx,(REAL)n,b,b_offset+o);
+    }
+}
+)CLC";
+
+const char *statsSource = R"CLC(
+#define STATS 4
+// NaN wins over any number, as in the max and min of reduce
+#define LOWER(a,b) ((isnan(b) || (b)<(a)) ? (b) : (a))
+#define HIGHER(a,b) ((isnan(b) || (b)>(a)) ? (b) : (a))
+
+__kernel void stats_items(
+    const int m, const int n, const int k,
+    __global const STORAGE *a, const ulong a_offset,
+    __global STORAGE *b, const ulong b_offset)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(j>=k || i>=m) {
+        return;
+    }
+    const ulong base = a_offset + (ulong)i*n*k + j;
+    REAL sum = 0;
+    REAL sumsq = 0;
+    REAL lo = INFINITY;
+    REAL hi = -INFINITY;
+    for(int l=0; l<n; l++) {
+        const REAL x = LOAD(a, base+(ulong)l*k);
+        sum += x;
+        sumsq += x*x;
+        lo = LOWER(lo, x);
+        hi = HIGHER(hi, x);
+    }
+    const ulong o = b_offset + ((ulong)i*k+j)*STATS;
+    STORE(sum, b, o);
+    STORE(sumsq, b, o+1);
+    STORE(lo, b, o+2);
+    STORE(hi, b, o+3);
+}
+
+__kernel void stats_groups(
+    const int m, const int n, const int k,
+    __global const STORAGE *a, const ulong a_offset,
+    __global STORAGE *b, const ulong b_offset)
+{
+    __local REAL lsum[GROUP];
+    __local REAL lsumsq[GROUP];
+    __local REAL llo[GROUP];
+    __local REAL lhi[GROUP];
+    const int lid = get_local_id(0);
+    const int o = get_group_id(0);
+    const int i = o/k;
+    const int j = o%k;
+    const ulong base = a_offset + (ulong)i*n*k + j;
+    REAL sum = 0;
+    REAL sumsq = 0;
+    REAL lo = INFINITY;
+    REAL hi = -INFINITY;
+    for(int l=lid; l<n; l+=GROUP) {
+        const REAL x = LOAD(a, base+(ulong)l*k);
+        sum += x;
+        sumsq += x*x;
+        lo = LOWER(lo, x);
+        hi = HIGHER(hi, x);
+    }
+    lsum[lid] = sum;
+    lsumsq[lid] = sumsq;
+    llo[lid] = lo;
+    lhi[lid] = hi;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s) {
+            lsum[lid] += lsum[lid+s];
+            lsumsq[lid] += lsumsq[lid+s];
+            llo[lid] = LOWER(llo[lid], llo[lid+s]);
+            lhi[lid] = HIGHER(lhi[lid], lhi[lid+s]);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    if(lid==0) {
+        const ulong out = b_offset + (ulong)o*STATS;
+        STORE(lsum[0], b, out);
+        STORE(lsumsq[0], b, out+1);
+        STORE(llo[0], b, out+2);
+        STORE(lhi[0], b, out+3);
+    }
+}
+)CLC";
+
+size_t GroupSize(cl_command_queue queue)
+{
+    size_t group = groupSize;
+    const size_t max_group = MaxWorkGroupSize(queue);
+    while(group>max_group) {
+        group >>= 1;
+    }
+    return group;
+}
+
+template <typename T>
+void Reduce(const int op,
+            const size_t m, const size_t n, const size_t k,
+            const cl_mem a_buffer, const size_t a_offset,
+            cl_mem b_buffer, const size_t b_offset,
+            cl_command_queue* queue, cl_event* event)
+{
+    if(op<ReduceSum || op>ReduceArgMin) {
+        throw Error(CL_INVALID_VALUE, "Reduce: unknown operation");
+    }
+    if(n==0) {
+        throw Error(CL_INVALID_VALUE, "Reduce: empty axis");
+    }
+    if(m==0 || k==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const bool arg = (op==ReduceArgMax || op==ReduceArgMin);
+    CheckArray("Reduce", "a", a_buffer, sizeof(T), a_offset, m*n*k);
+    CheckArray("Reduce", "b", b_buffer, arg ? sizeof(cl_int) : sizeof(T), b_offset, m*k);
+    const size_t group = GroupSize(*queue);
+    const std::string source = Preamble(PrecisionOf<T>()) +
+        "#define OP_SUM 0\n#define OP_MEAN 1\n#define OP_MAX 2\n"
+        "#define OP_MIN 3\n#define OP_ARGMAX 4\n#define OP_ARGMIN 5\n"
+        "#define OP " + std::to_string(op) + "\n" +
+        "#define GROUP " + std::to_string(group) + "\n" +
+        reductionSource;
+    const size_t outputs = m*k;
+    if(n<=shortAxis || outputs>=manyOutputs) {
+        Launch(*queue, Kernel(*queue, source, "reduce_items"), {k, m}, {}, event,
+            (cl_int)m, (cl_int)n, (cl_int)k,
+            a_buffer, (cl_ulong)a_offset,
+            b_buffer, (cl_ulong)b_offset);
+    } else {
+        Launch(*queue, Kernel(*queue, source, "reduce_groups"), {outputs*group}, {group}, event,
+            (cl_int)m, (cl_int)n, (cl_int)k,
+            a_buffer, (cl_ulong)a_offset,
+            b_buffer, (cl_ulong)b_offset);
+    }
+}
+
+template <typename T>
+void ReduceStats(const size_t m, const size_t n, const size_t k,
+                 const cl_mem a_buffer, const size_t a_offset,
+                 cl_mem b_buffer, const size_t b_offset,
+                 cl_command_queue* queue, cl_event* event)
+{
+    if(n==0) {
+        throw Error(CL_INVALID_VALUE, "ReduceStats: empty axis");
+    }
+    if(m==0 || k==0) {
+        Marker(*queue, event);
+        return;
+    }
+    CheckArray("ReduceStats", "a", a_buffer, sizeof(T), a_offset, m*n*k);
+    CheckArray("ReduceStats", "b", b_buffer, sizeof(T), b_offset, m*k*4);
+    const size_t group = GroupSize(*queue);
+    const std::string source = Preamble(PrecisionOf<T>()) +
+        "#define GROUP " + std::to_string(group) + "\n" +
+        statsSource;
+    const size_t outputs = m*k;
+    if(n<=shortAxis || outputs>=manyOutputs) {
+        Launch(*queue, Kernel(*queue, source, "stats_items"), {k, m}, {}, event,
+            (cl_int)m, (cl_int)n, (cl_int)k,
+            a_buffer, (cl_ulong)a_offset,
+            b_buffer, (cl_ulong)b_offset);
+    } else {
+        Launch(*queue, Kernel(*queue, source, "stats_groups"), {outputs*group}, {group}, event,
+            (cl_int)m, (cl_int)n, (cl_int)k,
+            a_buffer, (cl_ulong)a_offset,
+            b_buffer, (cl_ulong)b_offset);
+    }
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSreduce(const int op,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem a_buffer, const size_t a_offset,
+                                            cl_mem b_buffer, const size_t b_offset,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Reduce<float>(op, m, n, k,
+            a_buffer, a_offset,
+            b_buffer, b_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDreduce(const int op,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem a_buffer, const size_t a_offset,
+                                            cl_mem b_buffer, const size_t b_offset,
+                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Reduce<double>(op, m, n, k,
+            a_buffer, a_offset,
+            b_buffer, b_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSreduceStats(const size_t m, const size_t n, const size_t k,
+                                                 const cl_mem a_buffer, const size_t a_offset,
+                                                 cl_mem b_buffer, const size_t b_offset,
+                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ReduceStats<float>(m, n, k,
+            a_buffer, a_offset,
+            b_buffer, b_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDreduceStats(const size_t m, const size_t n, const size_t k,
+                                                 const cl_mem a_buffer, const size_t a_offset,
+                                                 cl_mem b_buffer, const size_t b_offset,
+                                                 cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ReduceStats<double>(m, n, k,
+            a_buffer, a_offset,
+            b_buffer, b_offset,
+            queue, event);
+    });
+}
+}
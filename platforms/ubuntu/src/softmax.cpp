@@ -0,0 +1,203 @@
+#include "clkernels.h"
+
+//
+// Softmax and log-softmax along the last axis of a batch of rows.
+//
+//   Y[i,j] := exp(X[i,j] - max_i) / sum_i            (softmax)
+//   Y[i,j] := X[i,j] - max_i - log(sum_i)            (log-softmax)
+//
+// where sum_i = sum_j exp(X[i,j] - max_i). Rows start every ldx / ldy
+// elements, so a row of a strided batch or an in-place update works.
+// X and Y are checked against their buffers.
+//
+// The maximum and the sum are found together in one pass with the online
+// rescaling of the sum, and a second pass writes Y. Rows up to
+// "shortRow" are handled by one work-item each, longer rows by one
+// work-group each.
+//
+// Elements of -INFINITY are masked out (padding or a causal mask). A row
+// that is masked entirely gives 0 for softmax and -INFINITY for
+// log-softmax instead of NaN.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t shortRow = 32;
+const size_t groupSize = 256;
+
+const char *softmaxSource = R"CLC(
+// merge (max,sum) of two parts
+#define COMBINE(mx,sm,omx,osm) { \
+    const REAL nmx_ = fmax((mx),(omx)); \
+    (sm) = (sm)*exp((mx)-nmx_) + (osm)*exp((omx)-nmx_); \
+    (mx) = nmx_; \
+}
+
+// add v to (mx,sm). -INFINITY (a masked element) adds nothing, so
+// exp(-inf - -inf) is never evaluated while the row is still all masked.
+#define ACCUMULATE(mx,sm,v) { \
+    if((v)>(mx)) { \
+        (sm) = (sm)*exp((mx)-(v)) + 1; \
+        (mx) = (v); \
+    } else if((v)!=-INFINITY) { \
+        (sm) += exp((v)-(mx)); \
+    } \
+}
+
+// a fully masked row (sm==0) gives 0 for softmax and -INFINITY for log-softmax
+#if LOG_SOFTMAX
+#define OUTPUT(x,mx,sm) ((sm)>0 ? (x)-(mx)-log(sm) : (REAL)(-INFINITY))
+#else
+#define OUTPUT(x,mx,sm) ((sm)>0 ? exp((x)-(mx))/(sm) : (REAL)0)
+#endif
+
+__kernel void softmax_items(
+    const int m, const int n,
+    __global const STORAGE *x, const ulong x_offset, const int ldx,
+    __global STORAGE *y, const ulong y_offset, const int ldy)
+{
+    const int i = get_global_id(0);
+    if(i>=m) {
+        return;
+    }
+    const ulong xo = x_offset + (ulong)i*ldx;
+    const ulong yo = y_offset + (ulong)i*ldy;
+    REAL mx = -INFINITY;
+    REAL sm = 0;
+    for(int j=0; j<n; j++) {
+        const REAL v = LOAD(x, xo+j);
+        ACCUMULATE(mx,sm,v);
+    }
+    for(int j=0; j<n; j++) {
+        const REAL v = LOAD(x, xo+j);
+        STORE(OUTPUT(v,mx,sm), y, yo+j);
+    }
+}
+
+__kernel void softmax_groups(
+    const int m, const int n,
+    __global const STORAGE *x, const ulong x_offset, const int ldx,
+    __global STORAGE *y, const ulong y_offset, const int ldy)
+{
+    __local REAL lmx[GROUP];
+    __local REAL lsm[GROUP];
+    const int lid = get_local_id(0);
+    const int i = get_group_id(0);
+    const ulong xo = x_offset + (ulong)i*ldx;
+    const ulong yo = y_offset + (ulong)i*ldy;
+    REAL mx = -INFINITY;
+    REAL sm = 0;
+    for(int j=lid; j<n; j+=GROUP) {
+        const REAL v = LOAD(x, xo+j);
+        ACCUMULATE(mx,sm,v);
+    }
+    lmx[lid] = mx;
+    lsm[lid] = sm;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int s=GROUP/2; s>0; s>>=1) {
+        if(lid<s && lsm[lid+s]>0) {
+            if(lsm[lid]>0) {
+                COMBINE(mx,sm,lmx[lid+s],lsm[lid+s]);
+            } else {
+                mx = lmx[lid+s];
+                sm = lsm[lid+s];
+            }
+            lmx[lid] = mx;
+            lsm[lid] = sm;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    mx = lmx[0];
+    sm = lsm[0];
+    for(int j=lid; j<n; j+=GROUP) {
+        const REAL v = LOAD(x, xo+j);
+        STORE(OUTPUT(v,mx,sm), y, yo+j);
+    }
+}
+)CLC";
+
+void Softmax(const CLBlastPrecision precision, const bool log_softmax,
+             const size_t m, const size_t n,
+             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+             cl_command_queue* queue, cl_event* event)
+{
+    if(x_ld < n || y_ld < n) {
+        throw Error(CL_INVALID_VALUE, "Softmax: invalid leading dimension");
+    }
+    if(m==0 || n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t element_size = SizeOf(precision);
+    const size_t shape[] = {m, n};
+    const cl_long x_strides[] = {(cl_long)x_ld, 1};
+    const cl_long y_strides[] = {(cl_long)y_ld, 1};
+    CheckBuffer("Softmax", "x", x_buffer, element_size, x_offset, 2, shape, x_strides);
+    CheckBuffer("Softmax", "y", y_buffer, element_size, y_offset, 2, shape, y_strides);
+    size_t group = groupSize;
+    const size_t max_group = MaxWorkGroupSize(*queue);
+    while(group>max_group || (group>1 && group/2>=n)) {
+        group >>= 1;
+    }
+    const std::string source = Preamble(precision) +
+        "#define LOG_SOFTMAX " + (log_softmax ? "1" : "0") + "\n" +
+        "#define GROUP " + std::to_string(group) + "\n" +
+        softmaxSource;
+    if(n<=shortRow) {
+        Launch(*queue, Kernel(*queue, source, "softmax_items"), {m}, {}, event,
+            (cl_int)m, (cl_int)n,
+            x_buffer, (cl_ulong)x_offset, (cl_int)x_ld,
+            y_buffer, (cl_ulong)y_offset, (cl_int)y_ld);
+    } else {
+        Launch(*queue, Kernel(*queue, source, "softmax_groups"), {m*group}, {group}, event,
+            (cl_int)m, (cl_int)n,
+            x_buffer, (cl_ulong)x_offset, (cl_int)x_ld,
+            y_buffer, (cl_ulong)y_offset, (cl_int)y_ld);
+    }
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastHsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Softmax(CLBlastPrecisionHalf, log_softmax!=0, m, n,
+            x_buffer, x_offset, x_ld,
+            y_buffer, y_offset, y_ld,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastSsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Softmax(CLBlastPrecisionSingle, log_softmax!=0, m, n,
+            x_buffer, x_offset, x_ld,
+            y_buffer, y_offset, y_ld,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDsoftmax(const int log_softmax,
+                                             const size_t m, const size_t n,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                             cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Softmax(CLBlastPrecisionDouble, log_softmax!=0, m, n,
+            x_buffer, x_offset, x_ld,
+            y_buffer, y_offset, y_ld,
+            queue, event);
+    });
+}
+}
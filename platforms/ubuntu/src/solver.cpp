@@ -0,0 +1,371 @@
+#include "clkernels.h"
+#include <cmath>
+
+//
+// Iterative solvers of A*x = b for a dense matrix A.
+//
+//   CG        A must be symmetric positive definite
+//   BiCGSTAB  A must be nonsingular
+//
+// The matrix-vector products and inner products are computed by CLBlast
+// and the vector updates by fused kernels which read their coefficients
+// (alpha, beta, omega) from the scalars on the device. The host reads
+// the residual norm back only every "check_interval" iterations.
+//
+// x holds the initial guess on entry and the solution on exit.
+// The convergence criterion is ||r|| <= tol*||b|| with the recursively
+// updated residual r.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+enum SolverMethod {
+    SolverCG = 0,
+    SolverBiCGSTAB = 1,
+};
+
+const char *solverSource = R"CLC(
+inline REAL safe_div(const REAL n, const REAL d)
+{
+    return (d!=0) ? n/d : 0;
+}
+
+// alpha = rr/pAp;  x += alpha*p;  r -= alpha*Ap
+__kernel void cg_update_xr(
+    const int n, __global const REAL *sc, const int rr, const int pap,
+    __global REAL *w, const ulong p, const ulong ap, const ulong r,
+    __global REAL *x, const ulong x_offset)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const REAL alpha = safe_div(sc[rr], sc[pap]);
+    x[x_offset+i] += alpha*w[p+i];
+    w[r+i] -= alpha*w[ap+i];
+}
+
+// beta = rr_new/rr_old;  p = r + beta*p
+__kernel void cg_update_p(
+    const int n, __global const REAL *sc, const int rr_new, const int rr_old,
+    __global REAL *w, const ulong r, const ulong p)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const REAL beta = safe_div(sc[rr_new], sc[rr_old]);
+    w[p+i] = w[r+i] + beta*w[p+i];
+}
+
+// scalars of one iteration: rho, (r0,v), (t,s), (t,t)
+#define RHO 0
+#define RV  1
+#define TS  2
+#define TT  3
+
+// beta = (rho/rho_prev)*(alpha_prev/omega_prev);  p = r + beta*(p - omega_prev*v)
+__kernel void bicgstab_update_p(
+    const int n, __global const REAL *sc, const int cur, const int prev,
+    __global REAL *w, const ulong r, const ulong p, const ulong v)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const REAL alpha_prev = safe_div(sc[prev+RHO], sc[prev+RV]);
+    const REAL omega_prev = safe_div(sc[prev+TS], sc[prev+TT]);
+    const REAL beta = safe_div(sc[cur+RHO], sc[prev+RHO]) * safe_div(alpha_prev, omega_prev);
+    w[p+i] = w[r+i] + beta*(w[p+i] - omega_prev*w[v+i]);
+}
+
+// alpha = rho/(r0,v);  s = r - alpha*v
+__kernel void bicgstab_update_s(
+    const int n, __global const REAL *sc, const int cur,
+    __global REAL *w, const ulong r, const ulong v, const ulong s)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const REAL alpha = safe_div(sc[cur+RHO], sc[cur+RV]);
+    w[s+i] = w[r+i] - alpha*w[v+i];
+}
+
+// omega = (t,s)/(t,t);  x += alpha*p + omega*s;  r = s - omega*t
+__kernel void bicgstab_update_xr(
+    const int n, __global const REAL *sc, const int cur,
+    __global REAL *w, const ulong p, const ulong s, const ulong t, const ulong r,
+    __global REAL *x, const ulong x_offset)
+{
+    const int i = get_global_id(0);
+    if(i>=n) {
+        return;
+    }
+    const REAL alpha = safe_div(sc[cur+RHO], sc[cur+RV]);
+    const REAL omega = safe_div(sc[cur+TS], sc[cur+TT]);
+    x[x_offset+i] += alpha*w[p+i] + omega*w[s+i];
+    w[r+i] = w[s+i] - omega*w[t+i];
+}
+)CLC";
+
+template <typename T>
+class Solver {
+public:
+    Solver(const CLBlastLayout layout, const size_t n,
+           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           cl_mem x_buffer, const size_t x_offset,
+           cl_command_queue* queue)
+        : layout_(static_cast<::clblast::Layout>(layout)), n_(n),
+          a_buffer_(a_buffer), a_offset_(a_offset), a_ld_(a_ld),
+          x_buffer_(x_buffer), x_offset_(x_offset),
+          queue_(queue),
+          source_(Preamble(PrecisionOf<T>()) + solverSource) {}
+
+    // y = A*x (+ beta*y)
+    void Gemv(cl_mem x, size_t x_off, cl_mem y, size_t y_off, T alpha = 1, T beta = 0)
+    {
+        Check(::clblast::Gemv<T>(layout_, ::clblast::Transpose::kNo,
+            n_, n_, alpha,
+            a_buffer_, a_offset_, a_ld_,
+            x, x_off, 1,
+            beta,
+            y, y_off, 1,
+            queue_, nullptr), "Gemv");
+    }
+
+    void Dot(cl_mem x, size_t x_off, cl_mem y, size_t y_off, cl_mem r, size_t r_off)
+    {
+        Check(::clblast::Dot<T>(n_, r, r_off, x, x_off, 1, y, y_off, 1, queue_, nullptr), "Dot");
+    }
+
+    void Fill(cl_mem buffer, size_t offset, size_t count, T value)
+    {
+        CheckCL(clEnqueueFillBuffer(*queue_, buffer, &value, sizeof(T), offset*sizeof(T), count*sizeof(T),
+            0, nullptr, nullptr), "clEnqueueFillBuffer");
+    }
+
+    // r = b - A*x
+    void Residual(cl_mem b_buffer, size_t b_offset, cl_mem w, size_t r)
+    {
+        Check(::clblast::Copy<T>(n_, b_buffer, b_offset, 1, w, r, 1, queue_, nullptr), "Copy");
+        Gemv(x_buffer_, x_offset_, w, r, T(-1), T(1));
+    }
+
+    // blocking read of "count" scalars
+    void Read(cl_mem buffer, size_t offset, size_t count, T *values)
+    {
+        CheckCL(clEnqueueReadBuffer(*queue_, buffer, CL_TRUE, offset*sizeof(T), count*sizeof(T), values,
+            0, nullptr, nullptr), "clEnqueueReadBuffer");
+    }
+
+    cl_kernel Kernel(const char *name)
+    {
+        return rindow::clblast::Kernel(*queue_, source_, name);
+    }
+
+    size_t n() const { return n_; }
+    cl_mem x() const { return x_buffer_; }
+    size_t x_offset() const { return x_offset_; }
+    cl_command_queue queue() const { return *queue_; }
+    cl_command_queue* queue_ptr() const { return queue_; }
+
+private:
+    ::clblast::Layout layout_;
+    size_t n_;
+    cl_mem a_buffer_;
+    size_t a_offset_, a_ld_;
+    cl_mem x_buffer_;
+    size_t x_offset_;
+    cl_command_queue* queue_;
+    std::string source_;
+};
+
+template <typename T>
+bool Converged(T rr, T b_norm, T tol)
+{
+    return std::sqrt(rr) <= tol*b_norm;
+}
+
+template <typename T>
+size_t SolveCG(Solver<T> &solver, cl_mem b_buffer, size_t b_offset,
+               const T tol, const size_t max_iterations, const size_t check_interval,
+               T *residual)
+{
+    const size_t n = solver.n();
+    // vectors: r p Ap,  scalars: rr[2] pAp ||b||
+    const size_t r = 0, p = n, ap = 2*n;
+    const cl_int RR = 0, PAP = 2, BNORM = 3;
+    Workspace vectors(solver.queue(), 3*n*sizeof(T));
+    Workspace scalars(solver.queue(), 4*sizeof(T));
+    cl_mem w = vectors.buffer();
+    cl_mem sc = scalars.buffer();
+    cl_kernel update_xr = solver.Kernel("cg_update_xr");
+    cl_kernel update_p = solver.Kernel("cg_update_p");
+
+    solver.Residual(b_buffer, b_offset, w, r);
+    Check(::clblast::Copy<T>(n, w, r, 1, w, p, 1, solver.queue_ptr(), nullptr), "Copy");
+    solver.Dot(w, r, w, r, sc, RR);
+    Check(::clblast::Nrm2<T>(n, sc, BNORM, b_buffer, b_offset, 1, solver.queue_ptr(), nullptr), "Nrm2");
+
+    T host[4];
+    solver.Read(sc, 0, 4, host);
+    const T b_norm = host[BNORM];
+    T rr = host[RR];
+    size_t iter = 0;
+    cl_int cur = 0;
+    while(!Converged(rr, b_norm, tol) && iter<max_iterations) {
+        const cl_int next = 1-cur;
+        solver.Gemv(w, p, w, ap);
+        solver.Dot(w, p, w, ap, sc, PAP);
+        Launch(solver.queue(), update_xr, {n}, {}, nullptr,
+            (cl_int)n, sc, RR+cur, PAP,
+            w, (cl_ulong)p, (cl_ulong)ap, (cl_ulong)r,
+            solver.x(), (cl_ulong)solver.x_offset());
+        solver.Dot(w, r, w, r, sc, RR+next);
+        Launch(solver.queue(), update_p, {n}, {}, nullptr,
+            (cl_int)n, sc, RR+next, RR+cur,
+            w, (cl_ulong)r, (cl_ulong)p);
+        cur = next;
+        iter++;
+        if(iter%check_interval==0 || iter==max_iterations) {
+            solver.Read(sc, RR+cur, 1, &rr);
+        }
+    }
+    *residual = (b_norm!=0) ? std::sqrt(rr)/b_norm : std::sqrt(rr);
+    return iter;
+}
+
+template <typename T>
+size_t SolveBiCGSTAB(Solver<T> &solver, cl_mem b_buffer, size_t b_offset,
+                     const T tol, const size_t max_iterations, const size_t check_interval,
+                     T *residual)
+{
+    const size_t n = solver.n();
+    // vectors: r r0 p v s t,  scalars: {rho (r0,v) (t,s) (t,t)}[2] rr ||b||
+    const size_t r = 0, r0 = n, p = 2*n, v = 3*n, s = 4*n, t = 5*n;
+    const cl_int RHO = 0, RV = 1, TS = 2, TT = 3, RR = 8, BNORM = 9;
+    Workspace vectors(solver.queue(), 6*n*sizeof(T));
+    Workspace scalars(solver.queue(), 10*sizeof(T));
+    cl_mem w = vectors.buffer();
+    cl_mem sc = scalars.buffer();
+    cl_kernel update_p = solver.Kernel("bicgstab_update_p");
+    cl_kernel update_s = solver.Kernel("bicgstab_update_s");
+    cl_kernel update_xr = solver.Kernel("bicgstab_update_xr");
+
+    solver.Residual(b_buffer, b_offset, w, r);
+    Check(::clblast::Copy<T>(n, w, r, 1, w, r0, 1, solver.queue_ptr(), nullptr), "Copy");
+    solver.Fill(w, p, 2*n, T(0));       // p and v
+    solver.Fill(sc, 0, 8, T(1));        // rho = alpha = omega = 1
+    solver.Dot(w, r, w, r, sc, RR);
+    Check(::clblast::Nrm2<T>(n, sc, BNORM, b_buffer, b_offset, 1, solver.queue_ptr(), nullptr), "Nrm2");
+
+    T host[2];
+    solver.Read(sc, RR, 2, host);
+    const T b_norm = host[1];
+    T rr = host[0];
+    size_t iter = 0;
+    cl_int prev = 0;
+    while(!Converged(rr, b_norm, tol) && iter<max_iterations) {
+        const cl_int cur = 4-prev;
+        solver.Dot(w, r0, w, r, sc, cur+RHO);
+        Launch(solver.queue(), update_p, {n}, {}, nullptr,
+            (cl_int)n, sc, cur, prev,
+            w, (cl_ulong)r, (cl_ulong)p, (cl_ulong)v);
+        solver.Gemv(w, p, w, v);
+        solver.Dot(w, r0, w, v, sc, cur+RV);
+        Launch(solver.queue(), update_s, {n}, {}, nullptr,
+            (cl_int)n, sc, cur,
+            w, (cl_ulong)r, (cl_ulong)v, (cl_ulong)s);
+        solver.Gemv(w, s, w, t);
+        solver.Dot(w, t, w, s, sc, cur+TS);
+        solver.Dot(w, t, w, t, sc, cur+TT);
+        Launch(solver.queue(), update_xr, {n}, {}, nullptr,
+            (cl_int)n, sc, cur,
+            w, (cl_ulong)p, (cl_ulong)s, (cl_ulong)t, (cl_ulong)r,
+            solver.x(), (cl_ulong)solver.x_offset());
+        prev = cur;
+        iter++;
+        if(iter%check_interval==0 || iter==max_iterations) {
+            solver.Dot(w, r, w, r, sc, RR);
+            solver.Read(sc, RR, 1, &rr);
+        }
+    }
+    *residual = (b_norm!=0) ? std::sqrt(rr)/b_norm : std::sqrt(rr);
+    return iter;
+}
+
+template <typename T>
+void Solve(const size_t method, const CLBlastLayout layout, const size_t n,
+           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+           const cl_mem b_buffer, const size_t b_offset,
+           cl_mem x_buffer, const size_t x_offset,
+           const T tol, const size_t max_iterations, const size_t check_interval,
+           size_t *iterations, T *residual,
+           cl_command_queue* queue, cl_event* event)
+{
+    if(a_ld < n) {
+        throw Error(CL_INVALID_VALUE, "Solve: invalid leading dimension");
+    }
+    *iterations = 0;
+    *residual = 0;
+    if(n==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t interval = (check_interval==0) ? 1 : check_interval;
+    Solver<T> solver(layout, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, queue);
+    switch(method) {
+        case SolverCG:
+            *iterations = SolveCG<T>(solver, b_buffer, b_offset, tol, max_iterations, interval, residual);
+            break;
+        case SolverBiCGSTAB:
+            *iterations = SolveBiCGSTAB<T>(solver, b_buffer, b_offset, tol, max_iterations, interval, residual);
+            break;
+        default:
+            throw Error(CL_INVALID_VALUE, "Solve: unknown method");
+    }
+    Marker(*queue, event);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSsolve(const size_t method, const CLBlastLayout layout, const size_t n,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset,
+                                           cl_mem x_buffer, const size_t x_offset,
+                                           const float tol, const size_t max_iterations, const size_t check_interval,
+                                           size_t *iterations, float *residual,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Solve<float>(method, layout, n,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset,
+            x_buffer, x_offset,
+            tol, max_iterations, check_interval,
+            iterations, residual,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDsolve(const size_t method, const CLBlastLayout layout, const size_t n,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset,
+                                           cl_mem x_buffer, const size_t x_offset,
+                                           const double tol, const size_t max_iterations, const size_t check_interval,
+                                           size_t *iterations, double *residual,
+                                           cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        Solve<double>(method, layout, n,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset,
+            x_buffer, x_offset,
+            tol, max_iterations, check_interval,
+            iterations, residual,
+            queue, event);
+    });
+}
+}
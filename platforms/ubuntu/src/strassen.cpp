@@ -0,0 +1,315 @@
+#include "clkernels.h"
+#include <utility>
+
+//
+// Strassen-Winograd GEMM.
+//
+// Each level splits op(A), op(B) and C into 2x2 blocks and needs 7 block
+// products instead of 8:
+//
+//   S1 = A21+A22   S2 = S1-A11    S3 = A11-A21   S4 = A12-S2
+//   T1 = B12-B11   T2 = B22-T1    T3 = B22-B12   T4 = T2-B21
+//   P1 = A11*B11   P2 = A12*B21   P3 = S4*B22    P4 = A22*T4
+//   P5 = S1*T1     P6 = S2*T2     P7 = S3*T3
+//   C11 = P1+P2    C12 = P1+P6+P5+P3
+//   C21 = P1+P6+P7-P4              C22 = P1+P6+P7+P5
+//
+// The sums of a level are made by one kernel launch for A and one for B,
+// the products recurse down to "depth" levels and then use the flat GEMM
+// of CLBlast, and one kernel merges the products into C with alpha and beta.
+// All temporaries live in a single workspace allocated once per call.
+// Odd dimensions are peeled off and finished by flat GEMMs.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+// Blocks smaller than this are not worth another level.
+const size_t minBlockSize = 128;
+
+const char *strassenSource = R"CLC(
+#define AT(x,off,ld,trans,r,c) x[(off) + ((trans) ? (ulong)(c)*(ld)+(r) : (ulong)(r)*(ld)+(c))]
+
+// S1..S4 (mode 0) or T1..T4 (mode 1) for blocks of h x w
+__kernel void strassen_sums(
+    const int h, const int w, const int mode,
+    __global const REAL *x, const ulong x_offset, const int x_ld, const int trans,
+    __global REAL *ws, const ulong s_offset)
+{
+    const int c = get_global_id(0);
+    const int r = get_global_id(1);
+    if(r>=h || c>=w) {
+        return;
+    }
+    const REAL x11 = AT(x,x_offset,x_ld,trans,r,  c);
+    const REAL x12 = AT(x,x_offset,x_ld,trans,r,  c+w);
+    const REAL x21 = AT(x,x_offset,x_ld,trans,r+h,c);
+    const REAL x22 = AT(x,x_offset,x_ld,trans,r+h,c+w);
+    const ulong size = (ulong)h*w;
+    const ulong o = s_offset + (ulong)r*w + c;
+    if(mode==0) {
+        const REAL s1 = x21 + x22;
+        const REAL s2 = s1 - x11;
+        ws[o]        = s1;
+        ws[o+size]   = s2;
+        ws[o+2*size] = x11 - x21;
+        ws[o+3*size] = x12 - s2;
+    } else {
+        const REAL t1 = x12 - x11;
+        const REAL t2 = x22 - t1;
+        ws[o]        = t1;
+        ws[o+size]   = t2;
+        ws[o+2*size] = x22 - x12;
+        ws[o+3*size] = t2 - x21;
+    }
+}
+
+__kernel void strassen_merge(
+    const int h, const int w,
+    const REAL alpha, const REAL beta,
+    __global const REAL *ws, const ulong p_offset,
+    __global REAL *c, const ulong c_offset, const int c_ld)
+{
+    const int j = get_global_id(0);
+    const int i = get_global_id(1);
+    if(i>=h || j>=w) {
+        return;
+    }
+    const ulong size = (ulong)h*w;
+    const ulong o = p_offset + (ulong)i*w + j;
+    const REAL p1 = ws[o];
+    const REAL p2 = ws[o+size];
+    const REAL p3 = ws[o+2*size];
+    const REAL p4 = ws[o+3*size];
+    const REAL p5 = ws[o+4*size];
+    const REAL p6 = ws[o+5*size];
+    const REAL p7 = ws[o+6*size];
+    const REAL u2 = p1 + p6;
+    const REAL u3 = u2 + p7;
+    REAL v[4];
+    v[0] = p1 + p2;
+    v[1] = u2 + p5 + p3;
+    v[2] = u3 - p4;
+    v[3] = u3 + p5;
+    for(int q=0;q<4;q++) {
+        const ulong idx = c_offset + (ulong)(i+(q/2)*h)*c_ld + j+(q%2)*w;
+        REAL value = alpha*v[q];
+        if(beta!=0) {
+            value += beta*c[idx];
+        }
+        c[idx] = value;
+    }
+}
+)CLC";
+
+struct Operand {
+    cl_mem buffer;
+    size_t offset;
+    size_t ld;
+    bool trans;
+
+    // op(X) submatrix starting at (r,c)
+    Operand at(size_t r, size_t c) const
+    {
+        Operand sub = *this;
+        sub.offset += trans ? c*ld+r : r*ld+c;
+        return sub;
+    }
+    ::clblast::Transpose transpose() const
+    {
+        return trans ? ::clblast::Transpose::kYes : ::clblast::Transpose::kNo;
+    }
+};
+
+bool Recurse(size_t m, size_t n, size_t k, size_t depth)
+{
+    return depth>0 && m/2>=minBlockSize && n/2>=minBlockSize && k/2>=minBlockSize;
+}
+
+// workspace elements needed below a call of the given shape
+size_t WorkspaceSize(size_t m, size_t n, size_t k, size_t depth)
+{
+    if(!Recurse(m, n, k, depth)) {
+        return 0;
+    }
+    const size_t h = m/2, w = n/2, kk = k/2;
+    return 4*h*kk + 4*kk*w + 7*h*w + WorkspaceSize(h, w, kk, depth-1);
+}
+
+template <typename T>
+class Strassen {
+public:
+    Strassen(cl_command_queue *queue, cl_mem ws)
+        : queue_(queue), ws_(ws)
+    {
+        const std::string source = Preamble(PrecisionOf<T>()) + strassenSource;
+        sums_ = Kernel(*queue, source, "strassen_sums");
+        merge_ = Kernel(*queue, source, "strassen_merge");
+    }
+
+    // C(row major) := alpha*op(A)*op(B) + beta*C
+    void gemm(size_t m, size_t n, size_t k, T alpha,
+              const Operand &a, const Operand &b,
+              T beta, const Operand &c,
+              size_t depth, size_t ws_offset, cl_event *event)
+    {
+        if(!Recurse(m, n, k, depth)) {
+            flat(m, n, k, alpha, a, b, beta, c, event);
+            return;
+        }
+        // peel off odd rows, columns and depth
+        const size_t me = m & ~(size_t)1, ne = n & ~(size_t)1, ke = k & ~(size_t)1;
+        const bool peel = (me!=m || ne!=n || ke!=k);
+        level(me, ne, ke, alpha, a, b, beta, c, depth, ws_offset, peel ? nullptr : event);
+        if(ke!=k) {
+            const bool last = (ne==n && me==m);
+            flat(me, ne, 1, alpha, a.at(0,ke), b.at(ke,0), T(1), c, last ? event : nullptr);
+        }
+        if(ne!=n) {
+            const bool last = (me==m);
+            flat(m, 1, k, alpha, a, b.at(0,ne), beta, c.at(0,ne), last ? event : nullptr);
+        }
+        if(me!=m) {
+            flat(1, ne, k, alpha, a.at(me,0), b, beta, c.at(me,0), event);
+        }
+    }
+
+private:
+    void level(size_t m, size_t n, size_t k, T alpha,
+               const Operand &a, const Operand &b,
+               T beta, const Operand &c,
+               size_t depth, size_t ws_offset, cl_event *event)
+    {
+        const size_t h = m/2, w = n/2, kk = k/2;
+        const size_t s = ws_offset;          // S1..S4: h x kk
+        const size_t t = s + 4*h*kk;         // T1..T4: kk x w
+        const size_t p = t + 4*kk*w;         // P1..P7: h x w
+        const size_t next = p + 7*h*w;
+
+        Launch(*queue_, sums_, {kk, h}, {}, nullptr,
+            (cl_int)h, (cl_int)kk, (cl_int)0,
+            a.buffer, (cl_ulong)a.offset, (cl_int)a.ld, (cl_int)a.trans,
+            ws_, (cl_ulong)s);
+        Launch(*queue_, sums_, {w, kk}, {}, nullptr,
+            (cl_int)kk, (cl_int)w, (cl_int)1,
+            b.buffer, (cl_ulong)b.offset, (cl_int)b.ld, (cl_int)b.trans,
+            ws_, (cl_ulong)t);
+
+        auto S = [&](int i) { return Operand{ws_, s+(i-1)*h*kk, kk, false}; };
+        auto TT = [&](int i) { return Operand{ws_, t+(i-1)*kk*w, w, false}; };
+        auto P = [&](int i) { return Operand{ws_, p+(i-1)*h*w, w, false}; };
+
+        gemm(h, w, kk, T(1), a.at(0,0),  b.at(0,0),  T(0), P(1), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), a.at(0,kk), b.at(kk,0), T(0), P(2), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), S(4),       b.at(kk,w), T(0), P(3), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), a.at(h,kk), TT(4),      T(0), P(4), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), S(1),       TT(1),      T(0), P(5), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), S(2),       TT(2),      T(0), P(6), depth-1, next, nullptr);
+        gemm(h, w, kk, T(1), S(3),       TT(3),      T(0), P(7), depth-1, next, nullptr);
+
+        Launch(*queue_, merge_, {w, h}, {}, event,
+            (cl_int)h, (cl_int)w, alpha, beta,
+            ws_, (cl_ulong)p,
+            c.buffer, (cl_ulong)c.offset, (cl_int)c.ld);
+    }
+
+    void flat(size_t m, size_t n, size_t k, T alpha,
+              const Operand &a, const Operand &b,
+              T beta, const Operand &c, cl_event *event)
+    {
+        Check(::clblast::Gemm<T>(::clblast::Layout::kRowMajor, a.transpose(), b.transpose(),
+            m, n, k,
+            alpha,
+            a.buffer, a.offset, a.ld,
+            b.buffer, b.offset, b.ld,
+            beta,
+            c.buffer, c.offset, c.ld,
+            queue_, event), "Gemm");
+    }
+
+    cl_command_queue *queue_;
+    cl_mem ws_;
+    cl_kernel sums_;
+    cl_kernel merge_;
+};
+
+template <typename T>
+void GemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                  const size_t depth,
+                  cl_command_queue* queue, cl_event* event)
+{
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    if(a_ld < LeadingDimension(row_major, a_transpose, m, k) ||
+       b_ld < LeadingDimension(row_major, b_transpose, k, n) ||
+       c_ld < LeadingDimension(row_major, CLBlastTransposeNo, m, n)) {
+        throw Error(CL_INVALID_VALUE, "GemmStrassen: invalid leading dimension");
+    }
+    Operand a{a_buffer, a_offset, a_ld, a_transpose!=CLBlastTransposeNo};
+    Operand b{b_buffer, b_offset, b_ld, b_transpose!=CLBlastTransposeNo};
+    Operand c{c_buffer, c_offset, c_ld, false};
+    size_t rows = m, cols = n;
+    if(!row_major) {
+        // column-major C = op(A)*op(B) is row-major C^T = op(B)^T*op(A)^T
+        std::swap(a, b);
+        std::swap(rows, cols);
+    }
+    if(rows==0 || cols==0) {
+        Marker(*queue, event);
+        return;
+    }
+    Workspace workspace(*queue, WorkspaceSize(rows, cols, k, depth)*sizeof(T));
+    Strassen<T> strassen(queue, workspace.buffer());
+    strassen.gemm(rows, cols, k, alpha, a, b, beta, c, depth, 0, event);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const size_t depth,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmStrassen<float>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta,
+            c_buffer, c_offset, c_ld,
+            depth, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastDgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const size_t depth,
+                                                  cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        GemmStrassen<double>(layout, a_transpose, b_transpose, m, n, k,
+            alpha,
+            a_buffer, a_offset, a_ld,
+            b_buffer, b_offset, b_ld,
+            beta,
+            c_buffer, c_offset, c_ld,
+            depth, queue, event);
+    });
+}
+}
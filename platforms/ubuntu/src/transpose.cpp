@@ -0,0 +1,385 @@
+#include "clkernels.h"
+#include <algorithm>
+#include <vector>
+
+//
+// Batched and in-place matrix copy and transpose.
+//
+//   B[i] := alpha * op(A[i])   omatcopy of a batch, out of place
+//   A[i] := alpha * A[i]^T     square, in place
+//
+// The matrices of a batch are found by a stride from the first one or by
+// an array of offsets; with offsets each matrix also has its own alpha.
+// One launch handles the whole batch.
+//
+// A column-major matrix is the row-major matrix of its stored columns,
+// so the kernels work on stored rows and columns only. A tile is read
+// along the stored rows of A into local memory and written along the
+// stored rows of B, so a transpose reads and writes coalesced. Every
+// matrix must lie in its buffer, and no matrix of B may overlap another
+// matrix of B or of A.
+//
+// The in-place transpose swaps a tile above the diagonal with its mirror
+// below: the work-group of the pair reads both tiles before writing
+// either, so no extra buffer is needed. The work-groups below the
+// diagonal have nothing to do.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t tileSize = 32;
+const size_t tileRows = 8;
+
+const char *transposeSource = R"CLC(
+// rows x cols of A as stored; B is cols x rows when transposed
+__kernel void omatcopy_batched(
+    const int rows, const int cols, const int trans,
+    const REAL alpha,
+    __global const STORAGE *a, const ulong a_offset, const int lda, const ulong a_stride,
+    __global STORAGE *b, const ulong b_offset, const int ldb, const ulong b_stride,
+    __global const ulong *offsets, __global const STORAGE *alphas, const ulong batch_count)
+{
+    __local REAL tile[TILE][TILE+1];
+    const int lx = get_local_id(0);
+    const int ly = get_local_id(1);
+    const int c0 = get_group_id(0)*TILE;
+    const int r0 = get_group_id(1)*TILE;
+    const ulong batch = get_global_id(2);
+#if OFFSETS
+    const ulong ao = offsets[batch];
+    const ulong bo = offsets[batch_count+batch];
+    const REAL scale = LOAD(alphas, batch);
+#else
+    const ulong ao = a_offset + batch*a_stride;
+    const ulong bo = b_offset + batch*b_stride;
+    const REAL scale = alpha;
+#endif
+    for(int t=ly; t<TILE; t+=ROWS) {
+        const int r = r0 + t;
+        const int c = c0 + lx;
+        if(r<rows && c<cols) {
+            tile[t][lx] = LOAD(a, ao + (ulong)r*lda + c);
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int t=ly; t<TILE; t+=ROWS) {
+        if(trans) {
+            const int c = c0 + t;
+            const int r = r0 + lx;
+            if(r<rows && c<cols) {
+                STORE(scale*tile[lx][t], b, bo + (ulong)c*ldb + r);
+            }
+        } else {
+            const int r = r0 + t;
+            const int c = c0 + lx;
+            if(r<rows && c<cols) {
+                STORE(scale*tile[t][lx], b, bo + (ulong)r*ldb + c);
+            }
+        }
+    }
+}
+
+__kernel void transpose_inplace(
+    const int n, const REAL alpha,
+    __global STORAGE *a, const ulong a_offset, const int lda, const ulong a_stride)
+{
+    __local REAL upper[TILE][TILE+1];
+    __local REAL lower[TILE][TILE+1];
+    const int lx = get_local_id(0);
+    const int ly = get_local_id(1);
+    const int ti = get_group_id(1);
+    const int tj = get_group_id(0);
+    if(ti>tj) {
+        return;
+    }
+    const ulong ao = a_offset + get_global_id(2)*a_stride;
+    // upper is the tile (ti,tj) and lower the tile (tj,ti)
+    for(int t=ly; t<TILE; t+=ROWS) {
+        int r = ti*TILE + t;
+        int c = tj*TILE + lx;
+        if(r<n && c<n) {
+            upper[t][lx] = LOAD(a, ao + (ulong)r*lda + c);
+        }
+        r = tj*TILE + t;
+        c = ti*TILE + lx;
+        if(r<n && c<n) {
+            lower[t][lx] = LOAD(a, ao + (ulong)r*lda + c);
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int t=ly; t<TILE; t+=ROWS) {
+        int r = ti*TILE + t;
+        int c = tj*TILE + lx;
+        if(r<n && c<n) {
+            STORE(alpha*lower[lx][t], a, ao + (ulong)r*lda + c);
+        }
+        r = tj*TILE + t;
+        c = ti*TILE + lx;
+        if(ti!=tj && r<n && c<n) {
+            STORE(alpha*upper[lx][t], a, ao + (ulong)r*lda + c);
+        }
+    }
+}
+)CLC";
+
+template <typename T>
+std::string TransposeSource(const bool offsets, size_t &tile, size_t &rows, cl_command_queue queue)
+{
+    tile = tileSize;
+    rows = tileRows;
+    if(tile*rows>MaxWorkGroupSize(queue)) {
+        tile = 16;
+        rows = 4;
+    }
+    return Preamble(PrecisionOf<T>()) +
+        "#define OFFSETS " + (offsets ? "1" : "0") + "\n" +
+        "#define TILE " + std::to_string(tile) + "\n" +
+        "#define ROWS " + std::to_string(rows) + "\n" +
+        transposeSource;
+}
+
+struct StoredShape {
+    size_t rows, cols;
+    bool trans;
+};
+
+StoredShape Stored(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                   const size_t m, const size_t n, const size_t a_ld, const size_t b_ld)
+{
+    const bool row_major = (layout==CLBlastLayoutRowMajor);
+    const StoredShape shape = {row_major ? m : n, row_major ? n : m, a_transpose!=CLBlastTransposeNo};
+    const size_t b_cols = shape.trans ? shape.rows : shape.cols;
+    if(a_ld < shape.cols || b_ld < b_cols) {
+        throw Error(CL_INVALID_VALUE, "Omatcopy: invalid leading dimension");
+    }
+    return shape;
+}
+
+//
+// Check the matrices of A and B at their offsets against the buffers.
+// The matrices of B must not share a location with each other or with
+// a matrix of A; a matrix is taken as the range from its first to its
+// last element.
+//
+void CheckMatrices(const StoredShape &shape, const size_t element_size, const size_t batch_count,
+                   const cl_mem a_buffer, const cl_ulong *a_offsets, const size_t a_ld,
+                   const cl_mem b_buffer, const cl_ulong *b_offsets, const size_t b_ld)
+{
+    const size_t a_shape[] = {shape.rows, shape.cols};
+    const size_t b_shape[] = {shape.trans ? shape.cols : shape.rows, shape.trans ? shape.rows : shape.cols};
+    const cl_long a_strides[] = {(cl_long)a_ld, 1};
+    const cl_long b_strides[] = {(cl_long)b_ld, 1};
+    std::vector<std::pair<cl_long,cl_long>> a_ranges(batch_count);
+    std::vector<std::pair<cl_long,cl_long>> b_ranges(batch_count);
+    for(size_t i=0; i<batch_count; i++) {
+        a_ranges[i] = Extent(a_offsets[i], 2, a_shape, a_strides);
+        b_ranges[i] = Extent(b_offsets[i], 2, b_shape, b_strides);
+    }
+    std::sort(a_ranges.begin(), a_ranges.end());
+    std::sort(b_ranges.begin(), b_ranges.end());
+    // the matrix of the highest offset reaches the furthest
+    CheckBuffer("Omatcopy", "A", a_buffer, element_size, a_ranges.back().first, 2, a_shape, a_strides,
+        CLBlastInsufficientMemoryA);
+    CheckBuffer("Omatcopy", "B", b_buffer, element_size, b_ranges.back().first, 2, b_shape, b_strides,
+        CLBlastInsufficientMemoryB);
+    for(size_t i=1; i<batch_count; i++) {
+        if(b_ranges[i].first<=b_ranges[i-1].second) {
+            throw Error(CL_INVALID_VALUE, "Omatcopy: matrices of B overlap");
+        }
+    }
+    if(a_buffer!=b_buffer) {
+        return;
+    }
+    size_t i = 0;
+    for(const auto &b : b_ranges) {
+        while(i<batch_count && a_ranges[i].second<b.first) {
+            i++;
+        }
+        if(i<batch_count && a_ranges[i].first<=b.second) {
+            throw Error(CL_INVALID_VALUE, "Omatcopy: A and B overlap");
+        }
+    }
+}
+
+template <typename T>
+void OmatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                            const size_t m, const size_t n, const T alpha,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                            const size_t batch_count,
+                            cl_command_queue* queue, cl_event* event)
+{
+    const StoredShape shape = Stored(layout, a_transpose, m, n, a_ld, b_ld);
+    if(m==0 || n==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    std::vector<cl_ulong> a_offsets(batch_count);
+    std::vector<cl_ulong> b_offsets(batch_count);
+    for(size_t i=0; i<batch_count; i++) {
+        a_offsets[i] = a_offset + i*a_stride;
+        b_offsets[i] = b_offset + i*b_stride;
+    }
+    CheckMatrices(shape, sizeof(T), batch_count,
+        a_buffer, a_offsets.data(), a_ld, b_buffer, b_offsets.data(), b_ld);
+    size_t tile, rows;
+    const std::string source = TransposeSource<T>(false, tile, rows, *queue);
+    // offsets and alphas are not read
+    Launch(*queue, Kernel(*queue, source, "omatcopy_batched"),
+        {CeilDiv(shape.cols, tile)*tile, CeilDiv(shape.rows, tile)*rows, batch_count}, {tile, rows, 1}, event,
+        (cl_int)shape.rows, (cl_int)shape.cols, (cl_int)shape.trans,
+        alpha,
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride,
+        b_buffer, (cl_ulong)b_offset, (cl_int)b_ld, (cl_ulong)b_stride,
+        a_buffer, a_buffer, (cl_ulong)batch_count);
+}
+
+template <typename T>
+void OmatcopyBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                     const size_t m, const size_t n, const T *alphas,
+                     const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                     cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                     const size_t batch_count,
+                     cl_command_queue* queue, cl_event* event)
+{
+    const StoredShape shape = Stored(layout, a_transpose, m, n, a_ld, b_ld);
+    if(m==0 || n==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    // the offsets of A and B, then alphas
+    std::vector<cl_ulong> offsets(2*batch_count);
+    for(size_t i=0; i<batch_count; i++) {
+        offsets[i] = a_offsets[i];
+        offsets[batch_count+i] = b_offsets[i];
+    }
+    CheckMatrices(shape, sizeof(T), batch_count,
+        a_buffer, offsets.data(), a_ld, b_buffer, offsets.data()+batch_count, b_ld);
+    Workspace offsets_buffer(*queue, offsets.size()*sizeof(cl_ulong));
+    Workspace alphas_buffer(*queue, batch_count*sizeof(T));
+    CheckCL(clEnqueueWriteBuffer(*queue, offsets_buffer.buffer(), CL_TRUE, 0,
+        offsets.size()*sizeof(cl_ulong), offsets.data(), 0, nullptr, nullptr), "clEnqueueWriteBuffer");
+    CheckCL(clEnqueueWriteBuffer(*queue, alphas_buffer.buffer(), CL_TRUE, 0,
+        batch_count*sizeof(T), alphas, 0, nullptr, nullptr), "clEnqueueWriteBuffer");
+    size_t tile, rows;
+    const std::string source = TransposeSource<T>(true, tile, rows, *queue);
+    Launch(*queue, Kernel(*queue, source, "omatcopy_batched"),
+        {CeilDiv(shape.cols, tile)*tile, CeilDiv(shape.rows, tile)*rows, batch_count}, {tile, rows, 1}, event,
+        (cl_int)shape.rows, (cl_int)shape.cols, (cl_int)shape.trans,
+        T(0),
+        a_buffer, (cl_ulong)0, (cl_int)a_ld, (cl_ulong)0,
+        b_buffer, (cl_ulong)0, (cl_int)b_ld, (cl_ulong)0,
+        offsets_buffer.buffer(), alphas_buffer.buffer(), (cl_ulong)batch_count);
+}
+
+template <typename T>
+void TransposeInPlace(const size_t n, const T alpha,
+                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event)
+{
+    if(a_ld < n) {
+        throw Error(CL_INVALID_VALUE, "TransposeInPlace: invalid leading dimension");
+    }
+    if(batch_count>1 && a_stride < (n-1)*a_ld+n) {
+        throw Error(CL_INVALID_VALUE, "TransposeInPlace: matrices of the batch overlap");
+    }
+    if(n==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t shape[] = {batch_count, n, n};
+    const cl_long strides[] = {(cl_long)a_stride, (cl_long)a_ld, 1};
+    CheckBuffer("TransposeInPlace", "A", a_buffer, sizeof(T), a_offset, 3, shape, strides);
+    size_t tile, rows;
+    const std::string source = TransposeSource<T>(false, tile, rows, *queue);
+    const size_t tiles = CeilDiv(n, tile);
+    Launch(*queue, Kernel(*queue, source, "transpose_inplace"),
+        {tiles*tile, tiles*rows, batch_count}, {tile, rows, 1}, event,
+        (cl_int)n, alpha,
+        a_buffer, (cl_ulong)a_offset, (cl_int)a_ld, (cl_ulong)a_stride);
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n, const float alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        OmatcopyStridedBatched<float>(layout, a_transpose, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n, const double alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        OmatcopyStridedBatched<double>(layout, a_transpose, m, n, alpha,
+            a_buffer, a_offset, a_ld, a_stride,
+            b_buffer, b_offset, b_ld, b_stride,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSomatcopyBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                     const size_t m, const size_t n, const float *alphas,
+                                                     const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                     cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                     const size_t batch_count,
+                                                     cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        OmatcopyBatched<float>(layout, a_transpose, m, n, alphas,
+            a_buffer, a_offsets, a_ld,
+            b_buffer, b_offsets, b_ld,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDomatcopyBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                     const size_t m, const size_t n, const double *alphas,
+                                                     const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                     cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                     const size_t batch_count,
+                                                     cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        OmatcopyBatched<double>(layout, a_transpose, m, n, alphas,
+            a_buffer, a_offsets, a_ld,
+            b_buffer, b_offsets, b_ld,
+            batch_count, queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastStransposeInPlace(const size_t n, const float alpha,
+                                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                      const size_t batch_count,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TransposeInPlace<float>(n, alpha, a_buffer, a_offset, a_ld, a_stride,
+            batch_count, queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDtransposeInPlace(const size_t n, const double alpha,
+                                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                      const size_t batch_count,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        TransposeInPlace<double>(n, alpha, a_buffer, a_offset, a_ld, a_stride,
+            batch_count, queue, event);
+    });
+}
+}
@@ -0,0 +1,401 @@
+#include "clkernels.h"
+#include <algorithm>
+
+//
+// Convolution with a 3x3 kernel and a stride of 1 by the Winograd
+// minimal filtering algorithm F(m x m, 3 x 3), m = 2 or 4.
+//
+// The layouts and the kernel modes are those of Convgemm of CLBlast.
+// Each output tile of m x m is computed from an input tile of
+// a x a (a = m+2) as
+//
+//   Y = A^T [ sum_c (G g G^T) .* (B^T d B) ] A
+//
+// The filter, input and output transforms are kernels here, and the sum
+// over the channels is one GemmStridedBatched of CLBlast of a*a products
+//
+//   M[xi] (num_kernels x tiles) = U[xi] (num_kernels x channels) * V[xi] (channels x tiles)
+//
+// F(2x2,3x3) does 16 multiplies per 4 outputs and F(4x4,3x3) 36 per 16,
+// against 36 and 144 by the direct method.
+//
+// The transformed filter U can be made once by the filter transform and
+// passed back for later calls, so layers with fixed weights skip it.
+//
+namespace {
+
+using namespace rindow::clblast;
+
+const size_t workspaceLimit = 256 << 20;   // bytes of V and M (and U) per call
+
+const char *winogradSource = R"CLC(
+#if TILE_M==2
+#define ALPHA 4
+__constant REAL BT[4][4] = {
+    { 1, 0,-1, 0},
+    { 0, 1, 1, 0},
+    { 0,-1, 1, 0},
+    { 0, 1, 0,-1},
+};
+__constant REAL G[4][3] = {
+    { 1,    0,    0  },
+    { 0.5,  0.5,  0.5},
+    { 0.5, -0.5,  0.5},
+    { 0,    0,    1  },
+};
+__constant REAL AT[2][4] = {
+    { 1, 1, 1, 0},
+    { 0, 1,-1,-1},
+};
+#else
+#define ALPHA 6
+__constant REAL BT[6][6] = {
+    { 4, 0,-5, 0, 1, 0},
+    { 0,-4,-4, 1, 1, 0},
+    { 0, 4,-4,-1, 1, 0},
+    { 0,-2,-1, 2, 1, 0},
+    { 0, 2,-1,-2, 1, 0},
+    { 0, 4, 0,-5, 0, 1},
+};
+__constant REAL G[6][3] = {
+    { 1.0/4,     0,       0     },
+    {-1.0/6,  -1.0/6,  -1.0/6   },
+    {-1.0/6,   1.0/6,  -1.0/6   },
+    { 1.0/24,  1.0/12,  1.0/6   },
+    { 1.0/24, -1.0/12,  1.0/6   },
+    { 0,       0,       1       },
+};
+__constant REAL AT[4][6] = {
+    { 1, 1, 1, 1, 1, 0},
+    { 0, 1,-1, 2,-2, 0},
+    { 0, 1, 1, 4, 4, 0},
+    { 0, 1,-1, 8,-8, 1},
+};
+#endif
+
+// U[xi][k][c] = (G g G^T)[xi]
+__kernel void winograd_filter(
+    const int channels, const int num_kernels, const int convolution,
+    __global const REAL *w, const ulong w_offset,
+    __global REAL *u, const ulong u_offset)
+{
+    const int c = get_global_id(0);
+    const int k = get_global_id(1);
+    if(c>=channels || k>=num_kernels) {
+        return;
+    }
+    const ulong wo = w_offset + ((ulong)k*channels + c)*9;
+    REAL g[3][3];
+    for(int i=0; i<3; i++) {
+        for(int j=0; j<3; j++) {
+            g[i][j] = convolution ? w[wo + (2-i)*3 + (2-j)] : w[wo + i*3 + j];
+        }
+    }
+    REAL t[ALPHA][3];
+    for(int i=0; i<ALPHA; i++) {
+        for(int j=0; j<3; j++) {
+            t[i][j] = G[i][0]*g[0][j] + G[i][1]*g[1][j] + G[i][2]*g[2][j];
+        }
+    }
+    const ulong plane = (ulong)num_kernels*channels;
+    for(int i=0; i<ALPHA; i++) {
+        for(int j=0; j<ALPHA; j++) {
+            const REAL v = t[i][0]*G[j][0] + t[i][1]*G[j][1] + t[i][2]*G[j][2];
+            u[u_offset + (i*ALPHA+j)*plane + (ulong)k*channels + c] = v;
+        }
+    }
+}
+
+// V[xi][c][p] = (B^T d B)[xi] of the input tile first+p
+__kernel void winograd_input(
+    const int channels, const int height, const int width,
+    const int pad_h, const int pad_w,
+    const int tiles_h, const int tiles_w, const int first, const int tiles,
+    __global const REAL *im, const ulong im_offset,
+    __global REAL *v, const ulong v_offset)
+{
+    const int p = get_global_id(0);
+    const int c = get_global_id(1);
+    if(p>=tiles || c>=channels) {
+        return;
+    }
+    const int b = (first+p) / (tiles_h*tiles_w);
+    const int t = (first+p) % (tiles_h*tiles_w);
+    const int y0 = (t / tiles_w)*TILE_M - pad_h;
+    const int x0 = (t % tiles_w)*TILE_M - pad_w;
+    const ulong io = im_offset + ((ulong)b*channels + c)*height*width;
+    REAL d[ALPHA][ALPHA];
+    for(int i=0; i<ALPHA; i++) {
+        for(int j=0; j<ALPHA; j++) {
+            const int y = y0+i;
+            const int x = x0+j;
+            d[i][j] = (y>=0 && y<height && x>=0 && x<width) ? im[io + (ulong)y*width + x] : (REAL)0;
+        }
+    }
+    REAL s[ALPHA][ALPHA];
+    for(int i=0; i<ALPHA; i++) {
+        for(int j=0; j<ALPHA; j++) {
+            REAL acc = 0;
+            for(int l=0; l<ALPHA; l++) {
+                acc += BT[i][l]*d[l][j];
+            }
+            s[i][j] = acc;
+        }
+    }
+    const ulong plane = (ulong)channels*tiles;
+    for(int i=0; i<ALPHA; i++) {
+        for(int j=0; j<ALPHA; j++) {
+            REAL acc = 0;
+            for(int l=0; l<ALPHA; l++) {
+                acc += s[i][l]*BT[j][l];
+            }
+            v[v_offset + (i*ALPHA+j)*plane + (ulong)c*tiles + p] = acc;
+        }
+    }
+}
+
+// result tile first+p of kernel k = A^T M A
+__kernel void winograd_output(
+    const int num_kernels, const int output_h, const int output_w,
+    const int tiles_h, const int tiles_w, const int first, const int tiles,
+    __global const REAL *m, const ulong m_offset,
+    __global REAL *result, const ulong result_offset)
+{
+    const int p = get_global_id(0);
+    const int k = get_global_id(1);
+    if(p>=tiles || k>=num_kernels) {
+        return;
+    }
+    const ulong plane = (ulong)num_kernels*tiles;
+    REAL s[TILE_M][ALPHA];
+    for(int j=0; j<ALPHA; j++) {
+        REAL col[ALPHA];
+        for(int l=0; l<ALPHA; l++) {
+            col[l] = m[m_offset + (l*ALPHA+j)*plane + (ulong)k*tiles + p];
+        }
+        for(int i=0; i<TILE_M; i++) {
+            REAL acc = 0;
+            for(int l=0; l<ALPHA; l++) {
+                acc += AT[i][l]*col[l];
+            }
+            s[i][j] = acc;
+        }
+    }
+    const int b = (first+p) / (tiles_h*tiles_w);
+    const int t = (first+p) % (tiles_h*tiles_w);
+    const int y0 = (t / tiles_w)*TILE_M;
+    const int x0 = (t % tiles_w)*TILE_M;
+    const ulong ro = result_offset + ((ulong)b*num_kernels + k)*output_h*output_w;
+    for(int i=0; i<TILE_M; i++) {
+        for(int j=0; j<TILE_M; j++) {
+            if(y0+i<output_h && x0+j<output_w) {
+                REAL acc = 0;
+                for(int l=0; l<ALPHA; l++) {
+                    acc += s[i][l]*AT[j][l];
+                }
+                result[ro + (ulong)(y0+i)*output_w + x0+j] = acc;
+            }
+        }
+    }
+}
+)CLC";
+
+size_t TileSize(const size_t tile, const size_t output_h, const size_t output_w)
+{
+    if(tile==0) {
+        // the larger tile wastes work on the border of small outputs
+        return (output_h>=8 && output_w>=8) ? 4 : 2;
+    }
+    if(tile!=2 && tile!=4) {
+        throw Error(CL_INVALID_VALUE, "Winograd: tile must be 0, 2 or 4");
+    }
+    return tile;
+}
+
+template <typename T>
+std::string WinogradSource(const size_t tile)
+{
+    return Preamble(PrecisionOf<T>()) +
+        "#define TILE_M " + std::to_string(tile) + "\n" +
+        winogradSource;
+}
+
+template <typename T>
+void FilterTransform(const size_t tile, const CLBlastKernelMode kernel_mode,
+                     const size_t channels, const size_t num_kernels,
+                     const cl_mem kernel_buffer, const size_t kernel_offset,
+                     cl_mem u_buffer, const size_t u_offset,
+                     cl_command_queue* queue, cl_event* event)
+{
+    Launch(*queue, Kernel(*queue, WinogradSource<T>(tile), "winograd_filter"),
+        {channels, num_kernels}, {}, event,
+        (cl_int)channels, (cl_int)num_kernels, (cl_int)(kernel_mode==CLBlastKernelModeConvolution),
+        kernel_buffer, (cl_ulong)kernel_offset,
+        u_buffer, (cl_ulong)u_offset);
+}
+
+template <typename T>
+void WinogradFilter(const CLBlastKernelMode kernel_mode, const size_t tile,
+                    const size_t channels, const size_t num_kernels,
+                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                    cl_mem transformed_buffer, const size_t transformed_offset,
+                    cl_command_queue* queue, cl_event* event)
+{
+    if(tile!=2 && tile!=4) {
+        throw Error(CL_INVALID_VALUE, "WinogradFilter: tile must be 2 or 4");
+    }
+    if(channels==0 || num_kernels==0) {
+        Marker(*queue, event);
+        return;
+    }
+    FilterTransform<T>(tile, kernel_mode, channels, num_kernels,
+        kernel_buffer, kernel_offset, transformed_buffer, transformed_offset,
+        queue, event);
+}
+
+template <typename T>
+void ConvgemmWinograd(const CLBlastKernelMode kernel_mode, const size_t tile_m,
+                      const size_t channels, const size_t height, const size_t width,
+                      const size_t pad_h, const size_t pad_w,
+                      const size_t num_kernels, const size_t batch_count,
+                      const cl_mem im_buffer, const size_t im_offset,
+                      const cl_mem kernel_buffer, const size_t kernel_offset, const bool kernel_transformed,
+                      cl_mem result_buffer, const size_t result_offset,
+                      cl_command_queue* queue, cl_event* event)
+{
+    if(height+2*pad_h<3 || width+2*pad_w<3 || num_kernels==0 || batch_count==0) {
+        Marker(*queue, event);
+        return;
+    }
+    const size_t output_h = height+2*pad_h-2;
+    const size_t output_w = width+2*pad_w-2;
+    const size_t tile = TileSize(tile_m, output_h, output_w);
+    if(kernel_transformed && tile_m==0) {
+        throw Error(CL_INVALID_VALUE, "ConvgemmWinograd: the tile of a transformed kernel must be given");
+    }
+    const size_t alpha = tile+2;
+    const size_t tiles_h = CeilDiv(output_h, tile);
+    const size_t tiles_w = CeilDiv(output_w, tile);
+    const size_t tiles = batch_count*tiles_h*tiles_w;
+    if(channels==0) {
+        const T zero = 0;
+        CheckCL(clEnqueueFillBuffer(*queue, result_buffer, &zero, sizeof(T), result_offset*sizeof(T),
+            batch_count*num_kernels*output_h*output_w*sizeof(T), 0, nullptr, event), "clEnqueueFillBuffer");
+        return;
+    }
+
+    // workspace layout: U (unless transformed) | V | M
+    // V and M are made for a chunk of the tiles at a time, so that the
+    // workspace stays under workspaceLimit and the largest allocation
+    // of the device however large the batch is.
+    const size_t planes = alpha*alpha;
+    const size_t u = 0;
+    const size_t v = kernel_transformed ? 0 : planes*num_kernels*channels;
+    const size_t per_tile = planes*(channels+num_kernels);
+    const size_t limit = std::min(workspaceLimit, MaxMemAllocSize(*queue))/sizeof(T);
+    const size_t chunk = std::min(tiles, std::max<size_t>(1, limit>v ? (limit-v)/per_tile : 0));
+    const size_t m = v + planes*channels*chunk;
+    Workspace workspace(*queue, (m + planes*num_kernels*chunk)*sizeof(T));
+    cl_mem w = workspace.buffer();
+    const cl_mem u_buffer = kernel_transformed ? kernel_buffer : w;
+    const size_t u_offset = kernel_transformed ? kernel_offset : u;
+
+    const std::string source = WinogradSource<T>(tile);
+    if(!kernel_transformed) {
+        FilterTransform<T>(tile, kernel_mode, channels, num_kernels,
+            kernel_buffer, kernel_offset, w, u, queue, nullptr);
+    }
+    for(size_t first=0; first<tiles; first+=chunk) {
+        const size_t count = std::min(chunk, tiles-first);
+        Launch(*queue, Kernel(*queue, source, "winograd_input"), {count, channels}, {}, nullptr,
+            (cl_int)channels, (cl_int)height, (cl_int)width,
+            (cl_int)pad_h, (cl_int)pad_w,
+            (cl_int)tiles_h, (cl_int)tiles_w, (cl_int)first, (cl_int)count,
+            im_buffer, (cl_ulong)im_offset,
+            w, (cl_ulong)v);
+        Check(::clblast::GemmStridedBatched<T>(
+            ::clblast::Layout::kRowMajor, ::clblast::Transpose::kNo, ::clblast::Transpose::kNo,
+            num_kernels, count, channels,
+            T(1),
+            u_buffer, u_offset, channels, num_kernels*channels,
+            w, v, count, channels*count,
+            T(0),
+            w, m, count, num_kernels*count,
+            planes,
+            queue, nullptr), "GemmStridedBatched");
+        Launch(*queue, Kernel(*queue, source, "winograd_output"), {count, num_kernels}, {},
+            first+count==tiles ? event : nullptr,
+            (cl_int)num_kernels, (cl_int)output_h, (cl_int)output_w,
+            (cl_int)tiles_h, (cl_int)tiles_w, (cl_int)first, (cl_int)count,
+            w, (cl_ulong)m,
+            result_buffer, (cl_ulong)result_offset);
+    }
+}
+
+} // namespace
+
+extern "C" {
+CLBlastStatusCode RindowCLBlastSwinogradFilter(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                    const size_t channels, const size_t num_kernels,
+                                                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                    cl_mem transformed_buffer, const size_t transformed_offset,
+                                                    cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        WinogradFilter<float>(kernel_mode, tile, channels, num_kernels,
+            kernel_buffer, kernel_offset,
+            transformed_buffer, transformed_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDwinogradFilter(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                    const size_t channels, const size_t num_kernels,
+                                                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                                                    cl_mem transformed_buffer, const size_t transformed_offset,
+                                                    cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        WinogradFilter<double>(kernel_mode, tile, channels, num_kernels,
+            kernel_buffer, kernel_offset,
+            transformed_buffer, transformed_offset,
+            queue, event);
+    });
+}
+
+CLBlastStatusCode RindowCLBlastSconvgemmWinograd(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                      const size_t channels, const size_t height, const size_t width,
+                                                      const size_t pad_h, const size_t pad_w,
+                                                      const size_t num_kernels, const size_t batch_count,
+                                                      const cl_mem im_buffer, const size_t im_offset,
+                                                      const cl_mem kernel_buffer, const size_t kernel_offset, const int kernel_transformed,
+                                                      cl_mem result_buffer, const size_t result_offset,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmWinograd<float>(kernel_mode, tile, channels, height, width, pad_h, pad_w,
+            num_kernels, batch_count,
+            im_buffer, im_offset,
+            kernel_buffer, kernel_offset, kernel_transformed!=0,
+            result_buffer, result_offset,
+            queue, event);
+    });
+}
+CLBlastStatusCode RindowCLBlastDconvgemmWinograd(const CLBlastKernelMode kernel_mode, const size_t tile,
+                                                      const size_t channels, const size_t height, const size_t width,
+                                                      const size_t pad_h, const size_t pad_w,
+                                                      const size_t num_kernels, const size_t batch_count,
+                                                      const cl_mem im_buffer, const size_t im_offset,
+                                                      const cl_mem kernel_buffer, const size_t kernel_offset, const int kernel_transformed,
+                                                      cl_mem result_buffer, const size_t result_offset,
+                                                      cl_command_queue* queue, cl_event* event)
+{
+    return Invoke([&]{
+        ConvgemmWinograd<double>(kernel_mode, tile, channels, height, width, pad_h, pad_w,
+            num_kernels, batch_count,
+            im_buffer, im_offset,
+            kernel_buffer, kernel_offset, kernel_transformed!=0,
+            result_buffer, result_offset,
+            queue, event);
+    });
+}
+}
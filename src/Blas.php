@@ -9,6 +9,7 @@ use FFI;
 use Rindow\OpenCL\FFI\Buffer as DeviceBuffer;
 use Rindow\OpenCL\FFI\CommandQueue;
 use Rindow\OpenCL\FFI\EventList;
+use Rindow\CLBlast\FFI\Platforms\LinuxPatch;
 
 
 class Blas
@@ -17,6 +18,12 @@ class Blas
 
     const CLBlastSuccess = 0;
     const CLBlastNotImplemented = -1024;
+    const EPILOGUE_BIAS_NONE = 0;
+    const EPILOGUE_BIAS_ROW = 1;
+    const EPILOGUE_BIAS_COLUMN = 2;
+    const ACTIVATION_NONE = 0;
+    const ACTIVATION_RELU = 1;
+    const ACTIVATION_GELU = 2;
     protected FFI $ffi;
     protected object $alt;
 
@@ -90,6 +97,76 @@ class Blas
         }
     }
 
+    /**
+     *  X := alpha * X
+     *  alpha is read from the device buffer at offsetAlpha.
+     *  X must hold n elements at incX past offsetX.
+     */
+    public function scalDeviceScalar(
+        int $n,
+        DeviceBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $X, int $offsetX, int $incX,
+        CommandQueue $queue,
+        ?EventList $event=null
+        ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('scalDeviceScalar');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetAlpha<0) {
+            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($incX<=0) {
+            throw new InvalidArgumentException("incX must be greater than zero");
+        }
+        if($alpha->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for alpha and X");
+        }
+        $bufferAlpha_p = $ffi->cast("cl_mem",$alpha->_getId());
+        $bufferX_p = $ffi->cast("cl_mem",$X->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSscalDeviceScalar(
+                    $n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferX_p,$offsetX,$incX,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDscalDeviceScalar(
+                    $n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferX_p,$offsetX,$incX,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?scalDeviceScalar error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
     /**
      *  Y := alpha * X + Y
      */
@@ -164,6 +241,89 @@ class Blas
         }
     }
 
+    /**
+     *  Y := alpha * X + Y
+     *  alpha is read from the device buffer at offsetAlpha.
+     *  X and Y must hold n elements at incX and incY past their offsets.
+     */
+    public function axpyDeviceScalar(
+        int $n,
+        DeviceBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $X, int $offsetX, int $incX,
+        DeviceBuffer $Y, int $offsetY, int $incY,
+        CommandQueue $queue,
+        ?EventList $event=null
+        ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('axpyDeviceScalar');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetAlpha<0) {
+            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($incX<=0) {
+            throw new InvalidArgumentException("incX must be greater than zero");
+        }
+        if($incY<=0) {
+            throw new InvalidArgumentException("incY must be greater than zero");
+        }
+        if($alpha->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for alpha and X");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        $bufferAlpha_p = $ffi->cast("cl_mem",$alpha->_getId());
+        $bufferX_p = $ffi->cast("cl_mem",$X->_getId());
+        $bufferY_p = $ffi->cast("cl_mem",$Y->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSaxpyDeviceScalar(
+                    $n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferX_p,$offsetX,$incX,
+                    $bufferY_p,$offsetY,$incY,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDaxpyDeviceScalar(
+                    $n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferX_p,$offsetX,$incX,
+                    $bufferY_p,$offsetY,$incY,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?axpyDeviceScalar error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
     public function dot(
         int $n,
         DeviceBuffer $R, int $offsetR,
@@ -1131,6 +1291,88 @@ class Blas
         }
     }
 
+    /**
+     *  Y := alpha * op(A) * X + beta * Y
+     *  alpha and beta are read from the device buffers.
+     */
+    public function gemvDeviceScalar(
+        int $order,
+        int $trans,
+        int $m,
+        int $n,
+        DeviceBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $X, int $offsetX, int $incX,
+        DeviceBuffer $beta, int $offsetBeta,
+        DeviceBuffer $Y, int $offsetY, int $incY,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('gemvDeviceScalar');
+        if($A->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and X");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        if($alpha->dtype()!=$A->dtype() || $beta->dtype()!=$A->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for alpha, beta and A");
+        }
+        $bufferAlpha_p = $ffi->cast("cl_mem",$alpha->_getId());
+        $bufferA_p = $ffi->cast("cl_mem",$A->_getId());
+        $bufferX_p = $ffi->cast("cl_mem",$X->_getId());
+        $bufferBeta_p = $ffi->cast("cl_mem",$beta->_getId());
+        $bufferY_p = $ffi->cast("cl_mem",$Y->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemvDeviceScalar(
+                    $order,
+                    $trans,
+                    $m,$n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferX_p,$offsetX,$incX,
+                    $bufferBeta_p,$offsetBeta,
+                    $bufferY_p,$offsetY,$incY,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemvDeviceScalar(
+                    $order,
+                    $trans,
+                    $m,$n,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferX_p,$offsetX,$incX,
+                    $bufferBeta_p,$offsetBeta,
+                    $bufferY_p,$offsetY,$incY,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemvDeviceScalar error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
     public function gemm(
         int $order,
         int $transA,
@@ -1250,6 +1492,410 @@ class Blas
         }
     }
 
+    /**
+     *  C := alpha * op(A) * op(B) + beta * C
+     *  alpha and beta are read from the device buffers.
+     *  k=0 gives C := beta * C.
+     */
+    public function gemmDeviceScalar(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        DeviceBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        DeviceBuffer $beta, int $offsetBeta,
+        DeviceBuffer $C, int $offsetC, int $ldC,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('gemmDeviceScalar');
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        if($A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and C");
+        }
+        if($alpha->dtype()!=$A->dtype() || $beta->dtype()!=$A->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for alpha, beta and A");
+        }
+        $bufferAlpha_p = $ffi->cast("cl_mem",$alpha->_getId());
+        $bufferA_p = $ffi->cast("cl_mem",$A->_getId());
+        $bufferB_p = $ffi->cast("cl_mem",$B->_getId());
+        $bufferBeta_p = $ffi->cast("cl_mem",$beta->_getId());
+        $bufferC_p = $ffi->cast("cl_mem",$C->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemmDeviceScalar(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $bufferBeta_p,$offsetBeta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemmDeviceScalar(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $bufferAlpha_p,$offsetAlpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $bufferBeta_p,$offsetBeta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmDeviceScalar error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C := act(alpha * op(A) * op(B) + beta * C + bias)
+     *  biasMode is EPILOGUE_BIAS_NONE, EPILOGUE_BIAS_ROW (bias of m elements)
+     *  or EPILOGUE_BIAS_COLUMN (bias of n elements). The bias must hold them past offsetBias.
+     *  activation is ACTIVATION_NONE, ACTIVATION_RELU or ACTIVATION_GELU.
+     *  The bias and activation run in one pass over C right after the GEMM.
+     */
+    public function gemmEpilogue(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        float $beta,
+        DeviceBuffer $C, int $offsetC, int $ldC,
+        int $biasMode,
+        ?DeviceBuffer $bias, int $offsetBias,
+        int $activation,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('gemmEpilogue');
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        if($A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and C");
+        }
+        if($biasMode==self::EPILOGUE_BIAS_NONE) {
+            $bias = $C;
+            $offsetBias = 0;
+        } elseif($bias===null) {
+            throw new InvalidArgumentException("bias is required for the bias mode");
+        } elseif($bias->dtype()!=$A->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for bias and A");
+        }
+        if($offsetBias<0) {
+            throw new InvalidArgumentException("offsetBias must be greater than zero or equal");
+        }
+        $bufferA_p = $ffi->cast("cl_mem",$A->_getId());
+        $bufferB_p = $ffi->cast("cl_mem",$B->_getId());
+        $bufferC_p = $ffi->cast("cl_mem",$C->_getId());
+        $bufferBias_p = $ffi->cast("cl_mem",$bias->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemmEpilogue(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $biasMode,$bufferBias_p,$offsetBias,
+                    $activation,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemmEpilogue(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $biasMode,$bufferBias_p,$offsetBias,
+                    $activation,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmEpilogue error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C := alpha * op(A) * op(B) + beta * C
+     *  Complex matrices are multiplied by the 3M (Gauss) algorithm,
+     *  that is three real GEMMs on the real and imaginary planes instead
+     *  of a complex GEMM. It needs about 25% fewer flops at the cost of
+     *  a little accuracy.
+     *  Real matrices, and the platforms without librindowclblast, are
+     *  calculated by gemm().
+     */
+    public function gemm3m(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        float|object $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        float|object $beta,
+        DeviceBuffer $C, int $offsetC, int $ldC,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->alt;
+        if(!$this->isComplex($A->dtype()) || !($alt instanceof LinuxPatch)) {
+            $this->gemm(
+                $order,$transA,$transB,
+                $m,$n,$k,
+                $alpha,
+                $A,$offsetA,$ldA,
+                $B,$offsetB,$ldB,
+                $beta,
+                $C,$offsetC,$ldC,
+                $queue,$event
+            );
+            return;
+        }
+        // Check Buffer A and X and B
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        if($A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and C");
+        }
+        // CLBlast does not support ConjNoTrans
+        if($transA==BLASIF::ConjNoTrans) {
+            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
+        }
+        if($transB==BLASIF::ConjNoTrans) {
+            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
+        }
+        $bufferA_p = $ffi->cast("cl_mem",$A->_getId());
+        $bufferB_p = $ffi->cast("cl_mem",$B->_getId());
+        $bufferC_p = $ffi->cast("cl_mem",$C->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        $alpha = $this->toComplex($alpha,$A->dtype());
+        $beta = $this->toComplex($beta,$A->dtype());
+        switch($A->dtype()) {
+            case NDArray::complex64:{
+                $status = $alt->CLBlastCgemm3m(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::complex128:{
+                $status = $alt->CLBlastZgemm3m(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemm3m error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C := alpha * op(A) * op(B) + beta * C
+     *  Real matrices are multiplied by the Strassen-Winograd algorithm
+     *  down to "depth" levels of recursion. The recursion stops earlier
+     *  when the blocks become small, and the leaves use the flat GEMM.
+     *  Complex matrices, and the platforms without librindowclblast,
+     *  are calculated by gemm().
+     */
+    public function gemmStrassen(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        float|object $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        float|object $beta,
+        DeviceBuffer $C, int $offsetC, int $ldC,
+        int $depth,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->alt;
+        if($this->isComplex($A->dtype()) || !($alt instanceof LinuxPatch)) {
+            $this->gemm(
+                $order,$transA,$transB,
+                $m,$n,$k,
+                $alpha,
+                $A,$offsetA,$ldA,
+                $B,$offsetB,$ldB,
+                $beta,
+                $C,$offsetC,$ldC,
+                $queue,$event
+            );
+            return;
+        }
+        if($depth<0) {
+            throw new InvalidArgumentException("depth must be greater than zero or equal");
+        }
+        // Check Buffer A and X and B
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        if($A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and C");
+        }
+        $bufferA_p = $ffi->cast("cl_mem",$A->_getId());
+        $bufferB_p = $ffi->cast("cl_mem",$B->_getId());
+        $bufferC_p = $ffi->cast("cl_mem",$C->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemmStrassen(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $depth,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemmStrassen(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m,$n,$k,
+                    $alpha,
+                    $bufferA_p,$offsetA,$ldA,
+                    $bufferB_p,$offsetB,$ldB,
+                    $beta,
+                    $bufferC_p,$offsetC,$ldC,
+                    $depth,
+                    $queue_p,$event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmStrassen error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
     public function symm(
         int $order,
         int $side,
@@ -75,10 +75,16 @@ class CLBlastFactory
         if(PHP_OS!='Linux') {
             return;
         }
-        $headerFile = __DIR__ . "/../platforms/ubuntu/src/complexfuncs.h";
+        $headerFiles = [
+            __DIR__ . "/../platforms/ubuntu/src/complexfuncs.h",
+            __DIR__ . "/../platforms/ubuntu/src/kernelfuncs.h",
+        ];
         $filename = __DIR__ . "/../platforms/ubuntu/lib/librindowclblast.so";
         //self::$ffipf = FFI::load($headerFile);
-        $code = file_get_contents($headerFile);
+        $code = '';
+        foreach($headerFiles as $headerFile) {
+            $code .= file_get_contents($headerFile);
+        }
         $ffi = null;
         try {
             $ffi = FFI::cdef($code,$filename);
@@ -21,6 +21,41 @@ class Math
     const CLBlastSuccess = 0;
     const CROSS_CORRELATION = 151;
     const CONVOLUTION = 152;
+    const SOLVER_CG = 0;
+    const SOLVER_BICGSTAB = 1;
+    const REDUCE_SUM = 0;
+    const REDUCE_MEAN = 1;
+    const REDUCE_MAX = 2;
+    const REDUCE_MIN = 3;
+    const REDUCE_ARGMAX = 4;
+    const REDUCE_ARGMIN = 5;
+    const UNARY_COPY = 0;
+    const UNARY_NEG = 1;
+    const UNARY_ABS = 2;
+    const UNARY_EXP = 3;
+    const UNARY_LOG = 4;
+    const UNARY_SQRT = 5;
+    const UNARY_SQUARE = 6;
+    const UNARY_TANH = 7;
+    const UNARY_SIGMOID = 8;
+    const UNARY_RELU = 9;
+    const UNARY_CLAMP = 10;
+    const UNARY_POW = 11;
+    const UNARY_AFFINE = 12;
+    const BINARY_ADD = 0;
+    const BINARY_SUB = 1;
+    const BINARY_MUL = 2;
+    const BINARY_DIV = 3;
+    const BINARY_POW = 4;
+    const BINARY_MAX = 5;
+    const BINARY_MIN = 6;
+    const POOL_MAX = 0;
+    const POOL_AVG = 1;
+    const WINOGRAD_AUTO = 0;
+    const WINOGRAD_F2X2 = 2;
+    const WINOGRAD_F4X4 = 4;
+    // convgemm uses Winograd for 3x3 kernels from this many channels and kernels
+    const WINOGRAD_MIN_CHANNELS = 16;
 
     protected FFI $ffi;
     protected object $alt;
@@ -250,6 +285,21 @@ class Math
         ?EventList $event=null
     ) : void
     {
+        if($pad_h!=$pad_w || $stride_h!=$stride_w || $dilation_h!=$dilation_w) {
+            // im2col of CLBlast uses the same pad, stride and dilation for the height and the width.
+            $this->im2colBatched(
+                $kernel_mode, 1,
+                $channels,$height,$width,
+                $kernel_h,$kernel_w,
+                $pad_h,$pad_w,
+                $stride_h,$stride_w,
+                $dilation_h,$dilation_w,
+                $im_buffer, $im_offset,
+                $col_buffer, $col_offset,
+                $queue, $event
+            );
+            return;
+        }
         $ffi = $this->ffi;
         // Check Buffer A and B
         if($im_buffer->dtype()!=$col_buffer->dtype()) {
@@ -270,8 +320,8 @@ class Math
                     $kernel_mode,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_w,          // ** CAUTION ** Blast has the bug.
-                    $stride_h,$stride_w,    // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
                     $im_buffer_p, $im_offset,
                     $col_buffer_p, $col_offset,
@@ -284,8 +334,8 @@ class Math
                     $kernel_mode,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_w,          // ** CAUTION ** Blast has the bug
-                    $stride_h,$stride_w,    // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
                     $im_buffer_p, $im_offset,
                     $col_buffer_p, $col_offset,
@@ -319,6 +369,21 @@ class Math
         ?EventList $event=null
     ) : void
     {
+        if($pad_h!=$pad_w || $stride_h!=$stride_w || $dilation_h!=$dilation_w) {
+            // col2im of CLBlast uses the same pad, stride and dilation for the height and the width.
+            $this->col2imBatched(
+                $kernel_mode, 1,
+                $channels,$height,$width,
+                $kernel_h,$kernel_w,
+                $pad_h,$pad_w,
+                $stride_h,$stride_w,
+                $dilation_h,$dilation_w,
+                $col_buffer, $col_offset,
+                $im_buffer, $im_offset,
+                $queue, $event
+            );
+            return;
+        }
         $ffi = $this->ffi;
         // Check Buffer A and B
         if($im_buffer->dtype()!=$col_buffer->dtype()) {
@@ -339,8 +404,8 @@ class Math
                     $kernel_mode,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_h,        // ** CAUTION ** Blast has the bug.
-                    $stride_h,$stride_h,  // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
                     $col_buffer_p, $col_offset,
                     $im_buffer_p, $im_offset,
@@ -353,8 +418,8 @@ class Math
                     $kernel_mode,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_h,        // ** CAUTION ** Blast has the bug
-                    $stride_h,$stride_h,  // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
                     $col_buffer_p, $col_offset,
                     $im_buffer_p, $im_offset,
@@ -374,30 +439,53 @@ class Math
         }
     }
 
-    public function convgemm(
+    /**
+     *  im2col of batch_count images in one launch, with independent pad and
+     *  stride for the height and the width.
+     *  The i-th image starts at im_offset+i*channels*height*width and the
+     *  i-th columns at col_offset+i*channels*kernel_h*kernel_w*output_h*output_w.
+     *  All the images and columns must lie in their buffers.
+     */
+    public function im2colBatched(
         int $kernel_mode,
+        int $batch_count,
         int $channels, int $height, int $width,
         int $kernel_h, int $kernel_w,
         int $pad_h, int $pad_w,
         int $stride_h, int $stride_w,
         int $dilation_h, int $dilation_w,
-        int $num_kernels,
-        int $batch_count,
         DeviceBuffer $im_buffer, int $im_offset,
-        DeviceBuffer $kernel_buffer, int $kernel_offset,
-        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $col_buffer, int $col_offset,
         CommandQueue $queue,
         ?EventList $event=null
     ) : void
     {
         $ffi = $this->ffi;
+        $alt = $this->platformLib('im2colBatched');
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($kernel_h<=0 || $kernel_w<=0) {
+            throw new InvalidArgumentException("kernel_h and kernel_w must be greater than zero");
+        }
+        if($pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("pad_h and pad_w must be greater than zero or equal");
+        }
+        if($stride_h<=0 || $stride_w<=0) {
+            throw new InvalidArgumentException("stride_h and stride_w must be greater than zero");
+        }
+        if($dilation_h<=0 || $dilation_w<=0) {
+            throw new InvalidArgumentException("dilation_h and dilation_w must be greater than zero");
+        }
+        if($im_offset<0 || $col_offset<0) {
+            throw new InvalidArgumentException("im_offset and col_offset must be greater than zero or equal");
+        }
         // Check Buffer A and B
-        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+        if($im_buffer->dtype()!=$col_buffer->dtype()) {
             throw new InvalidArgumentException("Unmatch data type for im and col");
         }
         $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
-        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
-        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $col_buffer_p = $ffi->cast("cl_mem",$col_buffer->_getId());
         $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
         $event_p = null;
         if($event) {
@@ -407,33 +495,31 @@ class Math
 
         switch($im_buffer->dtype()) {
             case NDArray::float32:{
-                $status = $ffi->CLBlastSconvgemm(
+                $status = $alt->CLBlastSim2colBatched(
                     $kernel_mode,
+                    $batch_count,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_h,        // ** CAUTION ** Blast has the bug.
-                    $stride_h,$stride_h,  // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
-                    $num_kernels, $batch_count,
                     $im_buffer_p, $im_offset,
-                    $kernel_buffer_p, $kernel_offset,
-                    $result_buffer_p, $result_offset,
+                    $col_buffer_p, $col_offset,
                     $queue_p, $event_p
                 );
                 break;
             }
             case NDArray::float64:{
-                $status = $ffi->CLBlastDconvgemm(
+                $status = $alt->CLBlastDim2colBatched(
                     $kernel_mode,
+                    $batch_count,
                     $channels,$height,$width,
                     $kernel_h,$kernel_w,
-                    $pad_h,$pad_h,        // ** CAUTION ** Blast has the bug.
-                    $stride_h,$stride_h,  // pad_h&w, stride_h&w must be the same.
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
                     $dilation_h,$dilation_w,
-                    $num_kernels, $batch_count,
                     $im_buffer_p, $im_offset,
-                    $kernel_buffer_p, $kernel_offset,
-                    $result_buffer_p, $result_offset,
+                    $col_buffer_p, $col_offset,
                     $queue_p, $event_p
                 );
                 break;
@@ -443,60 +529,60 @@ class Math
             }
         }
         if($status!=self::CLBlastSuccess) {
-            throw new RuntimeException("CLBlast?convgemm error=$status", $status);
+            throw new RuntimeException("CLBlast?im2colBatched error=$status", $status);
         }
         if($event) {
             $event->_move($event_obj);
         }
     }
 
-    public function axpyBatched(
-        int $n,
-        HostBuffer $alpha, int $offsetA,
-        DeviceBuffer $X, HostBuffer $offsetsX, int $offsetX, int $incX,
-        DeviceBuffer $Y, HostBuffer $offsetsY, int $offsetY, int $incY,
+    /**
+     *  col2im of batch_count images in one launch, with independent pad and
+     *  stride for the height and the width.
+     *  The i-th image starts at im_offset+i*channels*height*width and the
+     *  i-th columns at col_offset+i*channels*kernel_h*kernel_w*output_h*output_w.
+     *  All the images and columns must lie in their buffers.
+     */
+    public function col2imBatched(
+        int $kernel_mode,
         int $batch_count,
-        CommandQueue $queue, ?EventList $event=null
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        DeviceBuffer $col_buffer, int $col_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
     ) : void
     {
         $ffi = $this->ffi;
-        if($n<=0) {
-            throw new InvalidArgumentException("n must be greater than zero");
-        }
-        if($offsetA<0) {
-            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
-        }
-        if($offsetX<0) {
-            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
-        }
-        if($offsetY<0) {
-            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
-        }
+        $alt = $this->platformLib('col2imBatched');
         if($batch_count<0) {
             throw new InvalidArgumentException("batch_count must be greater than zero or equal");
         }
-        if($offsetA+$batch_count>count($alpha)) {
-            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
+        if($kernel_h<=0 || $kernel_w<=0) {
+            throw new InvalidArgumentException("kernel_h and kernel_w must be greater than zero");
         }
-        if($offsetX+$batch_count>count($offsetsX)) {
-            throw new InvalidArgumentException("offsetsX LinearBuffer is too small.");
+        if($pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("pad_h and pad_w must be greater than zero or equal");
         }
-        if($offsetY+$batch_count>count($offsetsY)) {
-            throw new InvalidArgumentException("offsetsY LinearBuffer is too small.");
+        if($stride_h<=0 || $stride_w<=0) {
+            throw new InvalidArgumentException("stride_h and stride_w must be greater than zero");
         }
-        if($offsetsX->dtype()!==NDArray::int64 && $offsetsX->dtype()!==NDArray::uint64) {
-            throw new InvalidArgumentException("offsetsX LinearBuffer data type must be int64.");
+        if($dilation_h<=0 || $dilation_w<=0) {
+            throw new InvalidArgumentException("dilation_h and dilation_w must be greater than zero");
         }
-        if($offsetsY->dtype()!==NDArray::int64 && $offsetsY->dtype()!==NDArray::uint64) {
-            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        if($im_offset<0 || $col_offset<0) {
+            throw new InvalidArgumentException("im_offset and col_offset must be greater than zero or equal");
         }
-        // Check Buffer X and Y
-        if($X->dtype()!=$Y->dtype()||$alpha->dtype()!=$X->dtype()) {
-            throw new InvalidArgumentException("Unmatch data type for A,X and Y");
+        // Check Buffer A and B
+        if($im_buffer->dtype()!=$col_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and col");
         }
-        $X_p = $ffi->cast("cl_mem",$X->_getId());
-        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
-
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $col_buffer_p = $ffi->cast("cl_mem",$col_buffer->_getId());
         $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
         $event_p = null;
         if($event) {
@@ -504,23 +590,33 @@ class Math
             $event_p = $ffi->cast("cl_event[1]",$event_obj);
         }
 
-        switch($X->dtype()) {
+        switch($im_buffer->dtype()) {
             case NDArray::float32:{
-                $status = $ffi->CLBlastSaxpyBatched(
-                    $n, $alpha->addr($offsetA),
-                    $X_p, $ffi->cast("size_t *",$offsetsX->addr($offsetX)), $incX,
-                    $Y_p, $ffi->cast("size_t *",$offsetsY->addr($offsetY)), $incY,
+                $status = $alt->CLBlastScol2imBatched(
+                    $kernel_mode,
                     $batch_count,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $col_buffer_p, $col_offset,
+                    $im_buffer_p, $im_offset,
                     $queue_p, $event_p
                 );
                 break;
             }
             case NDArray::float64:{
-                $status = $ffi->CLBlastDaxpyBatched(
-                    $n, $alpha->addr($offsetA),
-                    $X_p, $ffi->cast("size_t *",$offsetsX->addr($offsetX)), $incX,
-                    $Y_p, $ffi->cast("size_t *",$offsetsY->addr($offsetY)), $incY,
+                $status = $alt->CLBlastDcol2imBatched(
+                    $kernel_mode,
                     $batch_count,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $col_buffer_p, $col_offset,
+                    $im_buffer_p, $im_offset,
                     $queue_p, $event_p
                 );
                 break;
@@ -530,92 +626,73 @@ class Math
             }
         }
         if($status!=self::CLBlastSuccess) {
-            throw new RuntimeException("CLBlast?axpyBatched error=$status", $status);
+            throw new RuntimeException("CLBlast?col2imBatched error=$status", $status);
         }
         if($event) {
             $event->_move($event_obj);
         }
     }
 
-    public function gemmBatched(
-        int $order,
-        int $transA,
-        int $transB,
-        int $m,
-        int $n,
-        int $k,
-        HostBuffer $alpha, int $offsetAlpha,
-        DeviceBuffer $A, HostBuffer $offsetsA, int $offsetA, int $ldA,
-        DeviceBuffer $B, HostBuffer $offsetsB, int $offsetB, int $ldB,
-        HostBuffer $beta, int $offsetBeta,
-        DeviceBuffer $C, HostBuffer $offsetsC, int $offsetC, int $ldC,
+    public function convgemm(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
         int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
         CommandQueue $queue,
-        ?EventList $event=null,
+        ?EventList $event=null
     ) : void
     {
-        $ffi = $this->ffi;
-        if($m<=0) {
-            throw new InvalidArgumentException("m must be greater than zero");
-        }
-        if($n<=0) {
-            throw new InvalidArgumentException("n must be greater than zero");
-        }
-        if($k<=0) {
-            throw new InvalidArgumentException("k must be greater than zero");
-        }
-        if($offsetAlpha<0) {
-            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
-        }
-        if($offsetA<0) {
-            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
-        }
-        if($offsetB<0) {
-            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
-        }
-        if($offsetBeta<0) {
-            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
-        }
-        if($offsetC<0) {
-            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
-        }
-        if($batch_count<0) {
-            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
-        }
-        if($offsetAlpha+$batch_count>count($alpha)) {
-            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
-        }
-        if($offsetA+$batch_count>count($offsetsA)) {
-            throw new InvalidArgumentException("offsetsA LinearBuffer is too small.");
-        }
-        if($offsetB+$batch_count>count($offsetsB)) {
-            throw new InvalidArgumentException("offsetsB LinearBuffer is too small.");
-        }
-        if($offsetBeta+$batch_count>count($beta)) {
-            throw new InvalidArgumentException("beta LinearBuffer is too small.");
-        }
-        if($offsetC+$batch_count>count($offsetsC)) {
-            throw new InvalidArgumentException("offsetsC LinearBuffer is too small.");
-        }
-
-        if($offsetsA->dtype()!==NDArray::int64 && $offsetsA->dtype()!==NDArray::uint64) {
-            throw new InvalidArgumentException("offsetsX LinearBuffer data type must be int64.");
-        }
-        if($offsetsB->dtype()!==NDArray::int64 && $offsetsB->dtype()!==NDArray::uint64) {
-            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        if($this->hasPlatformLib() &&
+            $kernel_h==3 && $kernel_w==3 &&
+            $stride_h==1 && $stride_w==1 &&
+            $dilation_h==1 && $dilation_w==1 &&
+            $channels>=self::WINOGRAD_MIN_CHANNELS &&
+            $num_kernels>=self::WINOGRAD_MIN_CHANNELS) {
+            $this->convgemmWinograd($kernel_mode, self::WINOGRAD_AUTO,
+                $channels,$height,$width,
+                $pad_h,$pad_w,
+                $num_kernels,$batch_count,
+                $im_buffer,$im_offset,
+                $kernel_buffer,$kernel_offset,false,
+                $result_buffer,$result_offset,
+                $queue,$event
+            );
+            return;
         }
-        if($offsetsC->dtype()!==NDArray::int64 && $offsetsC->dtype()!==NDArray::uint64) {
-            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        if($pad_h!=$pad_w || $stride_h!=$stride_w || $dilation_h!=$dilation_w) {
+            // convgemm of CLBlast uses the same pad, stride and dilation for the height and the width.
+            $this->convgemmNd(
+                $kernel_mode,
+                $channels,
+                [$height,$width],
+                [$kernel_h,$kernel_w],
+                [$pad_h,$pad_w],
+                [$stride_h,$stride_w],
+                [$dilation_h,$dilation_w],
+                $num_kernels,
+                $batch_count,
+                $im_buffer, $im_offset,
+                $kernel_buffer, $kernel_offset,
+                $result_buffer, $result_offset,
+                $queue, $event
+            );
+            return;
         }
-        // Check Buffer X and Y
-        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()||
-            $A->dtype()!=$alpha->dtype()||$A->dtype()!=$beta->dtype()) {
-            throw new InvalidArgumentException("Unmatch data type for A,B,C,alpha and beta");
+        $ffi = $this->ffi;
+        // Check Buffer A and B
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and col");
         }
-        $A_p = $ffi->cast("cl_mem",$A->_getId());
-        $B_p = $ffi->cast("cl_mem",$B->_getId());
-        $C_p = $ffi->cast("cl_mem",$C->_getId());
-
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
         $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
         $event_p = null;
         if($event) {
@@ -623,35 +700,35 @@ class Math
             $event_p = $ffi->cast("cl_event[1]",$event_obj);
         }
 
-        switch($A->dtype()) {
+        switch($im_buffer->dtype()) {
             case NDArray::float32:{
-                $status = $ffi->CLBlastSgemmBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
-                    $alpha->addr($offsetAlpha),
-                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
-                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
-                    $beta->addr($offsetBeta),
-                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ldC,
-                    $batch_count,
+                $status = $ffi->CLBlastSconvgemm(
+                    $kernel_mode,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
                     $queue_p, $event_p
                 );
                 break;
             }
             case NDArray::float64:{
-                $status = $ffi->CLBlastDgemmBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
-                    $alpha->addr($offsetAlpha),
-                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
-                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
-                    $beta->addr($offsetBeta),
-                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ldC,
-                    $batch_count,
+                $status = $ffi->CLBlastDconvgemm(
+                    $kernel_mode,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
                     $queue_p, $event_p
                 );
                 break;
@@ -661,40 +738,4800 @@ class Math
             }
         }
         if($status!=self::CLBlastSuccess) {
-            throw new RuntimeException("CLBlast?gemmBatched error=$status", $status);
+            throw new RuntimeException("CLBlast?convgemm error=$status", $status);
         }
         if($event) {
             $event->_move($event_obj);
         }
     }
 
-    public function gemmStridedBatched(
-        int $order,
-        int $transA,
-        int $transB,
-        int $m,
-        int $n,
-        int $k,
-        float|object $alpha,
-        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
-        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
-        float|object $beta,
-        DeviceBuffer $C, int $offsetC, int $ldC, int $strideC,
-        int $batch_count,
-        CommandQueue $queue,
+    /**
+     *  Gradient of convgemm for the images.
+     *  im [batch_count][channels][height][width] is overwritten by the result
+     *  gradients multiplied by the kernels and gathered back to the images,
+     *  without storing the columns of col2im.
+     */
+    public function convgemmBackwardData(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardData(
+            $kernel_mode,
+            $channels,
+            [$height,$width],
+            [$kernel_h,$kernel_w],
+            [$pad_h,$pad_w],
+            [$stride_h,$stride_w],
+            [$dilation_h,$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $im_buffer, $im_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  Gradient of convgemm for the kernels.
+     *  kernel [num_kernels][channels][kernel_h][kernel_w] is overwritten by the
+     *  result gradients multiplied by the image columns and summed over the
+     *  batch, without storing the columns of im2col.
+     */
+    public function convgemmBackwardFilter(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardFilter(
+            $kernel_mode,
+            $channels,
+            [$height,$width],
+            [$kernel_h,$kernel_w],
+            [$pad_h,$pad_w],
+            [$stride_h,$stride_w],
+            [$dilation_h,$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $im_buffer, $im_offset,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  convgemm split into "groups" independent convolutions of channels/groups
+     *  channels and num_kernels/groups kernels each.
+     *    kernel  [num_kernels][channels/groups][kernel_h][kernel_w]
+     *  groups = channels is the depthwise convolution, which runs as one launch.
+     */
+    public function convgemmGrouped(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $groups,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmGrouped');
+        if($groups<=0) {
+            throw new InvalidArgumentException("groups must be greater than zero");
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($channels%$groups!=0 || $num_kernels%$groups!=0) {
+            throw new InvalidArgumentException("channels and num_kernels must be multiples of groups");
+        }
+        if($height<0 || $width<0 || $pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("height, width and pads must be greater than zero or equal");
+        }
+        if($kernel_h<=0 || $kernel_w<=0 || $stride_h<=0 || $stride_w<=0 || $dilation_h<=0 || $dilation_w<=0) {
+            throw new InvalidArgumentException("kernel, stride and dilation must be greater than zero");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and kernel");
+        }
+        if($im_buffer->dtype()!=$result_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and result");
+        }
+        $input_shape_p = $this->sizeArray([$height,$width]);
+        $kernel_shape_p = $this->sizeArray([$kernel_h,$kernel_w]);
+        $pads_p = $this->sizeArray([$pad_h,$pad_w]);
+        $strides_p = $this->sizeArray([$stride_h,$stride_w]);
+        $dilations_p = $this->sizeArray([$dilation_h,$dilation_w]);
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($im_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmGrouped(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmGrouped(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmGrouped error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of convgemmGrouped for the images. im is overwritten.
+     */
+    public function convgemmGroupedBackwardData(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $groups,
+        int $batch_count,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmGroupedBackwardData');
+        if($groups<=0) {
+            throw new InvalidArgumentException("groups must be greater than zero");
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($channels%$groups!=0 || $num_kernels%$groups!=0) {
+            throw new InvalidArgumentException("channels and num_kernels must be multiples of groups");
+        }
+        if($height<0 || $width<0 || $pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("height, width and pads must be greater than zero or equal");
+        }
+        if($kernel_h<=0 || $kernel_w<=0 || $stride_h<=0 || $stride_w<=0 || $dilation_h<=0 || $dilation_w<=0) {
+            throw new InvalidArgumentException("kernel, stride and dilation must be greater than zero");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($result_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for result and kernel");
+        }
+        if($result_buffer->dtype()!=$im_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for result and im");
+        }
+        $input_shape_p = $this->sizeArray([$height,$width]);
+        $kernel_shape_p = $this->sizeArray([$kernel_h,$kernel_w]);
+        $pads_p = $this->sizeArray([$pad_h,$pad_w]);
+        $strides_p = $this->sizeArray([$stride_h,$stride_w]);
+        $dilations_p = $this->sizeArray([$dilation_h,$dilation_w]);
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($result_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmGroupedBackwardData(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $im_buffer_p, $im_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmGroupedBackwardData(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $im_buffer_p, $im_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmGroupedBackwardData error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of convgemmGrouped for the kernels, summed over the batch.
+     *  kernel is overwritten.
+     */
+    public function convgemmGroupedBackwardFilter(
+        int $kernel_mode,
+        int $channels, int $height, int $width,
+        int $kernel_h, int $kernel_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $groups,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmGroupedBackwardFilter');
+        if($groups<=0) {
+            throw new InvalidArgumentException("groups must be greater than zero");
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($channels%$groups!=0 || $num_kernels%$groups!=0) {
+            throw new InvalidArgumentException("channels and num_kernels must be multiples of groups");
+        }
+        if($height<0 || $width<0 || $pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("height, width and pads must be greater than zero or equal");
+        }
+        if($kernel_h<=0 || $kernel_w<=0 || $stride_h<=0 || $stride_w<=0 || $dilation_h<=0 || $dilation_w<=0) {
+            throw new InvalidArgumentException("kernel, stride and dilation must be greater than zero");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($im_buffer->dtype()!=$result_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and result");
+        }
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and kernel");
+        }
+        $input_shape_p = $this->sizeArray([$height,$width]);
+        $kernel_shape_p = $this->sizeArray([$kernel_h,$kernel_w]);
+        $pads_p = $this->sizeArray([$pad_h,$pad_w]);
+        $strides_p = $this->sizeArray([$stride_h,$stride_w]);
+        $dilations_p = $this->sizeArray([$dilation_h,$dilation_w]);
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($im_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmGroupedBackwardFilter(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmGroupedBackwardFilter(
+                    $kernel_mode,
+                    2, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $groups, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmGroupedBackwardFilter error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Winograd transform of 3x3 kernels [num_kernels][channels][3][3] for
+     *  convgemmWinograd of the tile (WINOGRAD_F2X2 or WINOGRAD_F4X4).
+     *  transformed needs (tile+2)*(tile+2)*num_kernels*channels elements and
+     *  can be kept for every later call with the same kernels.
+     */
+    public function winogradFilter(
+        int $kernel_mode,
+        int $tile,
+        int $channels,
+        int $num_kernels,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $transformed_buffer, int $transformed_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('winogradFilter');
+        if($tile!=self::WINOGRAD_F2X2 && $tile!=self::WINOGRAD_F4X4) {
+            throw new InvalidArgumentException("tile must be WINOGRAD_F2X2 or WINOGRAD_F4X4");
+        }
+        if($channels<0 || $num_kernels<0) {
+            throw new InvalidArgumentException("channels and num_kernels must be greater than zero or equal");
+        }
+        if($kernel_offset<0 || $transformed_offset<0) {
+            throw new InvalidArgumentException("kernel_offset and transformed_offset must be greater than zero or equal");
+        }
+        if($kernel_buffer->dtype()!=$transformed_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for kernel and transformed");
+        }
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $transformed_buffer_p = $ffi->cast("cl_mem",$transformed_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($kernel_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSwinogradFilter(
+                    $kernel_mode, $tile,
+                    $channels, $num_kernels,
+                    $kernel_buffer_p, $kernel_offset,
+                    $transformed_buffer_p, $transformed_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDwinogradFilter(
+                    $kernel_mode, $tile,
+                    $channels, $num_kernels,
+                    $kernel_buffer_p, $kernel_offset,
+                    $transformed_buffer_p, $transformed_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?winogradFilter error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  convgemm of 3x3 kernels with a stride and dilation of 1 by the Winograd
+     *  algorithm F(tile x tile, 3x3). WINOGRAD_AUTO chooses the tile by the
+     *  output size. If kernel_transformed is true, kernel_buffer holds the
+     *  output of winogradFilter for the same tile, which must then be given.
+     */
+    public function convgemmWinograd(
+        int $kernel_mode,
+        int $tile,
+        int $channels, int $height, int $width,
+        int $pad_h, int $pad_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        bool $kernel_transformed,
+        DeviceBuffer $result_buffer, int $result_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmWinograd');
+        if($tile!=self::WINOGRAD_AUTO && $tile!=self::WINOGRAD_F2X2 && $tile!=self::WINOGRAD_F4X4) {
+            throw new InvalidArgumentException("tile must be WINOGRAD_AUTO, WINOGRAD_F2X2 or WINOGRAD_F4X4");
+        }
+        if($kernel_transformed && $tile==self::WINOGRAD_AUTO) {
+            throw new InvalidArgumentException("tile must be given for a transformed kernel");
+        }
+        if($channels<0 || $height<0 || $width<0 || $pad_h<0 || $pad_w<0) {
+            throw new InvalidArgumentException("channels, height, width and pads must be greater than zero or equal");
+        }
+        if($num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($im_offset<0 || $kernel_offset<0 || $result_offset<0) {
+            throw new InvalidArgumentException("offsets must be greater than zero or equal");
+        }
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and kernel");
+        }
+        if($im_buffer->dtype()!=$result_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and result");
+        }
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($im_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmWinograd(
+                    $kernel_mode, $tile,
+                    $channels, $height, $width,
+                    $pad_h, $pad_w,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset, $kernel_transformed ? 1 : 0,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmWinograd(
+                    $kernel_mode, $tile,
+                    $channels, $height, $width,
+                    $pad_h, $pad_w,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset, $kernel_transformed ? 1 : 0,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmWinograd error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Convolution of 1 to 3 spatial dimensions by implicit GEMM.
+     *    im      [batch_count][channels][input_shape...]
+     *    kernel  [num_kernels][channels][kernel_shape...]
+     *    result  [batch_count][num_kernels][output shape...]
+     *  The layouts and kernel_mode are those of convgemm. Each array must lie in
+     *  its buffer past its offset.
+     */
+    public function convgemmNd(
+        int $kernel_mode,
+        int $channels,
+        array $input_shape,
+        array $kernel_shape,
+        array $pads,
+        array $strides,
+        array $dilations,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmNd');
+        $rank = count($input_shape);
+        if($rank<1 || $rank>3) {
+            throw new InvalidArgumentException("input_shape must have 1 to 3 dimensions");
+        }
+        if(count($kernel_shape)!=$rank || count($pads)!=$rank ||
+            count($strides)!=$rank || count($dilations)!=$rank) {
+            throw new InvalidArgumentException("kernel_shape, pads, strides and dilations must have the same dimensions as input_shape");
+        }
+        for($i=0;$i<$rank;$i++) {
+            if($input_shape[$i]<0 || $pads[$i]<0) {
+                throw new InvalidArgumentException("input_shape and pads must be greater than zero or equal");
+            }
+            if($kernel_shape[$i]<=0 || $strides[$i]<=0 || $dilations[$i]<=0) {
+                throw new InvalidArgumentException("kernel_shape, strides and dilations must be greater than zero");
+            }
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and kernel");
+        }
+        if($im_buffer->dtype()!=$result_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and result");
+        }
+        $input_shape_p = $this->sizeArray($input_shape);
+        $kernel_shape_p = $this->sizeArray($kernel_shape);
+        $pads_p = $this->sizeArray($pads);
+        $strides_p = $this->sizeArray($strides);
+        $dilations_p = $this->sizeArray($dilations);
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($im_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmNd(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmNd(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $result_buffer_p, $result_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmNd error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of convgemmNd for the images. im is overwritten by the
+     *  result gradients multiplied by the kernels and gathered back to the images.
+     */
+    public function convgemmNdBackwardData(
+        int $kernel_mode,
+        int $channels,
+        array $input_shape,
+        array $kernel_shape,
+        array $pads,
+        array $strides,
+        array $dilations,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmNdBackwardData');
+        $rank = count($input_shape);
+        if($rank<1 || $rank>3) {
+            throw new InvalidArgumentException("input_shape must have 1 to 3 dimensions");
+        }
+        if(count($kernel_shape)!=$rank || count($pads)!=$rank ||
+            count($strides)!=$rank || count($dilations)!=$rank) {
+            throw new InvalidArgumentException("kernel_shape, pads, strides and dilations must have the same dimensions as input_shape");
+        }
+        for($i=0;$i<$rank;$i++) {
+            if($input_shape[$i]<0 || $pads[$i]<0) {
+                throw new InvalidArgumentException("input_shape and pads must be greater than zero or equal");
+            }
+            if($kernel_shape[$i]<=0 || $strides[$i]<=0 || $dilations[$i]<=0) {
+                throw new InvalidArgumentException("kernel_shape, strides and dilations must be greater than zero");
+            }
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($result_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for result and kernel");
+        }
+        if($result_buffer->dtype()!=$im_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for result and im");
+        }
+        $input_shape_p = $this->sizeArray($input_shape);
+        $kernel_shape_p = $this->sizeArray($kernel_shape);
+        $pads_p = $this->sizeArray($pads);
+        $strides_p = $this->sizeArray($strides);
+        $dilations_p = $this->sizeArray($dilations);
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($result_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmNdBackwardData(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $im_buffer_p, $im_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmNdBackwardData(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $im_buffer_p, $im_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmNdBackwardData error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of convgemmNd for the kernels. kernel is overwritten by the
+     *  result gradients multiplied by the image columns, summed over the batch.
+     */
+    public function convgemmNdBackwardFilter(
+        int $kernel_mode,
+        int $channels,
+        array $input_shape,
+        array $kernel_shape,
+        array $pads,
+        array $strides,
+        array $dilations,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('convgemmNdBackwardFilter');
+        $rank = count($input_shape);
+        if($rank<1 || $rank>3) {
+            throw new InvalidArgumentException("input_shape must have 1 to 3 dimensions");
+        }
+        if(count($kernel_shape)!=$rank || count($pads)!=$rank ||
+            count($strides)!=$rank || count($dilations)!=$rank) {
+            throw new InvalidArgumentException("kernel_shape, pads, strides and dilations must have the same dimensions as input_shape");
+        }
+        for($i=0;$i<$rank;$i++) {
+            if($input_shape[$i]<0 || $pads[$i]<0) {
+                throw new InvalidArgumentException("input_shape and pads must be greater than zero or equal");
+            }
+            if($kernel_shape[$i]<=0 || $strides[$i]<=0 || $dilations[$i]<=0) {
+                throw new InvalidArgumentException("kernel_shape, strides and dilations must be greater than zero");
+            }
+        }
+        if($channels<0 || $num_kernels<0 || $batch_count<0) {
+            throw new InvalidArgumentException("channels, num_kernels and batch_count must be greater than zero or equal");
+        }
+        if($im_offset<0) {
+            throw new InvalidArgumentException("im_offset must be greater than zero or equal");
+        }
+        if($result_offset<0) {
+            throw new InvalidArgumentException("result_offset must be greater than zero or equal");
+        }
+        if($kernel_offset<0) {
+            throw new InvalidArgumentException("kernel_offset must be greater than zero or equal");
+        }
+        if($im_buffer->dtype()!=$result_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and result");
+        }
+        if($im_buffer->dtype()!=$kernel_buffer->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for im and kernel");
+        }
+        $input_shape_p = $this->sizeArray($input_shape);
+        $kernel_shape_p = $this->sizeArray($kernel_shape);
+        $pads_p = $this->sizeArray($pads);
+        $strides_p = $this->sizeArray($strides);
+        $dilations_p = $this->sizeArray($dilations);
+        $im_buffer_p = $ffi->cast("cl_mem",$im_buffer->_getId());
+        $result_buffer_p = $ffi->cast("cl_mem",$result_buffer->_getId());
+        $kernel_buffer_p = $ffi->cast("cl_mem",$kernel_buffer->_getId());
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($im_buffer->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSconvgemmNdBackwardFilter(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDconvgemmNdBackwardFilter(
+                    $kernel_mode,
+                    $rank, $channels, $input_shape_p,
+                    $kernel_shape_p, $pads_p, $strides_p, $dilations_p,
+                    $num_kernels, $batch_count,
+                    $im_buffer_p, $im_offset,
+                    $result_buffer_p, $result_offset,
+                    $kernel_buffer_p, $kernel_offset,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?convgemmNdBackwardFilter error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  1D convolution of convgemmNd.
+     */
+    public function convgemm1d(
+        int $kernel_mode,
+        int $channels, int $width,
+        int $kernel_w,
+        int $pad_w,
+        int $stride_w,
+        int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNd(
+            $kernel_mode,
+            $channels,
+            [$width],
+            [$kernel_w],
+            [$pad_w],
+            [$stride_w],
+            [$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $im_buffer, $im_offset,
+            $kernel_buffer, $kernel_offset,
+            $result_buffer, $result_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  1D convolution of convgemmNdBackwardData.
+     */
+    public function convgemm1dBackwardData(
+        int $kernel_mode,
+        int $channels, int $width,
+        int $kernel_w,
+        int $pad_w,
+        int $stride_w,
+        int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardData(
+            $kernel_mode,
+            $channels,
+            [$width],
+            [$kernel_w],
+            [$pad_w],
+            [$stride_w],
+            [$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $im_buffer, $im_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  1D convolution of convgemmNdBackwardFilter.
+     */
+    public function convgemm1dBackwardFilter(
+        int $kernel_mode,
+        int $channels, int $width,
+        int $kernel_w,
+        int $pad_w,
+        int $stride_w,
+        int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardFilter(
+            $kernel_mode,
+            $channels,
+            [$width],
+            [$kernel_w],
+            [$pad_w],
+            [$stride_w],
+            [$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $im_buffer, $im_offset,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  3D convolution of convgemmNd.
+     */
+    public function convgemm3d(
+        int $kernel_mode,
+        int $channels, int $depth, int $height, int $width,
+        int $kernel_d, int $kernel_h, int $kernel_w,
+        int $pad_d, int $pad_h, int $pad_w,
+        int $stride_d, int $stride_h, int $stride_w,
+        int $dilation_d, int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNd(
+            $kernel_mode,
+            $channels,
+            [$depth,$height,$width],
+            [$kernel_d,$kernel_h,$kernel_w],
+            [$pad_d,$pad_h,$pad_w],
+            [$stride_d,$stride_h,$stride_w],
+            [$dilation_d,$dilation_h,$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $im_buffer, $im_offset,
+            $kernel_buffer, $kernel_offset,
+            $result_buffer, $result_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  3D convolution of convgemmNdBackwardData.
+     */
+    public function convgemm3dBackwardData(
+        int $kernel_mode,
+        int $channels, int $depth, int $height, int $width,
+        int $kernel_d, int $kernel_h, int $kernel_w,
+        int $pad_d, int $pad_h, int $pad_w,
+        int $stride_d, int $stride_h, int $stride_w,
+        int $dilation_d, int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        DeviceBuffer $im_buffer, int $im_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardData(
+            $kernel_mode,
+            $channels,
+            [$depth,$height,$width],
+            [$kernel_d,$kernel_h,$kernel_w],
+            [$pad_d,$pad_h,$pad_w],
+            [$stride_d,$stride_h,$stride_w],
+            [$dilation_d,$dilation_h,$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $im_buffer, $im_offset,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  3D convolution of convgemmNdBackwardFilter.
+     */
+    public function convgemm3dBackwardFilter(
+        int $kernel_mode,
+        int $channels, int $depth, int $height, int $width,
+        int $kernel_d, int $kernel_h, int $kernel_w,
+        int $pad_d, int $pad_h, int $pad_w,
+        int $stride_d, int $stride_h, int $stride_w,
+        int $dilation_d, int $dilation_h, int $dilation_w,
+        int $num_kernels,
+        int $batch_count,
+        DeviceBuffer $im_buffer, int $im_offset,
+        DeviceBuffer $result_buffer, int $result_offset,
+        DeviceBuffer $kernel_buffer, int $kernel_offset,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->convgemmNdBackwardFilter(
+            $kernel_mode,
+            $channels,
+            [$depth,$height,$width],
+            [$kernel_d,$kernel_h,$kernel_w],
+            [$pad_d,$pad_h,$pad_w],
+            [$stride_d,$stride_h,$stride_w],
+            [$dilation_d,$dilation_h,$dilation_w],
+            $num_kernels,
+            $batch_count,
+            $im_buffer, $im_offset,
+            $result_buffer, $result_offset,
+            $kernel_buffer, $kernel_offset,
+            $queue, $event
+        );
+    }
+
+    public function axpyBatched(
+        int $n,
+        HostBuffer $alpha, int $offsetA,
+        DeviceBuffer $X, HostBuffer $offsetsX, int $offsetX, int $incX,
+        DeviceBuffer $Y, HostBuffer $offsetsY, int $offsetY, int $incY,
+        int $batch_count,
+        CommandQueue $queue, ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        if($n<=0) {
+            throw new InvalidArgumentException("n must be greater than zero");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($offsetA+$batch_count>count($alpha)) {
+            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
+        }
+        if($offsetX+$batch_count>count($offsetsX)) {
+            throw new InvalidArgumentException("offsetsX LinearBuffer is too small.");
+        }
+        if($offsetY+$batch_count>count($offsetsY)) {
+            throw new InvalidArgumentException("offsetsY LinearBuffer is too small.");
+        }
+        if($offsetsX->dtype()!==NDArray::int64 && $offsetsX->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsX LinearBuffer data type must be int64.");
+        }
+        if($offsetsY->dtype()!==NDArray::int64 && $offsetsY->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        }
+        // Check Buffer X and Y
+        if($X->dtype()!=$Y->dtype()||$alpha->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,X and Y");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $ffi->CLBlastSaxpyBatched(
+                    $n, $alpha->addr($offsetA),
+                    $X_p, $ffi->cast("size_t *",$offsetsX->addr($offsetX)), $incX,
+                    $Y_p, $ffi->cast("size_t *",$offsetsY->addr($offsetY)), $incY,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $ffi->CLBlastDaxpyBatched(
+                    $n, $alpha->addr($offsetA),
+                    $X_p, $ffi->cast("size_t *",$offsetsX->addr($offsetX)), $incX,
+                    $Y_p, $ffi->cast("size_t *",$offsetsY->addr($offsetY)), $incY,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?axpyBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    public function gemmBatched(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        HostBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $A, HostBuffer $offsetsA, int $offsetA, int $ldA,
+        DeviceBuffer $B, HostBuffer $offsetsB, int $offsetB, int $ldB,
+        HostBuffer $beta, int $offsetBeta,
+        DeviceBuffer $C, HostBuffer $offsetsC, int $offsetC, int $ldC,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        if($m<=0) {
+            throw new InvalidArgumentException("m must be greater than zero");
+        }
+        if($n<=0) {
+            throw new InvalidArgumentException("n must be greater than zero");
+        }
+        if($k<=0) {
+            throw new InvalidArgumentException("k must be greater than zero");
+        }
+        if($offsetAlpha<0) {
+            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($offsetBeta<0) {
+            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
+        }
+        if($offsetC<0) {
+            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($offsetAlpha+$batch_count>count($alpha)) {
+            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
+        }
+        if($offsetA+$batch_count>count($offsetsA)) {
+            throw new InvalidArgumentException("offsetsA LinearBuffer is too small.");
+        }
+        if($offsetB+$batch_count>count($offsetsB)) {
+            throw new InvalidArgumentException("offsetsB LinearBuffer is too small.");
+        }
+        if($offsetBeta+$batch_count>count($beta)) {
+            throw new InvalidArgumentException("beta LinearBuffer is too small.");
+        }
+        if($offsetC+$batch_count>count($offsetsC)) {
+            throw new InvalidArgumentException("offsetsC LinearBuffer is too small.");
+        }
+
+        if($offsetsA->dtype()!==NDArray::int64 && $offsetsA->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsX LinearBuffer data type must be int64.");
+        }
+        if($offsetsB->dtype()!==NDArray::int64 && $offsetsB->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        }
+        if($offsetsC->dtype()!==NDArray::int64 && $offsetsC->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsY LinearBuffer data type must be int64.");
+        }
+        // Check Buffer X and Y
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()||
+            $A->dtype()!=$alpha->dtype()||$A->dtype()!=$beta->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,B,C,alpha and beta");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+        $C_p = $ffi->cast("cl_mem",$C->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $ffi->CLBlastSgemmBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha->addr($offsetAlpha),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
+                    $beta->addr($offsetBeta),
+                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ldC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $ffi->CLBlastDgemmBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha->addr($offsetAlpha),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
+                    $beta->addr($offsetBeta),
+                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ldC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C[i] := alpha[i] * op(A[i]) * op(B[i]) + beta[i] * C[i]
+     *  Each problem has its own m[i], n[i], k[i] and leading dimensions.
+     *  The problems of the same shape are calculated together by one
+     *  batched GEMM. A problem with k[i]=0 gives C[i] := beta[i] * C[i].
+     */
+    public function gemmGrouped(
+        int $order,
+        int $transA,
+        int $transB,
+        HostBuffer $m,
+        HostBuffer $n,
+        HostBuffer $k,
+        HostBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $A, HostBuffer $offsetsA, int $offsetA, HostBuffer $ldA,
+        DeviceBuffer $B, HostBuffer $offsetsB, int $offsetB, HostBuffer $ldB,
+        HostBuffer $beta, int $offsetBeta,
+        DeviceBuffer $C, HostBuffer $offsetsC, int $offsetC, HostBuffer $ldC,
+        int $group_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('gemmGrouped');
+        if($offsetAlpha<0) {
+            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($offsetBeta<0) {
+            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
+        }
+        if($offsetC<0) {
+            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        }
+        if($group_count<0) {
+            throw new InvalidArgumentException("group_count must be greater than zero or equal");
+        }
+        $sizes = ['m'=>$m,'n'=>$n,'k'=>$k,'ldA'=>$ldA,'ldB'=>$ldB,'ldC'=>$ldC];
+        foreach($sizes as $name => $size) {
+            if($group_count>count($size)) {
+                throw new InvalidArgumentException("$name LinearBuffer is too small.");
+            }
+            if($size->dtype()!==NDArray::int64 && $size->dtype()!==NDArray::uint64) {
+                throw new InvalidArgumentException("$name LinearBuffer data type must be int64.");
+            }
+        }
+        if($offsetAlpha+$group_count>count($alpha)) {
+            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
+        }
+        if($offsetA+$group_count>count($offsetsA)) {
+            throw new InvalidArgumentException("offsetsA LinearBuffer is too small.");
+        }
+        if($offsetB+$group_count>count($offsetsB)) {
+            throw new InvalidArgumentException("offsetsB LinearBuffer is too small.");
+        }
+        if($offsetBeta+$group_count>count($beta)) {
+            throw new InvalidArgumentException("beta LinearBuffer is too small.");
+        }
+        if($offsetC+$group_count>count($offsetsC)) {
+            throw new InvalidArgumentException("offsetsC LinearBuffer is too small.");
+        }
+        if($offsetsA->dtype()!==NDArray::int64 && $offsetsA->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsA LinearBuffer data type must be int64.");
+        }
+        if($offsetsB->dtype()!==NDArray::int64 && $offsetsB->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsB LinearBuffer data type must be int64.");
+        }
+        if($offsetsC->dtype()!==NDArray::int64 && $offsetsC->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsC LinearBuffer data type must be int64.");
+        }
+        // Check Buffer X and Y
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()||
+            $A->dtype()!=$alpha->dtype()||$A->dtype()!=$beta->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,B,C,alpha and beta");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+        $C_p = $ffi->cast("cl_mem",$C->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemmGrouped(
+                    $order,
+                    $transA,
+                    $transB,
+                    $ffi->cast("size_t *",$m->addr(0)),
+                    $ffi->cast("size_t *",$n->addr(0)),
+                    $ffi->cast("size_t *",$k->addr(0)),
+                    $alpha->addr($offsetAlpha),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ffi->cast("size_t *",$ldA->addr(0)),
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ffi->cast("size_t *",$ldB->addr(0)),
+                    $beta->addr($offsetBeta),
+                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ffi->cast("size_t *",$ldC->addr(0)),
+                    $group_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemmGrouped(
+                    $order,
+                    $transA,
+                    $transB,
+                    $ffi->cast("size_t *",$m->addr(0)),
+                    $ffi->cast("size_t *",$n->addr(0)),
+                    $ffi->cast("size_t *",$k->addr(0)),
+                    $alpha->addr($offsetAlpha),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ffi->cast("size_t *",$ldA->addr(0)),
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ffi->cast("size_t *",$ldB->addr(0)),
+                    $beta->addr($offsetBeta),
+                    $C_p, $ffi->cast("size_t *",$offsetsC->addr($offsetC)), $ffi->cast("size_t *",$ldC->addr(0)),
+                    $group_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmGrouped error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  On Linux, real matrices with m, n and k up to 32 are multiplied by
+     *  a kernel compiled for the shape instead of the generic batched one.
+     */
+    public function gemmStridedBatched(
+        int $order,
+        int $transA,
+        int $transB,
+        int $m,
+        int $n,
+        int $k,
+        float|object $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
+        float|object $beta,
+        DeviceBuffer $C, int $offsetC, int $ldC, int $strideC,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->alt;
+        if($m<=0) {
+            throw new InvalidArgumentException("m must be greater than zero");
+        }
+        if($n<=0) {
+            throw new InvalidArgumentException("n must be greater than zero");
+        }
+        if($k<=0) {
+            throw new InvalidArgumentException("k must be greater than zero");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($offsetC<0) {
+            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+
+        // Check Buffer X and Y
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,B and C");
+        }
+        // CLBlast does not support ConjNoTrans
+        if($transA==BLASIF::ConjNoTrans) {
+            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
+        }
+        if($transB==BLASIF::ConjNoTrans) {
+            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+        $C_p = $ffi->cast("cl_mem",$C->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemmStridedBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA,$strideA,
+                    $B_p, $offsetB, $ldB,$strideB,
+                    $beta,
+                    $C_p, $offsetC, $ldC,$strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemmStridedBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA,$strideA,
+                    $B_p, $offsetB, $ldB,$strideB,
+                    $beta,
+                    $C_p, $offsetC, $ldC,$strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::complex64:{
+                $alpha = $this->toComplex($alpha,$A->dtype());
+                $beta = $this->toComplex($beta,$A->dtype());
+                $status = $alt->CLBlastCgemmStridedBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA,$strideA,
+                    $B_p, $offsetB, $ldB,$strideB,
+                    $beta,
+                    $C_p, $offsetC, $ldC,$strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::complex128:{
+                $alpha = $this->toComplex($alpha,$A->dtype());
+                $beta = $this->toComplex($beta,$A->dtype());
+                $status = $alt->CLBlastZgemmStridedBatched(
+                    $order,
+                    $transA,
+                    $transB,
+                    $m, $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA,$strideA,
+                    $B_p, $offsetB, $ldB,$strideB,
+                    $beta,
+                    $C_p, $offsetC, $ldC,$strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemmBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Solve A * X = B iteratively on the device.
+     *    SOLVER_CG:       A must be symmetric positive definite
+     *    SOLVER_BICGSTAB: A must be nonsingular
+     *  X holds the initial guess and receives the solution.
+     *  The residual norm is read back every checkInterval iterations
+     *  and the iteration stops when ||r|| <= tol*||B||.
+     *  Returns [iterations, relative residual].
+     */
+    public function solve(
+        int $method,
+        int $order,
+        int $n,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB,
+        DeviceBuffer $X, int $offsetX,
+        float $tol,
+        int $maxIterations,
+        int $checkInterval,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : array
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('solve');
+        if($method!=self::SOLVER_CG && $method!=self::SOLVER_BICGSTAB) {
+            throw new InvalidArgumentException("Unknown solver method: $method");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($maxIterations<0) {
+            throw new InvalidArgumentException("maxIterations must be greater than zero or equal");
+        }
+        if($checkInterval<1) {
+            throw new InvalidArgumentException("checkInterval must be greater than zero");
+        }
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,B and X");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+        $iterations = $ffi->new("size_t[1]");
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $residual = $ffi->new("float[1]");
+                $status = $alt->CLBlastSsolve(
+                    $method,
+                    $order,
+                    $n,
+                    $A_p, $offsetA, $ldA,
+                    $B_p, $offsetB,
+                    $X_p, $offsetX,
+                    $tol, $maxIterations, $checkInterval,
+                    $iterations, $residual,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $residual = $ffi->new("double[1]");
+                $status = $alt->CLBlastDsolve(
+                    $method,
+                    $order,
+                    $n,
+                    $A_p, $offsetA, $ldA,
+                    $B_p, $offsetB,
+                    $X_p, $offsetX,
+                    $tol, $maxIterations, $checkInterval,
+                    $iterations, $residual,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?solve error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+        return [$iterations[0], $residual[0]];
+    }
+
+    /**
+     *  Cholesky factorization of a symmetric positive definite matrix.
+     *    uplo=Lower: A = L * L^T,  uplo=Upper: A = U^T * U
+     *  Only the triangle of uplo is referenced and overwritten.
+     *  info (int32) receives 0, or i when the leading minor of order i
+     *  is not positive definite.
+     */
+    public function potrf(
+        int $order,
+        int $uplo,
+        int $n,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $info, int $offsetInfo,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('potrf');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetInfo<0) {
+            throw new InvalidArgumentException("offsetInfo must be greater than zero or equal");
+        }
+        if($ldA<$n) {
+            throw new InvalidArgumentException("ldA must be greater than n or equal");
+        }
+        if($info->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("info must be int32");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $info_p = $ffi->cast("cl_mem",$info->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSpotrf(
+                    $order,
+                    $uplo,
+                    $n,
+                    $A_p, $offsetA, $ldA,
+                    $info_p, $offsetInfo,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDpotrf(
+                    $order,
+                    $uplo,
+                    $n,
+                    $A_p, $offsetA, $ldA,
+                    $info_p, $offsetInfo,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?potrf error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Solve A * X = B with the Cholesky factor of A computed by potrf.
+     *  B (n x nrhs) receives X.
+     */
+    public function potrs(
+        int $order,
+        int $uplo,
+        int $n,
+        int $nrhs,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('potrs');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($nrhs<0) {
+            throw new InvalidArgumentException("nrhs must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSpotrs(
+                    $order,
+                    $uplo,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA,
+                    $B_p, $offsetB, $ldB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDpotrs(
+                    $order,
+                    $uplo,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA,
+                    $B_p, $offsetB, $ldB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?potrs error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  LU factorization with partial pivoting: P * A = L * U
+     *  L (unit lower) and U are stored in A.
+     *  ipiv (int32, min(m,n)) receives the 1-based row interchanged with row i.
+     *  info (int32) receives 0, or i when U(i,i) is exactly zero.
+     */
+    public function getrf(
+        int $order,
+        int $m,
+        int $n,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $ipiv, int $offsetIpiv,
+        DeviceBuffer $info, int $offsetInfo,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('getrf');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetIpiv<0) {
+            throw new InvalidArgumentException("offsetIpiv must be greater than zero or equal");
+        }
+        if($offsetInfo<0) {
+            throw new InvalidArgumentException("offsetInfo must be greater than zero or equal");
+        }
+        if($ipiv->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("ipiv must be int32");
+        }
+        if($info->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("info must be int32");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $ipiv_p = $ffi->cast("cl_mem",$ipiv->_getId());
+        $info_p = $ffi->cast("cl_mem",$info->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgetrf(
+                    $order,
+                    $m, $n,
+                    $A_p, $offsetA, $ldA,
+                    $ipiv_p, $offsetIpiv,
+                    $info_p, $offsetInfo,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgetrf(
+                    $order,
+                    $m, $n,
+                    $A_p, $offsetA, $ldA,
+                    $ipiv_p, $offsetIpiv,
+                    $info_p, $offsetInfo,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?getrf error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Solve op(A) * X = B with the LU factors of getrf.
+     *  trans is NoTrans or Trans. B (n x nrhs) receives X.
+     */
+    public function getrs(
+        int $order,
+        int $trans,
+        int $n,
+        int $nrhs,
+        DeviceBuffer $A, int $offsetA, int $ldA,
+        DeviceBuffer $ipiv, int $offsetIpiv,
+        DeviceBuffer $B, int $offsetB, int $ldB,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('getrs');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($nrhs<0) {
+            throw new InvalidArgumentException("nrhs must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetIpiv<0) {
+            throw new InvalidArgumentException("offsetIpiv must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($ipiv->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("ipiv must be int32");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $ipiv_p = $ffi->cast("cl_mem",$ipiv->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgetrs(
+                    $order,
+                    $trans,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA,
+                    $ipiv_p, $offsetIpiv,
+                    $B_p, $offsetB, $ldB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgetrs(
+                    $order,
+                    $trans,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA,
+                    $ipiv_p, $offsetIpiv,
+                    $B_p, $offsetB, $ldB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?getrs error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  getrf of batch_count square matrices of n x n.
+     *  The i-th matrix starts at offsetA+i*strideA and its pivots at offsetIpiv+i*strideIpiv.
+     *  info receives batch_count results from offsetInfo.
+     */
+    public function getrfBatched(
+        int $order,
+        int $n,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $ipiv, int $offsetIpiv, int $strideIpiv,
+        DeviceBuffer $info, int $offsetInfo,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('getrfBatched');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetIpiv<0) {
+            throw new InvalidArgumentException("offsetIpiv must be greater than zero or equal");
+        }
+        if($offsetInfo<0) {
+            throw new InvalidArgumentException("offsetInfo must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($ipiv->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("ipiv must be int32");
+        }
+        if($info->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("info must be int32");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $ipiv_p = $ffi->cast("cl_mem",$ipiv->_getId());
+        $info_p = $ffi->cast("cl_mem",$info->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgetrfBatched(
+                    $order,
+                    $n,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $ipiv_p, $offsetIpiv, $strideIpiv,
+                    $info_p, $offsetInfo,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgetrfBatched(
+                    $order,
+                    $n,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $ipiv_p, $offsetIpiv, $strideIpiv,
+                    $info_p, $offsetInfo,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?getrfBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  getrs of batch_count systems factorized by getrfBatched.
+     */
+    public function getrsBatched(
+        int $order,
+        int $trans,
+        int $n,
+        int $nrhs,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $ipiv, int $offsetIpiv, int $strideIpiv,
+        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('getrsBatched');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($nrhs<0) {
+            throw new InvalidArgumentException("nrhs must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetIpiv<0) {
+            throw new InvalidArgumentException("offsetIpiv must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($ipiv->dtype()!=NDArray::int32) {
+            throw new InvalidArgumentException("ipiv must be int32");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $ipiv_p = $ffi->cast("cl_mem",$ipiv->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgetrsBatched(
+                    $order,
+                    $trans,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $ipiv_p, $offsetIpiv, $strideIpiv,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgetrsBatched(
+                    $order,
+                    $trans,
+                    $n, $nrhs,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $ipiv_p, $offsetIpiv, $strideIpiv,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?getrsBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  B := alpha * op(A)^-1 * B (Left) or B := alpha * B * op(A)^-1 (Right) for batch_count matrices.
+     *  The i-th A and B start at offsetA+i*strideA and offsetB+i*strideB.
+     */
+    public function trsmStridedBatched(
+        int $order,
+        int $side,
+        int $uplo,
+        int $trans,
+        int $diag,
+        int $m,
+        int $n,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('trsmStridedBatched');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastStrsmStridedBatched(
+                    $order,
+                    $side,
+                    $uplo,
+                    $trans,
+                    $diag,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDtrsmStridedBatched(
+                    $order,
+                    $side,
+                    $uplo,
+                    $trans,
+                    $diag,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?trsmStridedBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  B := alpha * op(A) * B (Left) or B := alpha * B * op(A) (Right) for batch_count matrices.
+     *  The i-th A and B start at offsetA+i*strideA and offsetB+i*strideB.
+     */
+    public function trmmStridedBatched(
+        int $order,
+        int $side,
+        int $uplo,
+        int $trans,
+        int $diag,
+        int $m,
+        int $n,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('trmmStridedBatched');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastStrmmStridedBatched(
+                    $order,
+                    $side,
+                    $uplo,
+                    $trans,
+                    $diag,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDtrmmStridedBatched(
+                    $order,
+                    $side,
+                    $uplo,
+                    $trans,
+                    $diag,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?trmmStridedBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C := alpha * op(A) * op(A)^T + beta * C for batch_count matrices.
+     *  The i-th A and C start at offsetA+i*strideA and offsetC+i*strideC.
+     */
+    public function syrkStridedBatched(
+        int $order,
+        int $uplo,
+        int $trans,
+        int $n,
+        int $k,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        float $beta,
+        DeviceBuffer $C, int $offsetC, int $ldC, int $strideC,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('syrkStridedBatched');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($k<0) {
+            throw new InvalidArgumentException("k must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetC<0) {
+            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and C");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $C_p = $ffi->cast("cl_mem",$C->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSsyrkStridedBatched(
+                    $order,
+                    $uplo,
+                    $trans,
+                    $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $beta,
+                    $C_p, $offsetC, $ldC, $strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDsyrkStridedBatched(
+                    $order,
+                    $uplo,
+                    $trans,
+                    $n, $k,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $beta,
+                    $C_p, $offsetC, $ldC, $strideC,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?syrkStridedBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y := alpha * op(A) * X + beta * Y for batch_count matrices and vectors.
+     *  The i-th A, X and Y start at offsetA+i*strideA, offsetX+i*strideX and offsetY+i*strideY.
+     */
+    public function gemvStridedBatched(
+        int $order,
+        int $trans,
+        int $m,
+        int $n,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $X, int $offsetX, int $incX, int $strideX,
+        float $beta,
+        DeviceBuffer $Y, int $offsetY, int $incY, int $strideY,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('gemvStridedBatched');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($A->dtype()!=$X->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and X");
+        }
+        if($A->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and Y");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSgemvStridedBatched(
+                    $order,
+                    $trans,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $X_p, $offsetX, $incX, $strideX,
+                    $beta,
+                    $Y_p, $offsetY, $incY, $strideY,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDgemvStridedBatched(
+                    $order,
+                    $trans,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $X_p, $offsetX, $incX, $strideX,
+                    $beta,
+                    $Y_p, $offsetY, $incY, $strideY,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?gemvStridedBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  B[i,j] := op(A[i,0,j], ... A[i,n-1,j]) for A of [m,n,k] and B of [m,k].
+     *  Rows of a 2D array are reduced with k=1 and columns with m=1.
+     *  op is REDUCE_SUM, REDUCE_MEAN, REDUCE_MAX, REDUCE_MIN, REDUCE_ARGMAX or REDUCE_ARGMIN.
+     *  B is int32 for REDUCE_ARGMAX and REDUCE_ARGMIN, otherwise the type of A.
+     *  A and B must hold m*n*k and m*k elements past their offsets.
+     *  NaN propagates: max and min give NaN and argmax and argmin give the first NaN.
+     */
+    public function reduce(
+        int $op,
+        int $m,
+        int $n,
+        int $k,
+        DeviceBuffer $A, int $offsetA,
+        DeviceBuffer $B, int $offsetB,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('reduce');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($k<0) {
+            throw new InvalidArgumentException("k must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($n<=0) {
+            throw new InvalidArgumentException("n must be greater than zero");
+        }
+        if($op==self::REDUCE_ARGMAX || $op==self::REDUCE_ARGMIN) {
+            if($B->dtype()!=NDArray::int32) {
+                throw new InvalidArgumentException("B must be int32");
+            }
+        } elseif($op>=self::REDUCE_SUM && $op<=self::REDUCE_MIN) {
+            if($A->dtype()!=$B->dtype()) {
+                throw new InvalidArgumentException("Unmatch data type for A and B");
+            }
+        } else {
+            throw new InvalidArgumentException("Unknown operation: $op");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSreduce(
+                    $op,
+                    $m, $n, $k,
+                    $A_p, $offsetA,
+                    $B_p, $offsetB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDreduce(
+                    $op,
+                    $m, $n, $k,
+                    $A_p, $offsetA,
+                    $B_p, $offsetB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?reduce error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Statistics of A[i,0,j] ... A[i,n-1,j] for A of [m,n,k] in one pass.
+     *  B of [m,k,4] receives sum, sum of squares, min and max.
+     *  Rows are segmented with k=1 (layer norm) and columns with m=1 (batch norm).
+     *  min and max propagate NaN as in reduce. A and B must hold m*n*k and m*k*4
+     *  elements past their offsets.
+     */
+    public function reduceStats(
+        int $m,
+        int $n,
+        int $k,
+        DeviceBuffer $A, int $offsetA,
+        DeviceBuffer $B, int $offsetB,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('reduceStats');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($k<0) {
+            throw new InvalidArgumentException("k must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($n<=0) {
+            throw new InvalidArgumentException("n must be greater than zero");
+        }
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSreduceStats(
+                    $m, $n, $k,
+                    $A_p, $offsetA,
+                    $B_p, $offsetB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDreduceStats(
+                    $m, $n, $k,
+                    $A_p, $offsetA,
+                    $B_p, $offsetB,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?reduceStats error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y := f(X) for each element of an N-d array of shape.
+     *  op is one of the UNARY_* constants. alpha and beta are the parameters of
+     *  UNARY_CLAMP (min and max), UNARY_POW (exponent) and UNARY_AFFINE (alpha*x+beta).
+     *  Strides are in elements; null means C-contiguous. A stride of 0 repeats an element
+     *  of X. Every element must lie in its buffer and the elements of Y must not overlap.
+     *
+     *  @param array<int> $shape
+     *  @param array<int>|null $stridesX
+     *  @param array<int>|null $stridesY
+     */
+    public function unary(
+        int $op,
+        float $alpha,
+        float $beta,
+        array $shape,
+        DeviceBuffer $X, int $offsetX, ?array $stridesX,
+        DeviceBuffer $Y, int $offsetY, ?array $stridesY,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('unary');
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        foreach($shape as $size) {
+            if($size<0) {
+                throw new InvalidArgumentException("shape must not contain negative sizes");
+            }
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        $rank = count($shape);
+        $shape_p = $this->sizeArray($shape);
+        $stridesX_p = $this->longArray($this->broadcastStrides($shape,$shape,$stridesX,"X"));
+        $stridesY_p = $this->longArray($this->broadcastStrides($shape,$shape,$stridesY,"Y"));
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHunary(
+                    $op,
+                    $rank, $shape_p,
+                    $alpha, $beta,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSunary(
+                    $op,
+                    $rank, $shape_p,
+                    $alpha, $beta,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDunary(
+                    $op,
+                    $rank, $shape_p,
+                    $alpha, $beta,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?unary error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  C := f(A, B) for each element, broadcasting A and B as NumPy does.
+     *  op is one of the BINARY_* constants. C has the broadcasted shape of A and B.
+     *  Strides are in elements; null means C-contiguous. Every element must lie in its
+     *  buffer and the elements of C must not overlap.
+     *
+     *  @param array<int> $shapeA
+     *  @param array<int>|null $stridesA
+     *  @param array<int> $shapeB
+     *  @param array<int>|null $stridesB
+     *  @param array<int>|null $stridesC
+     */
+    public function binary(
+        int $op,
+        array $shapeA, DeviceBuffer $A, int $offsetA, ?array $stridesA,
+        array $shapeB, DeviceBuffer $B, int $offsetB, ?array $stridesB,
+        DeviceBuffer $C, int $offsetC, ?array $stridesC,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('binary');
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($offsetC<0) {
+            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        }
+        foreach($shapeA as $size) {
+            if($size<0) {
+                throw new InvalidArgumentException("shapeA must not contain negative sizes");
+            }
+        }
+        foreach($shapeB as $size) {
+            if($size<0) {
+                throw new InvalidArgumentException("shapeB must not contain negative sizes");
+            }
+        }
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A, B and C");
+        }
+        $shape = $this->broadcastShape($shapeA,$shapeB);
+        $rank = count($shape);
+        $shape_p = $this->sizeArray($shape);
+        $stridesA_p = $this->longArray($this->broadcastStrides($shape,$shapeA,$stridesA,"A"));
+        $stridesB_p = $this->longArray($this->broadcastStrides($shape,$shapeB,$stridesB,"B"));
+        $stridesC_p = $this->longArray($this->broadcastStrides($shape,$shape,$stridesC,"C"));
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
+        $C_p = $ffi->cast("cl_mem",$C->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHbinary(
+                    $op,
+                    $rank, $shape_p,
+                    $A_p, $offsetA, $stridesA_p,
+                    $B_p, $offsetB, $stridesB_p,
+                    $C_p, $offsetC, $stridesC_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSbinary(
+                    $op,
+                    $rank, $shape_p,
+                    $A_p, $offsetA, $stridesA_p,
+                    $B_p, $offsetB, $stridesB_p,
+                    $C_p, $offsetC, $stridesC_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDbinary(
+                    $op,
+                    $rank, $shape_p,
+                    $A_p, $offsetA, $stridesA_p,
+                    $B_p, $offsetB, $stridesB_p,
+                    $C_p, $offsetC, $stridesC_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?binary error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y := expression for each element, in one pass over the inputs.
+     *  The expression is "t0 = ...; t1 = ...; result" where the statements before the
+     *  result define temporaries. It can use the inputs x0..x7, the scalars s0..s7,
+     *  numbers, the operators of C and exp, log, sqrt, rsqrt, tanh, sin, cos, erf,
+     *  fabs, floor, ceil, fmax, fmin, pow, relu and sigmoid. For example
+     *  "t0 = s0*x0 + x1; relu(t0)*x2".
+     *  Each input is [DeviceBuffer, offset, shape (default: shape), strides (default: C-contiguous)]
+     *  and is broadcasted to shape as NumPy does. Every element must lie in its buffer
+     *  and the elements of Y must not overlap.
+     *  The kernel is compiled on the first use of each expression text.
+     *
+     *  @param array<int> $shape
+     *  @param array<array{0:DeviceBuffer,1:int,2?:array<int>|null,3?:array<int>|null}> $inputs
+     *  @param array<float> $scalars
+     *  @param array<int>|null $stridesY
+     */
+    public function fused(
+        string $expression,
+        array $shape,
+        array $inputs,
+        array $scalars,
+        DeviceBuffer $Y, int $offsetY, ?array $stridesY,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('fused');
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if(count($inputs)>8 || count($scalars)>8) {
+            throw new InvalidArgumentException("Up to 8 inputs and 8 scalars are supported");
+        }
+        $rank = count($shape);
+        $shape_p = $this->sizeArray($shape);
+        $inputCount = count($inputs);
+        $buffers_p = $ffi->new("cl_mem[".max(1,$inputCount)."]");
+        $offsets = [];
+        $strides = [];
+        foreach(array_values($inputs) as $i => $input) {
+            [$X, $offsetX] = $input;
+            $shapeX = $input[2] ?? $shape;
+            $stridesX = $input[3] ?? null;
+            if(!($X instanceof DeviceBuffer)) {
+                throw new InvalidArgumentException("input $i must be a DeviceBuffer");
+            }
+            if($X->dtype()!=$Y->dtype()) {
+                throw new InvalidArgumentException("Unmatch data type for input $i and Y");
+            }
+            if($offsetX<0) {
+                throw new InvalidArgumentException("offset of input $i must be greater than zero or equal");
+            }
+            $buffers_p[$i] = $ffi->cast("cl_mem",$X->_getId());
+            $offsets[] = $offsetX;
+            $strides = array_merge($strides,$this->broadcastStrides($shape,$shapeX,$stridesX,"input $i"));
+        }
+        $offsets_p = $this->sizeArray($offsets);
+        $strides_p = $this->longArray($strides);
+        $stridesY_p = $this->longArray($this->broadcastStrides($shape,$shape,$stridesY,"Y"));
+        $scalarCount = count($scalars);
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($Y->dtype()) {
+            case NDArray::float16:{
+                $scalars_p = $ffi->new("float[".max(1,$scalarCount)."]");
+                foreach(array_values($scalars) as $i => $value) {
+                    $scalars_p[$i] = $value;
+                }
+                $status = $alt->CLBlastHfused(
+                    $expression,
+                    $rank, $shape_p,
+                    $inputCount,
+                    $buffers_p, $offsets_p, $strides_p,
+                    $scalarCount, $scalars_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $scalars_p = $ffi->new("float[".max(1,$scalarCount)."]");
+                foreach(array_values($scalars) as $i => $value) {
+                    $scalars_p[$i] = $value;
+                }
+                $status = $alt->CLBlastSfused(
+                    $expression,
+                    $rank, $shape_p,
+                    $inputCount,
+                    $buffers_p, $offsets_p, $strides_p,
+                    $scalarCount, $scalars_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $scalars_p = $ffi->new("double[".max(1,$scalarCount)."]");
+                foreach(array_values($scalars) as $i => $value) {
+                    $scalars_p[$i] = $value;
+                }
+                $status = $alt->CLBlastDfused(
+                    $expression,
+                    $rank, $shape_p,
+                    $inputCount,
+                    $buffers_p, $offsets_p, $strides_p,
+                    $scalarCount, $scalars_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?fused error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y[i,j] := exp(X[i,j]) / sum_j exp(X[i,j]) for each of m rows of n elements.
+     *  The maximum of each row is subtracted first for stability.
+     *  Elements of -INF are masked out and a fully masked row gives 0.
+     *  Rows start every ldX and ldY elements. X and Y may be the same buffer.
+     *  Both must hold the m rows past their offsets.
+     */
+    public function softmax(
+        int $m,
+        int $n,
+        DeviceBuffer $X, int $offsetX, int $ldX,
+        DeviceBuffer $Y, int $offsetY, int $ldY,
+        CommandQueue $queue,
+        ?EventList $event=null,
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('softmax');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($ldX<$n || $ldY<$n) {
+            throw new InvalidArgumentException("ldX and ldY must be greater than n or equal");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHsoftmax(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSsoftmax(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDsoftmax(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?softmax error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y[i,j] := X[i,j] - log(sum_j exp(X[i,j])) for each of m rows of n elements.
+     *  The maximum of each row is subtracted first for stability.
+     *  Elements of -INF are masked out and a fully masked row gives -INF.
+     *  Rows start every ldX and ldY elements. X and Y may be the same buffer.
+     *  Both must hold the m rows past their offsets.
+     */
+    public function logSoftmax(
+        int $m,
+        int $n,
+        DeviceBuffer $X, int $offsetX, int $ldX,
+        DeviceBuffer $Y, int $offsetY, int $ldY,
+        CommandQueue $queue,
         ?EventList $event=null,
     ) : void
     {
         $ffi = $this->ffi;
-        $alt = $this->alt;
-        if($m<=0) {
-            throw new InvalidArgumentException("m must be greater than zero");
+        $alt = $this->platformLib('logSoftmax');
+        if($m<0) {
+            throw new InvalidArgumentException("m must be greater than zero or equal");
+        }
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($ldX<$n || $ldY<$n) {
+            throw new InvalidArgumentException("ldX and ldY must be greater than n or equal");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHsoftmax(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSsoftmax(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDsoftmax(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX, $ldX,
+                    $Y_p, $offsetY, $ldY,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?logSoftmax error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Max (POOL_MAX) or average (POOL_AVG) pooling of X [batch_count][channels][height][width]
+     *  to Y [batch_count][channels][output_h][output_w] with
+     *    output_h = (height + 2*pad_h - pool_h) / stride_h + 1
+     *  Max pooling writes the position y*width+x of each maximum in its image
+     *  to Indices (int32) for pool2dBackward. Average pooling does not count the padding.
+     */
+    public function pool2d(
+        int $mode,
+        int $batch_count,
+        int $channels, int $height, int $width,
+        int $pool_h, int $pool_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Y, int $offsetY,
+        ?DeviceBuffer $Indices, int $offsetIndices,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('pool2d');
+        if($mode!=self::POOL_MAX && $mode!=self::POOL_AVG) {
+            throw new InvalidArgumentException("Unknown pooling mode: $mode");
+        }
+        if($batch_count<0 || $channels<0 || $height<0 || $width<0) {
+            throw new InvalidArgumentException("batch_count, channels, height and width must be greater than zero or equal");
+        }
+        if($pool_h<=0 || $pool_w<=0 || $stride_h<=0 || $stride_w<=0) {
+            throw new InvalidArgumentException("pool size and stride must be greater than zero");
+        }
+        if($pad_h<0 || $pad_w<0 || $pad_h>=$pool_h || $pad_w>=$pool_w) {
+            throw new InvalidArgumentException("pad must be greater than zero or equal and smaller than the pool size");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($offsetIndices<0) {
+            throw new InvalidArgumentException("offsetIndices must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        if($mode==self::POOL_MAX) {
+            if($Indices===null) {
+                throw new InvalidArgumentException("Indices is required for max pooling");
+            }
+            if($Indices->dtype()!=NDArray::int32) {
+                throw new InvalidArgumentException("Indices must be int32");
+            }
+        } else {
+            // not used by the average pooling
+            $Indices = $Y;
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+        $Indices_p = $ffi->cast("cl_mem",$Indices->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSpool2d(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $pool_h, $pool_w,
+                    $pad_h, $pad_w,
+                    $stride_h, $stride_w,
+                    $X_p, $offsetX,
+                    $Y_p, $offsetY,
+                    $Indices_p, $offsetIndices,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDpool2d(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $pool_h, $pool_w,
+                    $pad_h, $pad_w,
+                    $stride_h, $stride_w,
+                    $X_p, $offsetX,
+                    $Y_p, $offsetY,
+                    $Indices_p, $offsetIndices,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?pool2d error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of pool2d. dX [batch_count][channels][height][width] is overwritten;
+     *  max pooling routes each element of dY to the position in Indices.
+     */
+    public function pool2dBackward(
+        int $mode,
+        int $batch_count,
+        int $channels, int $height, int $width,
+        int $pool_h, int $pool_w,
+        int $pad_h, int $pad_w,
+        int $stride_h, int $stride_w,
+        DeviceBuffer $dY, int $offsetdY,
+        ?DeviceBuffer $Indices, int $offsetIndices,
+        DeviceBuffer $dX, int $offsetdX,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('pool2dBackward');
+        if($mode!=self::POOL_MAX && $mode!=self::POOL_AVG) {
+            throw new InvalidArgumentException("Unknown pooling mode: $mode");
+        }
+        if($batch_count<0 || $channels<0 || $height<0 || $width<0) {
+            throw new InvalidArgumentException("batch_count, channels, height and width must be greater than zero or equal");
+        }
+        if($pool_h<=0 || $pool_w<=0 || $stride_h<=0 || $stride_w<=0) {
+            throw new InvalidArgumentException("pool size and stride must be greater than zero");
+        }
+        if($pad_h<0 || $pad_w<0 || $pad_h>=$pool_h || $pad_w>=$pool_w) {
+            throw new InvalidArgumentException("pad must be greater than zero or equal and smaller than the pool size");
+        }
+        if($offsetdY<0) {
+            throw new InvalidArgumentException("offsetdY must be greater than zero or equal");
+        }
+        if($offsetdX<0) {
+            throw new InvalidArgumentException("offsetdX must be greater than zero or equal");
+        }
+        if($offsetIndices<0) {
+            throw new InvalidArgumentException("offsetIndices must be greater than zero or equal");
+        }
+        if($dY->dtype()!=$dX->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for dY and dX");
+        }
+        if($mode==self::POOL_MAX) {
+            if($Indices===null) {
+                throw new InvalidArgumentException("Indices is required for max pooling");
+            }
+            if($Indices->dtype()!=NDArray::int32) {
+                throw new InvalidArgumentException("Indices must be int32");
+            }
+        } else {
+            // not used by the average pooling
+            $Indices = $dX;
+        }
+        $dY_p = $ffi->cast("cl_mem",$dY->_getId());
+        $Indices_p = $ffi->cast("cl_mem",$Indices->_getId());
+        $dX_p = $ffi->cast("cl_mem",$dX->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($dY->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSpool2dBackward(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $pool_h, $pool_w,
+                    $pad_h, $pad_w,
+                    $stride_h, $stride_w,
+                    $dY_p, $offsetdY,
+                    $Indices_p, $offsetIndices,
+                    $dX_p, $offsetdX,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDpool2dBackward(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $pool_h, $pool_w,
+                    $pad_h, $pad_w,
+                    $stride_h, $stride_w,
+                    $dY_p, $offsetdY,
+                    $Indices_p, $offsetIndices,
+                    $dX_p, $offsetdX,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?pool2dBackward error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Max or average of each image plane; Y and Indices are [batch_count][channels].
+     */
+    public function globalPool2d(
+        int $mode,
+        int $batch_count,
+        int $channels, int $height, int $width,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Y, int $offsetY,
+        ?DeviceBuffer $Indices, int $offsetIndices,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('globalPool2d');
+        if($mode!=self::POOL_MAX && $mode!=self::POOL_AVG) {
+            throw new InvalidArgumentException("Unknown pooling mode: $mode");
+        }
+        if($batch_count<0 || $channels<0 || $height<0 || $width<0) {
+            throw new InvalidArgumentException("batch_count, channels, height and width must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($offsetIndices<0) {
+            throw new InvalidArgumentException("offsetIndices must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        if($mode==self::POOL_MAX) {
+            if($Indices===null) {
+                throw new InvalidArgumentException("Indices is required for max pooling");
+            }
+            if($Indices->dtype()!=NDArray::int32) {
+                throw new InvalidArgumentException("Indices must be int32");
+            }
+        } else {
+            // not used by the average pooling
+            $Indices = $Y;
+        }
+        if($height*$width==0 && $batch_count*$channels>0) {
+            throw new InvalidArgumentException("height and width must be greater than zero");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+        $Indices_p = $ffi->cast("cl_mem",$Indices->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSglobalPool2d(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $X_p, $offsetX,
+                    $Y_p, $offsetY,
+                    $Indices_p, $offsetIndices,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDglobalPool2d(
+                    $mode, $batch_count,
+                    $channels, $height, $width,
+                    $X_p, $offsetX,
+                    $Y_p, $offsetY,
+                    $Indices_p, $offsetIndices,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?globalPool2d error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradient of globalPool2d; the pool2dBackward of a window of the whole image.
+     */
+    public function globalPool2dBackward(
+        int $mode,
+        int $batch_count,
+        int $channels, int $height, int $width,
+        DeviceBuffer $dY, int $offsetdY,
+        ?DeviceBuffer $Indices, int $offsetIndices,
+        DeviceBuffer $dX, int $offsetdX,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $this->pool2dBackward(
+            $mode,
+            $batch_count,
+            $channels, $height, $width,
+            $height, $width,
+            0, 0,
+            1, 1,
+            $dY, $offsetdY,
+            $Indices, $offsetIndices,
+            $dX, $offsetdX,
+            $queue, $event
+        );
+    }
+
+    /**
+     *  Batch normalization with given statistics (inference).
+     *    Y[i,j,l] := Gamma[j] * (X[i,j,l] - Mean[j]) / sqrt(Var[j] + epsilon) + Beta[j]
+     *  X and Y are [m][n][k] with n channels: NCHW is (batch, channels, height*width)
+     *  and NHWC is (batch*height*width, channels, 1).
+     */
+    public function batchNormInference(
+        int $m, int $n, int $k,
+        float $epsilon,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $Beta, int $offsetBeta,
+        DeviceBuffer $Mean, int $offsetMean,
+        DeviceBuffer $Var, int $offsetVar,
+        DeviceBuffer $Y, int $offsetY,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('batchNormInference');
+        if($m<0 || $n<0 || $k<0) {
+            throw new InvalidArgumentException("m, n and k must be greater than zero or equal");
+        }
+        if($epsilon<=0) {
+            throw new InvalidArgumentException("epsilon must be greater than zero");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetBeta<0) {
+            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
+        }
+        if($offsetMean<0) {
+            throw new InvalidArgumentException("offsetMean must be greater than zero or equal");
+        }
+        if($offsetVar<0) {
+            throw new InvalidArgumentException("offsetVar must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||$X->dtype()!=$Beta->dtype()||
+            $X->dtype()!=$Mean->dtype()||$X->dtype()!=$Var->dtype()||
+            $X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,Beta,Mean,Var and Y");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $Beta_p = $ffi->cast("cl_mem",$Beta->_getId());
+        $Mean_p = $ffi->cast("cl_mem",$Mean->_getId());
+        $Var_p = $ffi->cast("cl_mem",$Var->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHbatchNorm(
+                    0,
+                    $m, $n, $k,
+                    $epsilon, 0.0,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSbatchNorm(
+                    0,
+                    $m, $n, $k,
+                    $epsilon, 0.0,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDbatchNorm(
+                    0,
+                    $m, $n, $k,
+                    $epsilon, 0.0,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $Mean_p, $offsetMean,
+                    $Var_p, $offsetVar,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?batchNorm error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Batch normalization with the statistics of the batch (training).
+     *  The mean and 1/sqrt(var+epsilon) of each channel are written to SavedMean
+     *  and SavedInvStd for batchNormBackward, and the running statistics are updated as
+     *    RunningMean[j] := momentum*RunningMean[j] + (1-momentum)*mean[j]
+     *  with the variance of the batch for RunningVar.
+     */
+    public function batchNormTraining(
+        int $m, int $n, int $k,
+        float $epsilon,
+        float $momentum,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $Beta, int $offsetBeta,
+        DeviceBuffer $Y, int $offsetY,
+        DeviceBuffer $RunningMean, int $offsetRunningMean,
+        DeviceBuffer $RunningVar, int $offsetRunningVar,
+        DeviceBuffer $SavedMean, int $offsetSavedMean,
+        DeviceBuffer $SavedInvStd, int $offsetSavedInvStd,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('batchNormTraining');
+        if($m<0 || $n<0 || $k<0) {
+            throw new InvalidArgumentException("m, n and k must be greater than zero or equal");
+        }
+        if($epsilon<=0) {
+            throw new InvalidArgumentException("epsilon must be greater than zero");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetBeta<0) {
+            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($offsetRunningMean<0) {
+            throw new InvalidArgumentException("offsetRunningMean must be greater than zero or equal");
+        }
+        if($offsetRunningVar<0) {
+            throw new InvalidArgumentException("offsetRunningVar must be greater than zero or equal");
+        }
+        if($offsetSavedMean<0) {
+            throw new InvalidArgumentException("offsetSavedMean must be greater than zero or equal");
+        }
+        if($offsetSavedInvStd<0) {
+            throw new InvalidArgumentException("offsetSavedInvStd must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||$X->dtype()!=$Beta->dtype()||
+            $X->dtype()!=$Y->dtype()||$X->dtype()!=$RunningMean->dtype()||
+            $X->dtype()!=$RunningVar->dtype()||
+            $X->dtype()!=$SavedMean->dtype()||
+            $X->dtype()!=$SavedInvStd->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,Beta,Y,RunningMean,RunningVar,SavedMean and SavedInvStd");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $Beta_p = $ffi->cast("cl_mem",$Beta->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+        $RunningMean_p = $ffi->cast("cl_mem",$RunningMean->_getId());
+        $RunningVar_p = $ffi->cast("cl_mem",$RunningVar->_getId());
+        $SavedMean_p = $ffi->cast("cl_mem",$SavedMean->_getId());
+        $SavedInvStd_p = $ffi->cast("cl_mem",$SavedInvStd->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHbatchNorm(
+                    1,
+                    $m, $n, $k,
+                    $epsilon, $momentum,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $RunningMean_p, $offsetRunningMean,
+                    $RunningVar_p, $offsetRunningVar,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSbatchNorm(
+                    1,
+                    $m, $n, $k,
+                    $epsilon, $momentum,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $RunningMean_p, $offsetRunningMean,
+                    $RunningVar_p, $offsetRunningVar,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDbatchNorm(
+                    1,
+                    $m, $n, $k,
+                    $epsilon, $momentum,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $RunningMean_p, $offsetRunningMean,
+                    $RunningVar_p, $offsetRunningVar,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?batchNorm error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradients of batchNormTraining from the saved statistics.
+     *  dX is overwritten, dGamma and dBeta are the sums over each channel.
+     */
+    public function batchNormBackward(
+        int $m, int $n, int $k,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $SavedMean, int $offsetSavedMean,
+        DeviceBuffer $SavedInvStd, int $offsetSavedInvStd,
+        DeviceBuffer $dY, int $offsetdY,
+        DeviceBuffer $dX, int $offsetdX,
+        DeviceBuffer $dGamma, int $offsetdGamma,
+        DeviceBuffer $dBeta, int $offsetdBeta,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('batchNormBackward');
+        if($m<0 || $n<0 || $k<0) {
+            throw new InvalidArgumentException("m, n and k must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetSavedMean<0) {
+            throw new InvalidArgumentException("offsetSavedMean must be greater than zero or equal");
+        }
+        if($offsetSavedInvStd<0) {
+            throw new InvalidArgumentException("offsetSavedInvStd must be greater than zero or equal");
+        }
+        if($offsetdY<0) {
+            throw new InvalidArgumentException("offsetdY must be greater than zero or equal");
+        }
+        if($offsetdX<0) {
+            throw new InvalidArgumentException("offsetdX must be greater than zero or equal");
+        }
+        if($offsetdGamma<0) {
+            throw new InvalidArgumentException("offsetdGamma must be greater than zero or equal");
+        }
+        if($offsetdBeta<0) {
+            throw new InvalidArgumentException("offsetdBeta must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||
+            $X->dtype()!=$SavedMean->dtype()||
+            $X->dtype()!=$SavedInvStd->dtype()||
+            $X->dtype()!=$dY->dtype()||$X->dtype()!=$dX->dtype()||
+            $X->dtype()!=$dGamma->dtype()||$X->dtype()!=$dBeta->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,SavedMean,SavedInvStd,dY,dX,dGamma and dBeta");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $SavedMean_p = $ffi->cast("cl_mem",$SavedMean->_getId());
+        $SavedInvStd_p = $ffi->cast("cl_mem",$SavedInvStd->_getId());
+        $dY_p = $ffi->cast("cl_mem",$dY->_getId());
+        $dX_p = $ffi->cast("cl_mem",$dX->_getId());
+        $dGamma_p = $ffi->cast("cl_mem",$dGamma->_getId());
+        $dBeta_p = $ffi->cast("cl_mem",$dBeta->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHbatchNormBackward(
+                    $m, $n, $k,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSbatchNormBackward(
+                    $m, $n, $k,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDbatchNormBackward(
+                    $m, $n, $k,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?batchNormBackward error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Layer normalization of each of m rows of n elements.
+     *    Y[i,j] := Gamma[j] * (X[i,j] - mean[i]) / sqrt(var[i] + epsilon) + Beta[j]
+     *  The mean and 1/sqrt(var+epsilon) of each row are written to SavedMean and
+     *  SavedInvStd for layerNormBackward unless they are null.
+     */
+    public function layerNorm(
+        int $m, int $n,
+        float $epsilon,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $Beta, int $offsetBeta,
+        DeviceBuffer $Y, int $offsetY,
+        ?DeviceBuffer $SavedMean, int $offsetSavedMean,
+        ?DeviceBuffer $SavedInvStd, int $offsetSavedInvStd,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('layerNorm');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($epsilon<=0) {
+            throw new InvalidArgumentException("epsilon must be greater than zero");
+        }
+        if(($SavedMean===null)!=($SavedInvStd===null)) {
+            throw new InvalidArgumentException("SavedMean and SavedInvStd must be given together");
+        }
+        $saveStats = ($SavedMean!==null);
+        if(!$saveStats) {
+            // not written
+            $SavedMean = $SavedInvStd = $Y;
+            $offsetSavedMean = $offsetSavedInvStd = $offsetY;
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetBeta<0) {
+            throw new InvalidArgumentException("offsetBeta must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($offsetSavedMean<0) {
+            throw new InvalidArgumentException("offsetSavedMean must be greater than zero or equal");
+        }
+        if($offsetSavedInvStd<0) {
+            throw new InvalidArgumentException("offsetSavedInvStd must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||$X->dtype()!=$Beta->dtype()||
+            $X->dtype()!=$Y->dtype()||$X->dtype()!=$SavedMean->dtype()||
+            $X->dtype()!=$SavedInvStd->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,Beta,Y,SavedMean and SavedInvStd");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $Beta_p = $ffi->cast("cl_mem",$Beta->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+        $SavedMean_p = $ffi->cast("cl_mem",$SavedMean->_getId());
+        $SavedInvStd_p = $ffi->cast("cl_mem",$SavedInvStd->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHlayerNorm(
+                    0, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSlayerNorm(
+                    0, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDlayerNorm(
+                    0, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Beta_p, $offsetBeta,
+                    $Y_p, $offsetY,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?layerNorm error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradients of layerNorm from the saved statistics.
+     *  dX is overwritten, dGamma and dBeta are the sums over the rows.
+     */
+    public function layerNormBackward(
+        int $m, int $n,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $SavedMean, int $offsetSavedMean,
+        DeviceBuffer $SavedInvStd, int $offsetSavedInvStd,
+        DeviceBuffer $dY, int $offsetdY,
+        DeviceBuffer $dX, int $offsetdX,
+        DeviceBuffer $dGamma, int $offsetdGamma,
+        DeviceBuffer $dBeta, int $offsetdBeta,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('layerNormBackward');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetSavedMean<0) {
+            throw new InvalidArgumentException("offsetSavedMean must be greater than zero or equal");
+        }
+        if($offsetSavedInvStd<0) {
+            throw new InvalidArgumentException("offsetSavedInvStd must be greater than zero or equal");
+        }
+        if($offsetdY<0) {
+            throw new InvalidArgumentException("offsetdY must be greater than zero or equal");
+        }
+        if($offsetdX<0) {
+            throw new InvalidArgumentException("offsetdX must be greater than zero or equal");
+        }
+        if($offsetdGamma<0) {
+            throw new InvalidArgumentException("offsetdGamma must be greater than zero or equal");
+        }
+        if($offsetdBeta<0) {
+            throw new InvalidArgumentException("offsetdBeta must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||
+            $X->dtype()!=$SavedMean->dtype()||
+            $X->dtype()!=$SavedInvStd->dtype()||
+            $X->dtype()!=$dY->dtype()||$X->dtype()!=$dX->dtype()||
+            $X->dtype()!=$dGamma->dtype()||$X->dtype()!=$dBeta->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,SavedMean,SavedInvStd,dY,dX,dGamma and dBeta");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $SavedMean_p = $ffi->cast("cl_mem",$SavedMean->_getId());
+        $SavedInvStd_p = $ffi->cast("cl_mem",$SavedInvStd->_getId());
+        $dY_p = $ffi->cast("cl_mem",$dY->_getId());
+        $dX_p = $ffi->cast("cl_mem",$dX->_getId());
+        $dGamma_p = $ffi->cast("cl_mem",$dGamma->_getId());
+        $dBeta_p = $ffi->cast("cl_mem",$dBeta->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHlayerNormBackward(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSlayerNormBackward(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDlayerNormBackward(
+                    0,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedMean_p, $offsetSavedMean,
+                    $SavedInvStd_p, $offsetSavedInvStd,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dBeta_p, $offsetdBeta,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?layerNormBackward error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  RMS normalization of each of m rows of n elements.
+     *    Y[i,j] := Gamma[j] * X[i,j] / sqrt(mean_j(X[i,j]^2) + epsilon)
+     *  The scale 1/sqrt(...) of each row is written to SavedInvRms for
+     *  rmsNormBackward unless it is null.
+     */
+    public function rmsNorm(
+        int $m, int $n,
+        float $epsilon,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $Y, int $offsetY,
+        ?DeviceBuffer $SavedInvRms, int $offsetSavedInvRms,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('rmsNorm');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($epsilon<=0) {
+            throw new InvalidArgumentException("epsilon must be greater than zero");
+        }
+        $saveStats = ($SavedInvRms!==null);
+        if(!$saveStats) {
+            // not written
+            $SavedInvRms = $Y;
+            $offsetSavedInvRms = $offsetY;
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
+        }
+        if($offsetSavedInvRms<0) {
+            throw new InvalidArgumentException("offsetSavedInvRms must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||$X->dtype()!=$Y->dtype()||
+            $X->dtype()!=$SavedInvRms->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,Y and SavedInvRms");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+        $SavedInvRms_p = $ffi->cast("cl_mem",$SavedInvRms->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHlayerNorm(
+                    1, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Gamma_p, $offsetGamma,
+                    $Y_p, $offsetY,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSlayerNorm(
+                    1, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Gamma_p, $offsetGamma,
+                    $Y_p, $offsetY,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDlayerNorm(
+                    1, $saveStats ? 1 : 0,
+                    $m, $n,
+                    $epsilon,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $Gamma_p, $offsetGamma,
+                    $Y_p, $offsetY,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?layerNorm error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Gradients of rmsNorm from the saved scales.
+     *  dX is overwritten, dGamma is the sum over the rows.
+     */
+    public function rmsNormBackward(
+        int $m, int $n,
+        DeviceBuffer $X, int $offsetX,
+        DeviceBuffer $Gamma, int $offsetGamma,
+        DeviceBuffer $SavedInvRms, int $offsetSavedInvRms,
+        DeviceBuffer $dY, int $offsetdY,
+        DeviceBuffer $dX, int $offsetdX,
+        DeviceBuffer $dGamma, int $offsetdGamma,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('rmsNormBackward');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
+        }
+        if($offsetGamma<0) {
+            throw new InvalidArgumentException("offsetGamma must be greater than zero or equal");
+        }
+        if($offsetSavedInvRms<0) {
+            throw new InvalidArgumentException("offsetSavedInvRms must be greater than zero or equal");
+        }
+        if($offsetdY<0) {
+            throw new InvalidArgumentException("offsetdY must be greater than zero or equal");
+        }
+        if($offsetdX<0) {
+            throw new InvalidArgumentException("offsetdX must be greater than zero or equal");
+        }
+        if($offsetdGamma<0) {
+            throw new InvalidArgumentException("offsetdGamma must be greater than zero or equal");
+        }
+        if($X->dtype()!=$Gamma->dtype()||
+            $X->dtype()!=$SavedInvRms->dtype()||
+            $X->dtype()!=$dY->dtype()||$X->dtype()!=$dX->dtype()||
+            $X->dtype()!=$dGamma->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X,Gamma,SavedInvRms,dY,dX and dGamma");
+        }
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Gamma_p = $ffi->cast("cl_mem",$Gamma->_getId());
+        $SavedInvRms_p = $ffi->cast("cl_mem",$SavedInvRms->_getId());
+        $dY_p = $ffi->cast("cl_mem",$dY->_getId());
+        $dX_p = $ffi->cast("cl_mem",$dX->_getId());
+        $dGamma_p = $ffi->cast("cl_mem",$dGamma->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHlayerNormBackward(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dGamma_p, $offsetdGamma,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSlayerNormBackward(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dGamma_p, $offsetdGamma,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDlayerNormBackward(
+                    1,
+                    $m, $n,
+                    $X_p, $offsetX,
+                    $Gamma_p, $offsetGamma,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $SavedInvRms_p, $offsetSavedInvRms,
+                    $dY_p, $offsetdY,
+                    $dX_p, $offsetdX,
+                    $dGamma_p, $offsetdGamma,
+                    $dGamma_p, $offsetdGamma,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?layerNormBackward error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  O := softmax(scale * Q K^T) V for each head of each batch without storing the scores.
+     *  Q [seqQ][headDim], K [seqK][headDim], V [seqK][valueDim] and O [seqQ][valueDim]
+     *  of head h of batch b start at offset + b*strideBatch + h*strideHead with rows of ld.
+     *  With causal, query i sees the keys up to i + seqK - seqQ.
+     *  headDim and valueDim are up to 256. O must not overlap K or V.
+     */
+    public function scaledDotProductAttention(
+        bool $causal,
+        int $batch_count,
+        int $heads,
+        int $seqQ, int $seqK,
+        int $headDim, int $valueDim,
+        float $scale,
+        DeviceBuffer $Q, int $offsetQ, int $ldQ, int $strideBatchQ, int $strideHeadQ,
+        DeviceBuffer $K, int $offsetK, int $ldK, int $strideBatchK, int $strideHeadK,
+        DeviceBuffer $V, int $offsetV, int $ldV, int $strideBatchV, int $strideHeadV,
+        DeviceBuffer $O, int $offsetO, int $ldO, int $strideBatchO, int $strideHeadO,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('scaledDotProductAttention');
+        if($batch_count<0 || $heads<0 || $seqQ<0 || $seqK<0) {
+            throw new InvalidArgumentException("batch_count, heads, seqQ and seqK must be greater than zero or equal");
+        }
+        if($headDim<=0 || $valueDim<=0 || $headDim>256 || $valueDim>256) {
+            throw new InvalidArgumentException("headDim and valueDim must be 1 to 256");
+        }
+        if($ldQ<$headDim || $ldK<$headDim || $ldV<$valueDim || $ldO<$valueDim) {
+            throw new InvalidArgumentException("ldQ and ldK must be greater than headDim or equal and ldV and ldO than valueDim");
+        }
+        if(min($strideBatchQ,$strideHeadQ,$strideBatchK,$strideHeadK,
+                $strideBatchV,$strideHeadV,$strideBatchO,$strideHeadO)<0) {
+            throw new InvalidArgumentException("strides must be greater than zero or equal");
+        }
+        if($offsetQ<0) {
+            throw new InvalidArgumentException("offsetQ must be greater than zero or equal");
+        }
+        if($offsetK<0) {
+            throw new InvalidArgumentException("offsetK must be greater than zero or equal");
+        }
+        if($offsetV<0) {
+            throw new InvalidArgumentException("offsetV must be greater than zero or equal");
+        }
+        if($offsetO<0) {
+            throw new InvalidArgumentException("offsetO must be greater than zero or equal");
+        }
+        if($Q->dtype()!=$K->dtype()||$Q->dtype()!=$V->dtype()||
+            $Q->dtype()!=$O->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for Q,K,V and O");
+        }
+        $Q_p = $ffi->cast("cl_mem",$Q->_getId());
+        $K_p = $ffi->cast("cl_mem",$K->_getId());
+        $V_p = $ffi->cast("cl_mem",$V->_getId());
+        $O_p = $ffi->cast("cl_mem",$O->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($Q->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHattention(
+                    $causal ? 1 : 0,
+                    $batch_count, $heads,
+                    $seqQ, $seqK,
+                    $headDim, $valueDim,
+                    $scale,
+                    $Q_p, $offsetQ, $ldQ, $strideBatchQ, $strideHeadQ,
+                    $K_p, $offsetK, $ldK, $strideBatchK, $strideHeadK,
+                    $V_p, $offsetV, $ldV, $strideBatchV, $strideHeadV,
+                    $O_p, $offsetO, $ldO, $strideBatchO, $strideHeadO,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSattention(
+                    $causal ? 1 : 0,
+                    $batch_count, $heads,
+                    $seqQ, $seqK,
+                    $headDim, $valueDim,
+                    $scale,
+                    $Q_p, $offsetQ, $ldQ, $strideBatchQ, $strideHeadQ,
+                    $K_p, $offsetK, $ldK, $strideBatchK, $strideHeadK,
+                    $V_p, $offsetV, $ldV, $strideBatchV, $strideHeadV,
+                    $O_p, $offsetO, $ldO, $strideBatchO, $strideHeadO,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDattention(
+                    $causal ? 1 : 0,
+                    $batch_count, $heads,
+                    $seqQ, $seqK,
+                    $headDim, $valueDim,
+                    $scale,
+                    $Q_p, $offsetQ, $ldQ, $strideBatchQ, $strideHeadQ,
+                    $K_p, $offsetK, $ldK, $strideBatchK, $strideHeadK,
+                    $V_p, $offsetV, $ldV, $strideBatchV, $strideHeadV,
+                    $O_p, $offsetO, $ldO, $strideBatchO, $strideHeadO,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?attention error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  Y := X with the axes permuted: axis d of Y is axis perm[d] of X.
+     *  shape and stridesX are those of X and stridesY are over the shape of Y.
+     *  Strides are in elements; null means C-contiguous. When the unit-stride
+     *  axes of X and Y differ, the copy is a tiled transpose in local memory.
+     *  Every element must lie in its buffer and the elements of Y must not overlap.
+     *
+     *  @param array<int> $shape
+     *  @param array<int> $perm
+     *  @param array<int>|null $stridesX
+     *  @param array<int>|null $stridesY
+     */
+    public function permute(
+        array $shape,
+        array $perm,
+        DeviceBuffer $X, int $offsetX, ?array $stridesX,
+        DeviceBuffer $Y, int $offsetY, ?array $stridesY,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('permute');
+        if($offsetX<0) {
+            throw new InvalidArgumentException("offsetX must be greater than zero or equal");
         }
-        if($n<=0) {
-            throw new InvalidArgumentException("n must be greater than zero");
+        if($offsetY<0) {
+            throw new InvalidArgumentException("offsetY must be greater than zero or equal");
         }
-        if($k<=0) {
-            throw new InvalidArgumentException("k must be greater than zero");
+        foreach($shape as $size) {
+            if($size<0) {
+                throw new InvalidArgumentException("shape must not contain negative sizes");
+            }
+        }
+        $shape = array_values($shape);
+        $perm = array_values($perm);
+        $rank = count($shape);
+        $sorted = $perm;
+        sort($sorted);
+        if(count($perm)!=$rank || ($rank>0 && $sorted!==range(0,$rank-1))) {
+            throw new InvalidArgumentException("perm must be a permutation of the axes of X");
+        }
+        if($X->dtype()!=$Y->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for X and Y");
+        }
+        $stridesX = $this->broadcastStrides($shape,$shape,$stridesX,"X");
+        $shapeY = [];
+        $permutedStridesX = [];
+        foreach($perm as $axis) {
+            $shapeY[] = $shape[$axis];
+            $permutedStridesX[] = $stridesX[$axis];
+        }
+        $shape_p = $this->sizeArray($shapeY);
+        $stridesX_p = $this->longArray($permutedStridesX);
+        $stridesY_p = $this->longArray($this->broadcastStrides($shapeY,$shapeY,$stridesY,"Y"));
+        $X_p = $ffi->cast("cl_mem",$X->_getId());
+        $Y_p = $ffi->cast("cl_mem",$Y->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($X->dtype()) {
+            case NDArray::float16:{
+                $status = $alt->CLBlastHpermute(
+                    $rank, $shape_p,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float32:{
+                $status = $alt->CLBlastSpermute(
+                    $rank, $shape_p,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDpermute(
+                    $rank, $shape_p,
+                    $X_p, $offsetX, $stridesX_p,
+                    $Y_p, $offsetY, $stridesY_p,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?permute error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  B[i] := alpha * op(A[i]) for a batch of matrices in one launch.
+     *  A[i] starts at offsetA + i*strideA and B[i] at offsetB + i*strideB.
+     */
+    public function omatcopyStridedBatched(
+        int $order,
+        int $trans,
+        int $m,
+        int $n,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        DeviceBuffer $B, int $offsetB, int $ldB, int $strideB,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('omatcopyStridedBatched');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        // CLBlast does not support ConjNoTrans
+        if($trans==BLASIF::ConjNoTrans) {
+            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
         }
         if($offsetA<0) {
             throw new InvalidArgumentException("offsetA must be greater than zero or equal");
@@ -702,27 +5539,117 @@ class Math
         if($offsetB<0) {
             throw new InvalidArgumentException("offsetB must be greater than zero or equal");
         }
-        if($offsetC<0) {
-            throw new InvalidArgumentException("offsetC must be greater than zero or equal");
+        if($strideA<0 || $strideB<0) {
+            throw new InvalidArgumentException("strideA and strideB must be greater than zero or equal");
         }
-        if($batch_count<0) {
-            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        if($A->dtype()!=$B->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A and B");
         }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+        $B_p = $ffi->cast("cl_mem",$B->_getId());
 
-        // Check Buffer X and Y
-        if($A->dtype()!=$B->dtype()||$A->dtype()!=$C->dtype()) {
-            throw new InvalidArgumentException("Unmatch data type for A,B and C");
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastSomatcopyStridedBatched(
+                    $order, $trans,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            case NDArray::float64:{
+                $status = $alt->CLBlastDomatcopyStridedBatched(
+                    $order, $trans,
+                    $m, $n,
+                    $alpha,
+                    $A_p, $offsetA, $ldA, $strideA,
+                    $B_p, $offsetB, $ldB, $strideB,
+                    $batch_count,
+                    $queue_p, $event_p
+                );
+                break;
+            }
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?omatcopyStridedBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  B[i] := alpha[i] * op(A[i]) for a batch of matrices in one launch.
+     *  A[i] and B[i] start at the elements offsetsA[offsetA+i] and offsetsB[offsetB+i] (int64).
+     */
+    public function omatcopyBatched(
+        int $order,
+        int $trans,
+        int $m,
+        int $n,
+        HostBuffer $alpha, int $offsetAlpha,
+        DeviceBuffer $A, HostBuffer $offsetsA, int $offsetA, int $ldA,
+        DeviceBuffer $B, HostBuffer $offsetsB, int $offsetB, int $ldB,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('omatcopyBatched');
+        if($m<0 || $n<0) {
+            throw new InvalidArgumentException("m and n must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
         }
         // CLBlast does not support ConjNoTrans
-        if($transA==BLASIF::ConjNoTrans) {
+        if($trans==BLASIF::ConjNoTrans) {
             throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
         }
-        if($transB==BLASIF::ConjNoTrans) {
-            throw new InvalidArgumentException("CLBlast does not support ConjNoTrans");
+        if($offsetAlpha<0) {
+            throw new InvalidArgumentException("offsetAlpha must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($offsetB<0) {
+            throw new InvalidArgumentException("offsetB must be greater than zero or equal");
+        }
+        if($offsetAlpha+$batch_count>count($alpha)) {
+            throw new InvalidArgumentException("alpha LinearBuffer is too small.");
+        }
+        if($offsetA+$batch_count>count($offsetsA)) {
+            throw new InvalidArgumentException("offsetsA LinearBuffer is too small.");
+        }
+        if($offsetB+$batch_count>count($offsetsB)) {
+            throw new InvalidArgumentException("offsetsB LinearBuffer is too small.");
+        }
+        if($offsetsA->dtype()!==NDArray::int64 && $offsetsA->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsA LinearBuffer data type must be int64.");
+        }
+        if($offsetsB->dtype()!==NDArray::int64 && $offsetsB->dtype()!==NDArray::uint64) {
+            throw new InvalidArgumentException("offsetsB LinearBuffer data type must be int64.");
+        }
+        if($A->dtype()!=$B->dtype()||$A->dtype()!=$alpha->dtype()) {
+            throw new InvalidArgumentException("Unmatch data type for A,B and alpha");
         }
         $A_p = $ffi->cast("cl_mem",$A->_getId());
         $B_p = $ffi->cast("cl_mem",$B->_getId());
-        $C_p = $ffi->cast("cl_mem",$C->_getId());
 
         $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
         $event_p = null;
@@ -733,68 +5660,100 @@ class Math
 
         switch($A->dtype()) {
             case NDArray::float32:{
-                $status = $ffi->CLBlastSgemmStridedBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
-                    $alpha,
-                    $A_p, $offsetA, $ldA,$strideA,
-                    $B_p, $offsetB, $ldB,$strideB,
-                    $beta,
-                    $C_p, $offsetC, $ldC,$strideC,
+                $status = $alt->CLBlastSomatcopyBatched(
+                    $order, $trans,
+                    $m, $n,
+                    $ffi->cast("float *",$alpha->addr($offsetAlpha)),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
                     $batch_count,
                     $queue_p, $event_p
                 );
                 break;
             }
             case NDArray::float64:{
-                $status = $ffi->CLBlastDgemmStridedBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
-                    $alpha,
-                    $A_p, $offsetA, $ldA,$strideA,
-                    $B_p, $offsetB, $ldB,$strideB,
-                    $beta,
-                    $C_p, $offsetC, $ldC,$strideC,
+                $status = $alt->CLBlastDomatcopyBatched(
+                    $order, $trans,
+                    $m, $n,
+                    $ffi->cast("double *",$alpha->addr($offsetAlpha)),
+                    $A_p, $ffi->cast("size_t *",$offsetsA->addr($offsetA)), $ldA,
+                    $B_p, $ffi->cast("size_t *",$offsetsB->addr($offsetB)), $ldB,
                     $batch_count,
                     $queue_p, $event_p
                 );
                 break;
             }
-            case NDArray::complex64:{
-                $alpha = $this->toComplex($alpha,$A->dtype());
-                $beta = $this->toComplex($beta,$A->dtype());
-                $status = $alt->CLBlastCgemmStridedBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
+            default: {
+                throw new InvalidArgumentException('Unsuppored data type');
+            }
+        }
+        if($status!=self::CLBlastSuccess) {
+            throw new RuntimeException("CLBlast?omatcopyBatched error=$status", $status);
+        }
+        if($event) {
+            $event->_move($event_obj);
+        }
+    }
+
+    /**
+     *  A[i] := alpha * A[i]^T in place for a batch of square matrices of n x n.
+     *  A[i] starts at offsetA + i*strideA, and the matrices must not overlap.
+     *  The result is the same for both orders.
+     */
+    public function transposeInPlace(
+        int $n,
+        float $alpha,
+        DeviceBuffer $A, int $offsetA, int $ldA, int $strideA,
+        int $batch_count,
+        CommandQueue $queue,
+        ?EventList $event=null
+    ) : void
+    {
+        $ffi = $this->ffi;
+        $alt = $this->platformLib('transposeInPlace');
+        if($n<0) {
+            throw new InvalidArgumentException("n must be greater than zero or equal");
+        }
+        if($batch_count<0) {
+            throw new InvalidArgumentException("batch_count must be greater than zero or equal");
+        }
+        if($offsetA<0) {
+            throw new InvalidArgumentException("offsetA must be greater than zero or equal");
+        }
+        if($ldA<$n) {
+            throw new InvalidArgumentException("ldA must be greater than n or equal");
+        }
+        if($strideA<0) {
+            throw new InvalidArgumentException("strideA must be greater than zero or equal");
+        }
+        if($batch_count>1 && $strideA<($n-1)*$ldA+$n) {
+            throw new InvalidArgumentException("strideA must be greater than (n-1)*ldA+n or equal");
+        }
+        $A_p = $ffi->cast("cl_mem",$A->_getId());
+
+        $queue_p = $ffi->cast("cl_command_queue*",FFI::addr($queue->_getId()));
+        $event_p = null;
+        if($event) {
+            $event_obj = $event->_ffi()->new("cl_event[1]");
+            $event_p = $ffi->cast("cl_event[1]",$event_obj);
+        }
+
+        switch($A->dtype()) {
+            case NDArray::float32:{
+                $status = $alt->CLBlastStransposeInPlace(
+                    $n,
                     $alpha,
-                    $A_p, $offsetA, $ldA,$strideA,
-                    $B_p, $offsetB, $ldB,$strideB,
-                    $beta,
-                    $C_p, $offsetC, $ldC,$strideC,
+                    $A_p, $offsetA, $ldA, $strideA,
                     $batch_count,
                     $queue_p, $event_p
                 );
                 break;
             }
-            case NDArray::complex128:{
-                $alpha = $this->toComplex($alpha,$A->dtype());
-                $beta = $this->toComplex($beta,$A->dtype());
-                $status = $alt->CLBlastZgemmStridedBatched(
-                    $order,
-                    $transA,
-                    $transB,
-                    $m, $n, $k,
+            case NDArray::float64:{
+                $status = $alt->CLBlastDtransposeInPlace(
+                    $n,
                     $alpha,
-                    $A_p, $offsetA, $ldA,$strideA,
-                    $B_p, $offsetB, $ldB,$strideB,
-                    $beta,
-                    $C_p, $offsetC, $ldC,$strideC,
+                    $A_p, $offsetA, $ldA, $strideA,
                     $batch_count,
                     $queue_p, $event_p
                 );
@@ -805,10 +5764,10 @@ class Math
             }
         }
         if($status!=self::CLBlastSuccess) {
-            throw new RuntimeException("CLBlast?gemmBatched error=$status", $status);
+            throw new RuntimeException("CLBlast?transposeInPlace error=$status", $status);
         }
         if($event) {
             $event->_move($event_obj);
         }
     }
-}
\ No newline at end of file
+}
@@ -950,4 +950,4626 @@ class LinuxPatch
             $event      // cl_event* event
             );
     }
-}
\ No newline at end of file
+
+    /**
+     * 
+     */
+    public function CLBlastCgemm3m(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $alpha,      // const cl_float2 *alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $beta,       // const cl_float2 *beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event       // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        $alpha = FFI::addr($alpha);
+        $beta  = FFI::addr($beta);
+        return $this->ffi->RindowCLBlastCgemm3m(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const cl_float2 *alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const cl_float2 *beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastZgemm3m(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $alpha,      // const cl_float2 *alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $beta,       // const cl_float2 *beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event       // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        $alpha = FFI::addr($alpha);
+        $beta  = FFI::addr($beta);
+        return $this->ffi->RindowCLBlastZgemm3m(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const cl_float2 *alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const cl_float2 *beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemmStrassen(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        float $beta,        // const float beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $depth,         // const size_t depth,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemmStrassen(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const float beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $depth,     // const size_t depth,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemmStrassen(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        float $beta,        // const double beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $depth,         // const size_t depth,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemmStrassen(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const double beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $depth,     // const size_t depth,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemmGrouped(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        object $m,          // const size_t *m,
+        object $n,          // const size_t *n,
+        object $k,          // const size_t *k,
+        object $alphas,     // const float *alphas,
+        object $a_buffer,   // const cl_mem a_buffer,
+        object $a_offsets,  // const size_t *a_offsets,
+        object $a_lds,      // const size_t *a_lds,
+        object $b_buffer,   // const cl_mem b_buffer,
+        object $b_offsets,  // const size_t *b_offsets,
+        object $b_lds,      // const size_t *b_lds,
+        object $betas,      // const float *betas,
+        object $c_buffer,   // cl_mem c_buffer,
+        object $c_offsets,  // const size_t *c_offsets,
+        object $c_lds,      // const size_t *c_lds,
+        int $group_count,   // const size_t group_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemmGrouped(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t *m,
+            $n,         // const size_t *n,
+            $k,         // const size_t *k,
+            $alphas,    // const float *alphas,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offsets, // const size_t *a_offsets,
+            $a_lds,     // const size_t *a_lds,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offsets, // const size_t *b_offsets,
+            $b_lds,     // const size_t *b_lds,
+            $betas,     // const float *betas,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offsets, // const size_t *c_offsets,
+            $c_lds,     // const size_t *c_lds,
+            $group_count,// const size_t group_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemmGrouped(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        object $m,          // const size_t *m,
+        object $n,          // const size_t *n,
+        object $k,          // const size_t *k,
+        object $alphas,     // const double *alphas,
+        object $a_buffer,   // const cl_mem a_buffer,
+        object $a_offsets,  // const size_t *a_offsets,
+        object $a_lds,      // const size_t *a_lds,
+        object $b_buffer,   // const cl_mem b_buffer,
+        object $b_offsets,  // const size_t *b_offsets,
+        object $b_lds,      // const size_t *b_lds,
+        object $betas,      // const double *betas,
+        object $c_buffer,   // cl_mem c_buffer,
+        object $c_offsets,  // const size_t *c_offsets,
+        object $c_lds,      // const size_t *c_lds,
+        int $group_count,   // const size_t group_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemmGrouped(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t *m,
+            $n,         // const size_t *n,
+            $k,         // const size_t *k,
+            $alphas,    // const double *alphas,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offsets, // const size_t *a_offsets,
+            $a_lds,     // const size_t *a_lds,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offsets, // const size_t *b_offsets,
+            $b_lds,     // const size_t *b_lds,
+            $betas,     // const double *betas,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offsets, // const size_t *c_offsets,
+            $c_lds,     // const size_t *c_lds,
+            $group_count,// const size_t group_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSscalDeviceScalar(
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $x_buffer,   // cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSscalDeviceScalar(
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $x_buffer,  // cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDscalDeviceScalar(
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $x_buffer,   // cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDscalDeviceScalar(
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $x_buffer,  // cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSaxpyDeviceScalar(
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSaxpyDeviceScalar(
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDaxpyDeviceScalar(
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDaxpyDeviceScalar(
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemvDeviceScalar(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemvDeviceScalar(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemvDeviceScalar(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemvDeviceScalar(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemmDeviceScalar(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemmDeviceScalar(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemmDeviceScalar(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $alpha_buffer,// const cl_mem alpha_buffer,
+        int $alpha_offset,  // const size_t alpha_offset,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemmDeviceScalar(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha_buffer,// const cl_mem alpha_buffer,
+            $alpha_offset,// const size_t alpha_offset,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSsolve(
+        int $method,        // const size_t method,
+        int $layout,        // const CLBlastLayout layout,
+        int $n,             // const size_t n,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $x_buffer,   // cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        float $tol,         // const float tol,
+        int $max_iterations,// const size_t max_iterations,
+        int $check_interval,// const size_t check_interval,
+        object $iterations, // size_t *iterations,
+        object $residual,   // float *residual,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSsolve(
+            $method,    // const size_t method,
+            $layout,    // const CLBlastLayout layout,
+            $n,         // const size_t n,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $x_buffer,  // cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $tol,       // const float tol,
+            $max_iterations,// const size_t max_iterations,
+            $check_interval,// const size_t check_interval,
+            $iterations,// size_t *iterations,
+            $residual,  // float *residual,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDsolve(
+        int $method,        // const size_t method,
+        int $layout,        // const CLBlastLayout layout,
+        int $n,             // const size_t n,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $x_buffer,   // cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        float $tol,         // const double tol,
+        int $max_iterations,// const size_t max_iterations,
+        int $check_interval,// const size_t check_interval,
+        object $iterations, // size_t *iterations,
+        object $residual,   // double *residual,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDsolve(
+            $method,    // const size_t method,
+            $layout,    // const CLBlastLayout layout,
+            $n,         // const size_t n,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $x_buffer,  // cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $tol,       // const double tol,
+            $max_iterations,// const size_t max_iterations,
+            $check_interval,// const size_t check_interval,
+            $iterations,// size_t *iterations,
+            $residual,  // double *residual,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSpotrf(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSpotrf(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDpotrf(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDpotrf(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSpotrs(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSpotrs(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDpotrs(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDpotrs(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgetrf(
+        int $layout,        // const CLBlastLayout layout,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $ipiv_buffer,// cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgetrf(
+            $layout,    // const CLBlastLayout layout,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $ipiv_buffer,// cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgetrf(
+        int $layout,        // const CLBlastLayout layout,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $ipiv_buffer,// cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgetrf(
+            $layout,    // const CLBlastLayout layout,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $ipiv_buffer,// cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgetrs(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $ipiv_buffer,// const cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgetrs(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $ipiv_buffer,// const cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgetrs(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $ipiv_buffer,// const cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgetrs(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $ipiv_buffer,// const cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgetrfBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $ipiv_buffer,// cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        int $ipiv_stride,   // const size_t ipiv_stride,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgetrfBatched(
+            $layout,    // const CLBlastLayout layout,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $ipiv_buffer,// cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $ipiv_stride,// const size_t ipiv_stride,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgetrfBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $n,             // const size_t n,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $ipiv_buffer,// cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        int $ipiv_stride,   // const size_t ipiv_stride,
+        object $info_buffer,// cl_mem info_buffer,
+        int $info_offset,   // const size_t info_offset,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgetrfBatched(
+            $layout,    // const CLBlastLayout layout,
+            $n,         // const size_t n,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $ipiv_buffer,// cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $ipiv_stride,// const size_t ipiv_stride,
+            $info_buffer,// cl_mem info_buffer,
+            $info_offset,// const size_t info_offset,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgetrsBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $ipiv_buffer,// const cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        int $ipiv_stride,   // const size_t ipiv_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgetrsBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $ipiv_buffer,// const cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $ipiv_stride,// const size_t ipiv_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgetrsBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $nrhs,          // const size_t nrhs,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $ipiv_buffer,// const cl_mem ipiv_buffer,
+        int $ipiv_offset,   // const size_t ipiv_offset,
+        int $ipiv_stride,   // const size_t ipiv_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgetrsBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $nrhs,      // const size_t nrhs,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $ipiv_buffer,// const cl_mem ipiv_buffer,
+            $ipiv_offset,// const size_t ipiv_offset,
+            $ipiv_stride,// const size_t ipiv_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        float $beta,        // const float beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $c_stride,      // const size_t c_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $beta,      // const float beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $c_stride,  // const size_t c_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        float $beta,        // const double beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $c_stride,      // const size_t c_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $beta,      // const double beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $c_stride,  // const size_t c_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastStrsmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $side,          // const CLBlastSide side,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $diagonal,      // const CLBlastDiagonal diagonal,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastStrsmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $side,      // const CLBlastSide side,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $diagonal,  // const CLBlastDiagonal diagonal,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDtrsmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $side,          // const CLBlastSide side,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $diagonal,      // const CLBlastDiagonal diagonal,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDtrsmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $side,      // const CLBlastSide side,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $diagonal,  // const CLBlastDiagonal diagonal,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastStrmmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $side,          // const CLBlastSide side,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $diagonal,      // const CLBlastDiagonal diagonal,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastStrmmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $side,      // const CLBlastSide side,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $diagonal,  // const CLBlastDiagonal diagonal,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDtrmmStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $side,          // const CLBlastSide side,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $diagonal,      // const CLBlastDiagonal diagonal,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDtrmmStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $side,      // const CLBlastSide side,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $diagonal,  // const CLBlastDiagonal diagonal,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSsyrkStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        float $beta,        // const float beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $c_stride,      // const size_t c_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSsyrkStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $beta,      // const float beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $c_stride,  // const size_t c_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDsyrkStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $triangle,      // const CLBlastTriangle triangle,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        float $beta,        // const double beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $c_stride,      // const size_t c_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDsyrkStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $triangle,  // const CLBlastTriangle triangle,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $beta,      // const double beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $c_stride,  // const size_t c_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemvStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        int $x_stride,      // const size_t x_stride,
+        float $beta,        // const float beta,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        int $y_stride,      // const size_t y_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemvStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $x_stride,  // const size_t x_stride,
+            $beta,      // const float beta,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $y_stride,  // const size_t y_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemvStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_inc,         // const size_t x_inc,
+        int $x_stride,      // const size_t x_stride,
+        float $beta,        // const double beta,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_inc,         // const size_t y_inc,
+        int $y_stride,      // const size_t y_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemvStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_inc,     // const size_t x_inc,
+            $x_stride,  // const size_t x_stride,
+            $beta,      // const double beta,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_inc,     // const size_t y_inc,
+            $y_stride,  // const size_t y_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSreduce(
+        int $op,            // const int op,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSreduce(
+            $op,        // const int op,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDreduce(
+        int $op,            // const int op,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDreduce(
+            $op,        // const int op,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSreduceStats(
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSreduceStats(
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDreduceStats(
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDreduceStats(
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHunary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        float $alpha,       // const float alpha,
+        float $beta,        // const float beta,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHunary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $alpha,     // const float alpha,
+            $beta,      // const float beta,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSunary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        float $alpha,       // const float alpha,
+        float $beta,        // const float beta,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSunary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $alpha,     // const float alpha,
+            $beta,      // const float beta,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDunary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        float $alpha,       // const double alpha,
+        float $beta,        // const double beta,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDunary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $alpha,     // const double alpha,
+            $beta,      // const double beta,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHbinary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $a_strides,  // const cl_long *a_strides,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $b_strides,  // const cl_long *b_strides,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        object $c_strides,  // const cl_long *c_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHbinary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_strides, // const cl_long *a_strides,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_strides, // const cl_long *b_strides,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_strides, // const cl_long *c_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSbinary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $a_strides,  // const cl_long *a_strides,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $b_strides,  // const cl_long *b_strides,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        object $c_strides,  // const cl_long *c_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSbinary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_strides, // const cl_long *a_strides,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_strides, // const cl_long *b_strides,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_strides, // const cl_long *c_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDbinary(
+        int $op,            // const int op,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        object $a_strides,  // const cl_long *a_strides,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        object $b_strides,  // const cl_long *b_strides,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        object $c_strides,  // const cl_long *c_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDbinary(
+            $op,        // const int op,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_strides, // const cl_long *a_strides,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_strides, // const cl_long *b_strides,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_strides, // const cl_long *c_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHfused(
+        string $expression, // const char *expression,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        int $inputs,        // const size_t inputs,
+        object $x_buffers,  // const cl_mem *x_buffers,
+        object $x_offsets,  // const size_t *x_offsets,
+        object $x_strides,  // const cl_long *x_strides,
+        int $scalar_count,  // const size_t scalar_count,
+        object $scalars,    // const float *scalars,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHfused(
+            $expression,// const char *expression,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $inputs,    // const size_t inputs,
+            $x_buffers, // const cl_mem *x_buffers,
+            $x_offsets, // const size_t *x_offsets,
+            $x_strides, // const cl_long *x_strides,
+            $scalar_count,// const size_t scalar_count,
+            $scalars,   // const float *scalars,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSfused(
+        string $expression, // const char *expression,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        int $inputs,        // const size_t inputs,
+        object $x_buffers,  // const cl_mem *x_buffers,
+        object $x_offsets,  // const size_t *x_offsets,
+        object $x_strides,  // const cl_long *x_strides,
+        int $scalar_count,  // const size_t scalar_count,
+        object $scalars,    // const float *scalars,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSfused(
+            $expression,// const char *expression,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $inputs,    // const size_t inputs,
+            $x_buffers, // const cl_mem *x_buffers,
+            $x_offsets, // const size_t *x_offsets,
+            $x_strides, // const cl_long *x_strides,
+            $scalar_count,// const size_t scalar_count,
+            $scalars,   // const float *scalars,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDfused(
+        string $expression, // const char *expression,
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        int $inputs,        // const size_t inputs,
+        object $x_buffers,  // const cl_mem *x_buffers,
+        object $x_offsets,  // const size_t *x_offsets,
+        object $x_strides,  // const cl_long *x_strides,
+        int $scalar_count,  // const size_t scalar_count,
+        object $scalars,    // const double *scalars,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDfused(
+            $expression,// const char *expression,
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $inputs,    // const size_t inputs,
+            $x_buffers, // const cl_mem *x_buffers,
+            $x_offsets, // const size_t *x_offsets,
+            $x_strides, // const cl_long *x_strides,
+            $scalar_count,// const size_t scalar_count,
+            $scalars,   // const double *scalars,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSgemmEpilogue(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        float $beta,        // const float beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $bias_mode,     // const int bias_mode,
+        object $bias_buffer,// const cl_mem bias_buffer,
+        int $bias_offset,   // const size_t bias_offset,
+        int $activation,    // const int activation,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSgemmEpilogue(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const float beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $bias_mode, // const int bias_mode,
+            $bias_buffer,// const cl_mem bias_buffer,
+            $bias_offset,// const size_t bias_offset,
+            $activation,// const int activation,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDgemmEpilogue(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $b_transpose,   // const CLBlastTranspose b_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // const cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        float $beta,        // const double beta,
+        object $c_buffer,   // cl_mem c_buffer,
+        int $c_offset,      // const size_t c_offset,
+        int $c_ld,          // const size_t c_ld,
+        int $bias_mode,     // const int bias_mode,
+        object $bias_buffer,// const cl_mem bias_buffer,
+        int $bias_offset,   // const size_t bias_offset,
+        int $activation,    // const int activation,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDgemmEpilogue(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $b_transpose,// const CLBlastTranspose b_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // const cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $beta,      // const double beta,
+            $c_buffer,  // cl_mem c_buffer,
+            $c_offset,  // const size_t c_offset,
+            $c_ld,      // const size_t c_ld,
+            $bias_mode, // const int bias_mode,
+            $bias_buffer,// const cl_mem bias_buffer,
+            $bias_offset,// const size_t bias_offset,
+            $activation,// const int activation,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHsoftmax(
+        int $log_softmax,   // const int log_softmax,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_ld,          // const size_t x_ld,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_ld,          // const size_t y_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHsoftmax(
+            $log_softmax,// const int log_softmax,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_ld,      // const size_t x_ld,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_ld,      // const size_t y_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSsoftmax(
+        int $log_softmax,   // const int log_softmax,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_ld,          // const size_t x_ld,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_ld,          // const size_t y_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSsoftmax(
+            $log_softmax,// const int log_softmax,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_ld,      // const size_t x_ld,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_ld,      // const size_t y_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDsoftmax(
+        int $log_softmax,   // const int log_softmax,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        int $x_ld,          // const size_t x_ld,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        int $y_ld,          // const size_t y_ld,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDsoftmax(
+            $log_softmax,// const int log_softmax,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_ld,      // const size_t x_ld,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_ld,      // const size_t y_ld,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSim2colBatched(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $kernel_h,      // const size_t kernel_h,
+        int $kernel_w,      // const size_t kernel_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        int $dilation_h,    // const size_t dilation_h,
+        int $dilation_w,    // const size_t dilation_w,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $col_buffer, // cl_mem col_buffer,
+        int $col_offset,    // const size_t col_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSim2colBatched(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $kernel_h,  // const size_t kernel_h,
+            $kernel_w,  // const size_t kernel_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dilation_h,// const size_t dilation_h,
+            $dilation_w,// const size_t dilation_w,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $col_buffer,// cl_mem col_buffer,
+            $col_offset,// const size_t col_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDim2colBatched(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $kernel_h,      // const size_t kernel_h,
+        int $kernel_w,      // const size_t kernel_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        int $dilation_h,    // const size_t dilation_h,
+        int $dilation_w,    // const size_t dilation_w,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $col_buffer, // cl_mem col_buffer,
+        int $col_offset,    // const size_t col_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDim2colBatched(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $kernel_h,  // const size_t kernel_h,
+            $kernel_w,  // const size_t kernel_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dilation_h,// const size_t dilation_h,
+            $dilation_w,// const size_t dilation_w,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $col_buffer,// cl_mem col_buffer,
+            $col_offset,// const size_t col_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastScol2imBatched(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $kernel_h,      // const size_t kernel_h,
+        int $kernel_w,      // const size_t kernel_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        int $dilation_h,    // const size_t dilation_h,
+        int $dilation_w,    // const size_t dilation_w,
+        object $col_buffer, // const cl_mem col_buffer,
+        int $col_offset,    // const size_t col_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastScol2imBatched(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $kernel_h,  // const size_t kernel_h,
+            $kernel_w,  // const size_t kernel_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dilation_h,// const size_t dilation_h,
+            $dilation_w,// const size_t dilation_w,
+            $col_buffer,// const cl_mem col_buffer,
+            $col_offset,// const size_t col_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDcol2imBatched(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $kernel_h,      // const size_t kernel_h,
+        int $kernel_w,      // const size_t kernel_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        int $dilation_h,    // const size_t dilation_h,
+        int $dilation_w,    // const size_t dilation_w,
+        object $col_buffer, // const cl_mem col_buffer,
+        int $col_offset,    // const size_t col_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDcol2imBatched(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $kernel_h,  // const size_t kernel_h,
+            $kernel_w,  // const size_t kernel_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dilation_h,// const size_t dilation_h,
+            $dilation_w,// const size_t dilation_w,
+            $col_buffer,// const cl_mem col_buffer,
+            $col_offset,// const size_t col_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmNd(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmNd(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmNd(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmNd(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmNdBackwardData(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmNdBackwardData(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmNdBackwardData(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmNdBackwardData(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmNdBackwardFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmNdBackwardFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmNdBackwardFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmNdBackwardFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSwinogradFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $tile,          // const size_t tile,
+        int $channels,      // const size_t channels,
+        int $num_kernels,   // const size_t num_kernels,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $transformed_buffer,// cl_mem transformed_buffer,
+        int $transformed_offset,// const size_t transformed_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSwinogradFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $tile,      // const size_t tile,
+            $channels,  // const size_t channels,
+            $num_kernels,// const size_t num_kernels,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $transformed_buffer,// cl_mem transformed_buffer,
+            $transformed_offset,// const size_t transformed_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDwinogradFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $tile,          // const size_t tile,
+        int $channels,      // const size_t channels,
+        int $num_kernels,   // const size_t num_kernels,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $transformed_buffer,// cl_mem transformed_buffer,
+        int $transformed_offset,// const size_t transformed_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDwinogradFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $tile,      // const size_t tile,
+            $channels,  // const size_t channels,
+            $num_kernels,// const size_t num_kernels,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $transformed_buffer,// cl_mem transformed_buffer,
+            $transformed_offset,// const size_t transformed_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmWinograd(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $tile,          // const size_t tile,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        int $kernel_transformed,// const int kernel_transformed,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmWinograd(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $tile,      // const size_t tile,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $kernel_transformed,// const int kernel_transformed,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmWinograd(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $tile,          // const size_t tile,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $num_kernels,   // const size_t num_kernels,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        int $kernel_transformed,// const int kernel_transformed,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmWinograd(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $tile,      // const size_t tile,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $num_kernels,// const size_t num_kernels,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $kernel_transformed,// const int kernel_transformed,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmGrouped(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmGrouped(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmGrouped(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $result_buffer,// cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmGrouped(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $result_buffer,// cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmGroupedBackwardData(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmGroupedBackwardData(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmGroupedBackwardData(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// const cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $im_buffer,  // cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmGroupedBackwardData(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// const cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $im_buffer, // cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSconvgemmGroupedBackwardFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSconvgemmGroupedBackwardFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDconvgemmGroupedBackwardFilter(
+        int $kernel_mode,   // const CLBlastKernelMode kernel_mode,
+        int $rank,          // const size_t rank,
+        int $channels,      // const size_t channels,
+        object $input_shape,// const size_t *input_shape,
+        object $kernel_shape,// const size_t *kernel_shape,
+        object $pads,       // const size_t *pads,
+        object $strides,    // const size_t *strides,
+        object $dilations,  // const size_t *dilations,
+        int $num_kernels,   // const size_t num_kernels,
+        int $groups,        // const size_t groups,
+        int $batch_count,   // const size_t batch_count,
+        object $im_buffer,  // const cl_mem im_buffer,
+        int $im_offset,     // const size_t im_offset,
+        object $result_buffer,// const cl_mem result_buffer,
+        int $result_offset, // const size_t result_offset,
+        object $kernel_buffer,// cl_mem kernel_buffer,
+        int $kernel_offset, // const size_t kernel_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDconvgemmGroupedBackwardFilter(
+            $kernel_mode,// const CLBlastKernelMode kernel_mode,
+            $rank,      // const size_t rank,
+            $channels,  // const size_t channels,
+            $input_shape,// const size_t *input_shape,
+            $kernel_shape,// const size_t *kernel_shape,
+            $pads,      // const size_t *pads,
+            $strides,   // const size_t *strides,
+            $dilations, // const size_t *dilations,
+            $num_kernels,// const size_t num_kernels,
+            $groups,    // const size_t groups,
+            $batch_count,// const size_t batch_count,
+            $im_buffer, // const cl_mem im_buffer,
+            $im_offset, // const size_t im_offset,
+            $result_buffer,// const cl_mem result_buffer,
+            $result_offset,// const size_t result_offset,
+            $kernel_buffer,// cl_mem kernel_buffer,
+            $kernel_offset,// const size_t kernel_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSpool2d(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pool_h,        // const size_t pool_h,
+        int $pool_w,        // const size_t pool_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $indices_buffer,// cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSpool2d(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pool_h,    // const size_t pool_h,
+            $pool_w,    // const size_t pool_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $indices_buffer,// cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDpool2d(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pool_h,        // const size_t pool_h,
+        int $pool_w,        // const size_t pool_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $indices_buffer,// cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDpool2d(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pool_h,    // const size_t pool_h,
+            $pool_w,    // const size_t pool_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $indices_buffer,// cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSpool2dBackward(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pool_h,        // const size_t pool_h,
+        int $pool_w,        // const size_t pool_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $indices_buffer,// const cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSpool2dBackward(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pool_h,    // const size_t pool_h,
+            $pool_w,    // const size_t pool_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $indices_buffer,// const cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDpool2dBackward(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        int $pool_h,        // const size_t pool_h,
+        int $pool_w,        // const size_t pool_w,
+        int $pad_h,         // const size_t pad_h,
+        int $pad_w,         // const size_t pad_w,
+        int $stride_h,      // const size_t stride_h,
+        int $stride_w,      // const size_t stride_w,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $indices_buffer,// const cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDpool2dBackward(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $pool_h,    // const size_t pool_h,
+            $pool_w,    // const size_t pool_w,
+            $pad_h,     // const size_t pad_h,
+            $pad_w,     // const size_t pad_w,
+            $stride_h,  // const size_t stride_h,
+            $stride_w,  // const size_t stride_w,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $indices_buffer,// const cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSglobalPool2d(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $indices_buffer,// cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSglobalPool2d(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $indices_buffer,// cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDglobalPool2d(
+        int $mode,          // const int mode,
+        int $batch_count,   // const size_t batch_count,
+        int $channels,      // const size_t channels,
+        int $height,        // const size_t height,
+        int $width,         // const size_t width,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $indices_buffer,// cl_mem indices_buffer,
+        int $indices_offset,// const size_t indices_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDglobalPool2d(
+            $mode,      // const int mode,
+            $batch_count,// const size_t batch_count,
+            $channels,  // const size_t channels,
+            $height,    // const size_t height,
+            $width,     // const size_t width,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $indices_buffer,// cl_mem indices_buffer,
+            $indices_offset,// const size_t indices_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHbatchNorm(
+        int $training,      // const int training,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $epsilon,     // const float epsilon,
+        float $momentum,    // const float momentum,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $mean_buffer,// cl_mem mean_buffer,
+        int $mean_offset,   // const size_t mean_offset,
+        object $var_buffer, // cl_mem var_buffer,
+        int $var_offset,    // const size_t var_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHbatchNorm(
+            $training,  // const int training,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $epsilon,   // const float epsilon,
+            $momentum,  // const float momentum,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $mean_buffer,// cl_mem mean_buffer,
+            $mean_offset,// const size_t mean_offset,
+            $var_buffer,// cl_mem var_buffer,
+            $var_offset,// const size_t var_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSbatchNorm(
+        int $training,      // const int training,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $epsilon,     // const float epsilon,
+        float $momentum,    // const float momentum,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $mean_buffer,// cl_mem mean_buffer,
+        int $mean_offset,   // const size_t mean_offset,
+        object $var_buffer, // cl_mem var_buffer,
+        int $var_offset,    // const size_t var_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSbatchNorm(
+            $training,  // const int training,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $epsilon,   // const float epsilon,
+            $momentum,  // const float momentum,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $mean_buffer,// cl_mem mean_buffer,
+            $mean_offset,// const size_t mean_offset,
+            $var_buffer,// cl_mem var_buffer,
+            $var_offset,// const size_t var_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDbatchNorm(
+        int $training,      // const int training,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        float $epsilon,     // const double epsilon,
+        float $momentum,    // const double momentum,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $mean_buffer,// cl_mem mean_buffer,
+        int $mean_offset,   // const size_t mean_offset,
+        object $var_buffer, // cl_mem var_buffer,
+        int $var_offset,    // const size_t var_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDbatchNorm(
+            $training,  // const int training,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $epsilon,   // const double epsilon,
+            $momentum,  // const double momentum,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $mean_buffer,// cl_mem mean_buffer,
+            $mean_offset,// const size_t mean_offset,
+            $var_buffer,// cl_mem var_buffer,
+            $var_offset,// const size_t var_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHbatchNormBackward(
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHbatchNormBackward(
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSbatchNormBackward(
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSbatchNormBackward(
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDbatchNormBackward(
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        int $k,             // const size_t k,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDbatchNormBackward(
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $k,         // const size_t k,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHlayerNorm(
+        int $rms,           // const int rms,
+        int $save_stats,    // const int save_stats,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $epsilon,     // const float epsilon,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHlayerNorm(
+            $rms,       // const int rms,
+            $save_stats,// const int save_stats,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $epsilon,   // const float epsilon,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSlayerNorm(
+        int $rms,           // const int rms,
+        int $save_stats,    // const int save_stats,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $epsilon,     // const float epsilon,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSlayerNorm(
+            $rms,       // const int rms,
+            $save_stats,// const int save_stats,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $epsilon,   // const float epsilon,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDlayerNorm(
+        int $rms,           // const int rms,
+        int $save_stats,    // const int save_stats,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $epsilon,     // const double epsilon,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $beta_buffer,// const cl_mem beta_buffer,
+        int $beta_offset,   // const size_t beta_offset,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $saved_mean_buffer,// cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDlayerNorm(
+            $rms,       // const int rms,
+            $save_stats,// const int save_stats,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $epsilon,   // const double epsilon,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $beta_buffer,// const cl_mem beta_buffer,
+            $beta_offset,// const size_t beta_offset,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $saved_mean_buffer,// cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHlayerNormBackward(
+        int $rms,           // const int rms,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHlayerNormBackward(
+            $rms,       // const int rms,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSlayerNormBackward(
+        int $rms,           // const int rms,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSlayerNormBackward(
+            $rms,       // const int rms,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDlayerNormBackward(
+        int $rms,           // const int rms,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $gamma_buffer,// const cl_mem gamma_buffer,
+        int $gamma_offset,  // const size_t gamma_offset,
+        object $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+        int $saved_mean_offset,// const size_t saved_mean_offset,
+        object $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+        int $saved_invstd_offset,// const size_t saved_invstd_offset,
+        object $dy_buffer,  // const cl_mem dy_buffer,
+        int $dy_offset,     // const size_t dy_offset,
+        object $dx_buffer,  // cl_mem dx_buffer,
+        int $dx_offset,     // const size_t dx_offset,
+        object $dgamma_buffer,// cl_mem dgamma_buffer,
+        int $dgamma_offset, // const size_t dgamma_offset,
+        object $dbeta_buffer,// cl_mem dbeta_buffer,
+        int $dbeta_offset,  // const size_t dbeta_offset,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDlayerNormBackward(
+            $rms,       // const int rms,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $gamma_buffer,// const cl_mem gamma_buffer,
+            $gamma_offset,// const size_t gamma_offset,
+            $saved_mean_buffer,// const cl_mem saved_mean_buffer,
+            $saved_mean_offset,// const size_t saved_mean_offset,
+            $saved_invstd_buffer,// const cl_mem saved_invstd_buffer,
+            $saved_invstd_offset,// const size_t saved_invstd_offset,
+            $dy_buffer, // const cl_mem dy_buffer,
+            $dy_offset, // const size_t dy_offset,
+            $dx_buffer, // cl_mem dx_buffer,
+            $dx_offset, // const size_t dx_offset,
+            $dgamma_buffer,// cl_mem dgamma_buffer,
+            $dgamma_offset,// const size_t dgamma_offset,
+            $dbeta_buffer,// cl_mem dbeta_buffer,
+            $dbeta_offset,// const size_t dbeta_offset,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHattention(
+        int $causal,        // const int causal,
+        int $batch_count,   // const size_t batch_count,
+        int $heads,         // const size_t heads,
+        int $seq_q,         // const size_t seq_q,
+        int $seq_k,         // const size_t seq_k,
+        int $head_dim,      // const size_t head_dim,
+        int $value_dim,     // const size_t value_dim,
+        float $scale,       // const float scale,
+        object $q_buffer,   // const cl_mem q_buffer,
+        int $q_offset,      // const size_t q_offset,
+        int $q_ld,          // const size_t q_ld,
+        int $q_stride_batch,// const size_t q_stride_batch,
+        int $q_stride_head, // const size_t q_stride_head,
+        object $k_buffer,   // const cl_mem k_buffer,
+        int $k_offset,      // const size_t k_offset,
+        int $k_ld,          // const size_t k_ld,
+        int $k_stride_batch,// const size_t k_stride_batch,
+        int $k_stride_head, // const size_t k_stride_head,
+        object $v_buffer,   // const cl_mem v_buffer,
+        int $v_offset,      // const size_t v_offset,
+        int $v_ld,          // const size_t v_ld,
+        int $v_stride_batch,// const size_t v_stride_batch,
+        int $v_stride_head, // const size_t v_stride_head,
+        object $o_buffer,   // cl_mem o_buffer,
+        int $o_offset,      // const size_t o_offset,
+        int $o_ld,          // const size_t o_ld,
+        int $o_stride_batch,// const size_t o_stride_batch,
+        int $o_stride_head, // const size_t o_stride_head,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHattention(
+            $causal,    // const int causal,
+            $batch_count,// const size_t batch_count,
+            $heads,     // const size_t heads,
+            $seq_q,     // const size_t seq_q,
+            $seq_k,     // const size_t seq_k,
+            $head_dim,  // const size_t head_dim,
+            $value_dim, // const size_t value_dim,
+            $scale,     // const float scale,
+            $q_buffer,  // const cl_mem q_buffer,
+            $q_offset,  // const size_t q_offset,
+            $q_ld,      // const size_t q_ld,
+            $q_stride_batch,// const size_t q_stride_batch,
+            $q_stride_head,// const size_t q_stride_head,
+            $k_buffer,  // const cl_mem k_buffer,
+            $k_offset,  // const size_t k_offset,
+            $k_ld,      // const size_t k_ld,
+            $k_stride_batch,// const size_t k_stride_batch,
+            $k_stride_head,// const size_t k_stride_head,
+            $v_buffer,  // const cl_mem v_buffer,
+            $v_offset,  // const size_t v_offset,
+            $v_ld,      // const size_t v_ld,
+            $v_stride_batch,// const size_t v_stride_batch,
+            $v_stride_head,// const size_t v_stride_head,
+            $o_buffer,  // cl_mem o_buffer,
+            $o_offset,  // const size_t o_offset,
+            $o_ld,      // const size_t o_ld,
+            $o_stride_batch,// const size_t o_stride_batch,
+            $o_stride_head,// const size_t o_stride_head,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSattention(
+        int $causal,        // const int causal,
+        int $batch_count,   // const size_t batch_count,
+        int $heads,         // const size_t heads,
+        int $seq_q,         // const size_t seq_q,
+        int $seq_k,         // const size_t seq_k,
+        int $head_dim,      // const size_t head_dim,
+        int $value_dim,     // const size_t value_dim,
+        float $scale,       // const float scale,
+        object $q_buffer,   // const cl_mem q_buffer,
+        int $q_offset,      // const size_t q_offset,
+        int $q_ld,          // const size_t q_ld,
+        int $q_stride_batch,// const size_t q_stride_batch,
+        int $q_stride_head, // const size_t q_stride_head,
+        object $k_buffer,   // const cl_mem k_buffer,
+        int $k_offset,      // const size_t k_offset,
+        int $k_ld,          // const size_t k_ld,
+        int $k_stride_batch,// const size_t k_stride_batch,
+        int $k_stride_head, // const size_t k_stride_head,
+        object $v_buffer,   // const cl_mem v_buffer,
+        int $v_offset,      // const size_t v_offset,
+        int $v_ld,          // const size_t v_ld,
+        int $v_stride_batch,// const size_t v_stride_batch,
+        int $v_stride_head, // const size_t v_stride_head,
+        object $o_buffer,   // cl_mem o_buffer,
+        int $o_offset,      // const size_t o_offset,
+        int $o_ld,          // const size_t o_ld,
+        int $o_stride_batch,// const size_t o_stride_batch,
+        int $o_stride_head, // const size_t o_stride_head,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSattention(
+            $causal,    // const int causal,
+            $batch_count,// const size_t batch_count,
+            $heads,     // const size_t heads,
+            $seq_q,     // const size_t seq_q,
+            $seq_k,     // const size_t seq_k,
+            $head_dim,  // const size_t head_dim,
+            $value_dim, // const size_t value_dim,
+            $scale,     // const float scale,
+            $q_buffer,  // const cl_mem q_buffer,
+            $q_offset,  // const size_t q_offset,
+            $q_ld,      // const size_t q_ld,
+            $q_stride_batch,// const size_t q_stride_batch,
+            $q_stride_head,// const size_t q_stride_head,
+            $k_buffer,  // const cl_mem k_buffer,
+            $k_offset,  // const size_t k_offset,
+            $k_ld,      // const size_t k_ld,
+            $k_stride_batch,// const size_t k_stride_batch,
+            $k_stride_head,// const size_t k_stride_head,
+            $v_buffer,  // const cl_mem v_buffer,
+            $v_offset,  // const size_t v_offset,
+            $v_ld,      // const size_t v_ld,
+            $v_stride_batch,// const size_t v_stride_batch,
+            $v_stride_head,// const size_t v_stride_head,
+            $o_buffer,  // cl_mem o_buffer,
+            $o_offset,  // const size_t o_offset,
+            $o_ld,      // const size_t o_ld,
+            $o_stride_batch,// const size_t o_stride_batch,
+            $o_stride_head,// const size_t o_stride_head,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDattention(
+        int $causal,        // const int causal,
+        int $batch_count,   // const size_t batch_count,
+        int $heads,         // const size_t heads,
+        int $seq_q,         // const size_t seq_q,
+        int $seq_k,         // const size_t seq_k,
+        int $head_dim,      // const size_t head_dim,
+        int $value_dim,     // const size_t value_dim,
+        float $scale,       // const double scale,
+        object $q_buffer,   // const cl_mem q_buffer,
+        int $q_offset,      // const size_t q_offset,
+        int $q_ld,          // const size_t q_ld,
+        int $q_stride_batch,// const size_t q_stride_batch,
+        int $q_stride_head, // const size_t q_stride_head,
+        object $k_buffer,   // const cl_mem k_buffer,
+        int $k_offset,      // const size_t k_offset,
+        int $k_ld,          // const size_t k_ld,
+        int $k_stride_batch,// const size_t k_stride_batch,
+        int $k_stride_head, // const size_t k_stride_head,
+        object $v_buffer,   // const cl_mem v_buffer,
+        int $v_offset,      // const size_t v_offset,
+        int $v_ld,          // const size_t v_ld,
+        int $v_stride_batch,// const size_t v_stride_batch,
+        int $v_stride_head, // const size_t v_stride_head,
+        object $o_buffer,   // cl_mem o_buffer,
+        int $o_offset,      // const size_t o_offset,
+        int $o_ld,          // const size_t o_ld,
+        int $o_stride_batch,// const size_t o_stride_batch,
+        int $o_stride_head, // const size_t o_stride_head,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDattention(
+            $causal,    // const int causal,
+            $batch_count,// const size_t batch_count,
+            $heads,     // const size_t heads,
+            $seq_q,     // const size_t seq_q,
+            $seq_k,     // const size_t seq_k,
+            $head_dim,  // const size_t head_dim,
+            $value_dim, // const size_t value_dim,
+            $scale,     // const double scale,
+            $q_buffer,  // const cl_mem q_buffer,
+            $q_offset,  // const size_t q_offset,
+            $q_ld,      // const size_t q_ld,
+            $q_stride_batch,// const size_t q_stride_batch,
+            $q_stride_head,// const size_t q_stride_head,
+            $k_buffer,  // const cl_mem k_buffer,
+            $k_offset,  // const size_t k_offset,
+            $k_ld,      // const size_t k_ld,
+            $k_stride_batch,// const size_t k_stride_batch,
+            $k_stride_head,// const size_t k_stride_head,
+            $v_buffer,  // const cl_mem v_buffer,
+            $v_offset,  // const size_t v_offset,
+            $v_ld,      // const size_t v_ld,
+            $v_stride_batch,// const size_t v_stride_batch,
+            $v_stride_head,// const size_t v_stride_head,
+            $o_buffer,  // cl_mem o_buffer,
+            $o_offset,  // const size_t o_offset,
+            $o_ld,      // const size_t o_ld,
+            $o_stride_batch,// const size_t o_stride_batch,
+            $o_stride_head,// const size_t o_stride_head,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastHpermute(
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastHpermute(
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSpermute(
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSpermute(
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDpermute(
+        int $rank,          // const size_t rank,
+        object $shape,      // const size_t *shape,
+        object $x_buffer,   // const cl_mem x_buffer,
+        int $x_offset,      // const size_t x_offset,
+        object $x_strides,  // const cl_long *x_strides,
+        object $y_buffer,   // cl_mem y_buffer,
+        int $y_offset,      // const size_t y_offset,
+        object $y_strides,  // const cl_long *y_strides,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDpermute(
+            $rank,      // const size_t rank,
+            $shape,     // const size_t *shape,
+            $x_buffer,  // const cl_mem x_buffer,
+            $x_offset,  // const size_t x_offset,
+            $x_strides, // const cl_long *x_strides,
+            $y_buffer,  // cl_mem y_buffer,
+            $y_offset,  // const size_t y_offset,
+            $y_strides, // const cl_long *y_strides,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSomatcopyStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSomatcopyStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const float alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDomatcopyStridedBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // const cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        object $b_buffer,   // cl_mem b_buffer,
+        int $b_offset,      // const size_t b_offset,
+        int $b_ld,          // const size_t b_ld,
+        int $b_stride,      // const size_t b_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDomatcopyStridedBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alpha,     // const double alpha,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offset,  // const size_t b_offset,
+            $b_ld,      // const size_t b_ld,
+            $b_stride,  // const size_t b_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastSomatcopyBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $alphas,     // const float *alphas,
+        object $a_buffer,   // const cl_mem a_buffer,
+        object $a_offsets,  // const size_t *a_offsets,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // cl_mem b_buffer,
+        object $b_offsets,  // const size_t *b_offsets,
+        int $b_ld,          // const size_t b_ld,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastSomatcopyBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alphas,    // const float *alphas,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offsets, // const size_t *a_offsets,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offsets, // const size_t *b_offsets,
+            $b_ld,      // const size_t b_ld,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDomatcopyBatched(
+        int $layout,        // const CLBlastLayout layout,
+        int $a_transpose,   // const CLBlastTranspose a_transpose,
+        int $m,             // const size_t m,
+        int $n,             // const size_t n,
+        object $alphas,     // const double *alphas,
+        object $a_buffer,   // const cl_mem a_buffer,
+        object $a_offsets,  // const size_t *a_offsets,
+        int $a_ld,          // const size_t a_ld,
+        object $b_buffer,   // cl_mem b_buffer,
+        object $b_offsets,  // const size_t *b_offsets,
+        int $b_ld,          // const size_t b_ld,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDomatcopyBatched(
+            $layout,    // const CLBlastLayout layout,
+            $a_transpose,// const CLBlastTranspose a_transpose,
+            $m,         // const size_t m,
+            $n,         // const size_t n,
+            $alphas,    // const double *alphas,
+            $a_buffer,  // const cl_mem a_buffer,
+            $a_offsets, // const size_t *a_offsets,
+            $a_ld,      // const size_t a_ld,
+            $b_buffer,  // cl_mem b_buffer,
+            $b_offsets, // const size_t *b_offsets,
+            $b_ld,      // const size_t b_ld,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastStransposeInPlace(
+        int $n,             // const size_t n,
+        float $alpha,       // const float alpha,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastStransposeInPlace(
+            $n,         // const size_t n,
+            $alpha,     // const float alpha,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+
+    /**
+     * 
+     */
+    public function CLBlastDtransposeInPlace(
+        int $n,             // const size_t n,
+        float $alpha,       // const double alpha,
+        object $a_buffer,   // cl_mem a_buffer,
+        int $a_offset,      // const size_t a_offset,
+        int $a_ld,          // const size_t a_ld,
+        int $a_stride,      // const size_t a_stride,
+        int $batch_count,   // const size_t batch_count,
+        object $queue,      // cl_command_queue* queue,
+        ?object $event      // cl_event* event
+        ) : int             // CLBlastStatusCode 
+    {
+        return $this->ffi->RindowCLBlastDtransposeInPlace(
+            $n,         // const size_t n,
+            $alpha,     // const double alpha,
+            $a_buffer,  // cl_mem a_buffer,
+            $a_offset,  // const size_t a_offset,
+            $a_ld,      // const size_t a_ld,
+            $a_stride,  // const size_t a_stride,
+            $batch_count,// const size_t batch_count,
+            $queue,     // cl_command_queue* queue,
+            $event      // cl_event* event
+            );
+    }
+}
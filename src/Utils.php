@@ -3,6 +3,8 @@ namespace Rindow\CLBlast\FFI;
 
 use Interop\Polite\Math\Matrix\NDArray;
 use InvalidArgumentException;
+use LogicException;
+use Rindow\CLBlast\FFI\Platforms\LinuxPatch;
 
 class cl_float2_t {
     /** @var array<float> $s */
@@ -35,4 +37,126 @@ trait Utils
         }
         return $to;
     }
+
+    /**
+     * The routines with own kernels are in librindowclblast.
+     */
+    protected function platformLib(string $func) : LinuxPatch
+    {
+        if(!($this->alt instanceof LinuxPatch)) {
+            throw new LogicException("$func requires librindowclblast, which is available only on Linux.");
+        }
+        return $this->alt;
+    }
+
+    protected function hasPlatformLib() : bool
+    {
+        return $this->alt instanceof LinuxPatch;
+    }
+
+    protected function isComplex(int $dtype) : bool
+    {
+        return $dtype==NDArray::complex64||$dtype==NDArray::complex128;
+    }
+
+    /**
+     * Strides in elements of a C-contiguous array.
+     * @param array<int> $shape
+     * @return array<int>
+     */
+    protected function contiguousStrides(array $shape) : array
+    {
+        $strides = [];
+        $stride = 1;
+        for($d=count($shape)-1;$d>=0;$d--) {
+            $strides[$d] = $stride;
+            $stride *= $shape[$d];
+        }
+        ksort($strides);
+        return $strides;
+    }
+
+    /**
+     * Shape of two shapes broadcasted as NumPy does.
+     * @param array<int> $shapeA
+     * @param array<int> $shapeB
+     * @return array<int>
+     */
+    protected function broadcastShape(array $shapeA, array $shapeB) : array
+    {
+        $rank = max(count($shapeA),count($shapeB));
+        $shapeA = array_pad(array_values($shapeA),-$rank,1);
+        $shapeB = array_pad(array_values($shapeB),-$rank,1);
+        $shape = [];
+        for($d=0;$d<$rank;$d++) {
+            if($shapeA[$d]!=$shapeB[$d] && $shapeA[$d]!=1 && $shapeB[$d]!=1) {
+                throw new InvalidArgumentException('Unmatch shape to broadcast: ['.
+                    implode(',',$shapeA).'] and ['.implode(',',$shapeB).']');
+            }
+            $shape[$d] = ($shapeA[$d]==1) ? $shapeB[$d] : $shapeA[$d];
+        }
+        return $shape;
+    }
+
+    /**
+     * Strides of an operand over the broadcasted shape.
+     * Broadcasted dimensions have a stride of 0.
+     * @param array<int> $shape
+     * @param array<int> $operandShape
+     * @param array<int>|null $operandStrides  null for C-contiguous
+     * @return array<int>
+     */
+    protected function broadcastStrides(
+        array $shape, array $operandShape, ?array $operandStrides, string $name) : array
+    {
+        $operandShape = array_values($operandShape);
+        if($operandStrides===null) {
+            $operandStrides = $this->contiguousStrides($operandShape);
+        }
+        $operandStrides = array_values($operandStrides);
+        if(count($operandStrides)!=count($operandShape)) {
+            throw new InvalidArgumentException("Unmatch rank of shape and strides for $name");
+        }
+        $rank = count($shape);
+        $lead = $rank-count($operandShape);
+        if($lead<0) {
+            throw new InvalidArgumentException("$name has more dimensions than the result");
+        }
+        $strides = [];
+        for($d=0;$d<$rank;$d++) {
+            if($d<$lead || ($operandShape[$d-$lead]==1 && $shape[$d]!=1)) {
+                $strides[$d] = 0;
+                continue;
+            }
+            if($operandShape[$d-$lead]!=$shape[$d]) {
+                throw new InvalidArgumentException("Unmatch shape of $name to broadcast");
+            }
+            $strides[$d] = $operandStrides[$d-$lead];
+        }
+        return $strides;
+    }
+
+    /**
+     * @param array<int> $values
+     */
+    protected function sizeArray(array $values) : object
+    {
+        $array = $this->ffi->new('size_t['.max(1,count($values)).']');
+        foreach(array_values($values) as $i => $value) {
+            $array[$i] = $value;
+        }
+        return $array;
+    }
+
+    /**
+     * @param array<int> $values
+     */
+    protected function longArray(array $values) : object
+    {
+        $array = $this->ffi->new('cl_long['.max(1,count($values)).']');
+        foreach(array_values($values) as $i => $value) {
+            $array[$i] = $value;
+        }
+        return $array;
+    }
 }
\ No newline at end of file
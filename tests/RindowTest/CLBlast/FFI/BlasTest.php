@@ -268,6 +268,51 @@ class BlasTest extends TestCase
                 $queue,$events);
     }
 
+    public function testScalDeviceScalarNormal()
+    {
+        $blas = $this->getBlas();
+
+        // alpha is the result of dot on the device
+        $dtype = NDArray::float32;
+        $x = $this->array([1,2],dtype:$dtype);
+        $y = $this->array([1,1],dtype:$dtype);
+        $ret = $this->zeros([],dtype:$dtype);
+        [$N,$RR,$offR,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_dot($x,$y,output:$ret);
+        $blas->dot($N,$RR,$offR,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events);
+
+        $X = $this->array([1,2,3],dtype:$dtype);
+        [$N,$alpha,$XX,$offX,$incX,$queue,$events] =
+            $this->translate_scal(0,$X);
+        $blas->scalDeviceScalar($N,$RR,$offR,$XX,$offX,$incX,$queue,$events);
+        $events->wait();
+        $this->assertEquals([3,6,9],$X->toArray());
+
+        if($this->fp64()) {
+            // float64 with the scalar at an offset
+            $dtype = NDArray::float64;
+            $alpha = $this->array([0,0,2],dtype:$dtype);
+            $X = $this->array([1,2,3],dtype:$dtype);
+            [$N,$dummy,$XX,$offX,$incX,$queue,$events] =
+                $this->translate_scal(0,$X);
+            $blas->scalDeviceScalar($N,$alpha->buffer(),2,$XX,$offX,$incX,$queue,$events);
+            $events->wait();
+            $this->assertEquals([2,4,6],$X->toArray());
+        }
+    }
+
+    public function testScalDeviceScalarOutOfBuffer()
+    {
+        $blas = $this->getBlas();
+        $dtype = NDArray::float32;
+        $alpha = $this->array([2],dtype:$dtype);
+        $X = $this->array([1,2,3],dtype:$dtype);
+        [$N,$dummy,$XX,$offX,$incX,$queue,$events] =
+            $this->translate_scal(0,$X);
+        $this->expectException(RuntimeException::class);
+        $blas->scalDeviceScalar($N,$alpha->buffer(),1,$XX,$offX,$incX,$queue,$events);
+    }
+
     //
     //  axpy
     //
@@ -453,6 +498,62 @@ class BlasTest extends TestCase
                 $queue,$events);
     }
 
+    public function testAxpyDeviceScalarNormal()
+    {
+        $blas = $this->getBlas();
+
+        // float32
+        $dtype = NDArray::float32;
+        $alpha = $this->array([-2],dtype:$dtype);
+        $X = $this->array([1,2,3],dtype:$dtype);
+        $Y = $this->array([10,20,30],dtype:$dtype);
+        [$N,$dummy,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_axpy($X,$Y);
+        $blas->axpyDeviceScalar($N,$alpha->buffer(),0,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events);
+        $events->wait();
+        $this->assertEquals([8,16,24],$Y->toArray());
+
+        if($this->fp64()) {
+            // float64
+            $dtype = NDArray::float64;
+            $alpha = $this->array([2],dtype:$dtype);
+            $X = $this->array([1,2,3],dtype:$dtype);
+            $Y = $this->array([10,20,30],dtype:$dtype);
+            [$N,$dummy,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events] =
+                $this->translate_axpy($X,$Y);
+            $blas->axpyDeviceScalar($N,$alpha->buffer(),0,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events);
+            $events->wait();
+            $this->assertEquals([12,24,36],$Y->toArray());
+        }
+    }
+
+    public function testAxpyDeviceScalarZeroIncrement()
+    {
+        $blas = $this->getBlas();
+        $dtype = NDArray::float32;
+        $alpha = $this->array([2],dtype:$dtype);
+        $X = $this->array([1,2,3],dtype:$dtype);
+        $Y = $this->array([10,20,30],dtype:$dtype);
+        [$N,$dummy,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_axpy($X,$Y);
+        $this->expectException(InvalidArgumentException::class);
+        $this->expectExceptionMessage('incY must be greater than zero');
+        $blas->axpyDeviceScalar($N,$alpha->buffer(),0,$XX,$offX,$incX,$YY,$offY,0,$queue,$events);
+    }
+
+    public function testAxpyDeviceScalarOutOfBuffer()
+    {
+        $blas = $this->getBlas();
+        $dtype = NDArray::float32;
+        $alpha = $this->array([2],dtype:$dtype);
+        $X = $this->array([1,2,3],dtype:$dtype);
+        $Y = $this->array([10,20,30],dtype:$dtype);
+        [$N,$dummy,$XX,$offX,$incX,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_axpy($X,$Y);
+        $this->expectException(RuntimeException::class);
+        $blas->axpyDeviceScalar($N,$alpha->buffer(),0,$XX,$offX,$incX,$YY,$offY=1,$incY,$queue,$events);
+    }
+
     //
     //  dot
     //
@@ -2761,6 +2862,55 @@ class BlasTest extends TestCase
             $queue,$events);
     }
 
+    public function testGemvDeviceScalarNormal()
+    {
+        $blas = $this->getBlas();
+
+        // float32: scalars = [alpha, beta]
+        $dtype = NDArray::float32;
+        $scalars = $this->array([2,3],dtype:$dtype);
+        $A = $this->array([[1,2,3],[4,5,6]],dtype:$dtype);
+        $X = $this->array([100,10,1],dtype:$dtype);
+        $Y = $this->ones([2],dtype:$dtype);
+
+        [ $order,$trans,$m,$n,$alpha,$AA,$offA,$ldA,
+          $XX,$offX,$incX,$beta,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_gemv($A,$X,Y:$Y);
+
+        $blas->gemvDeviceScalar(
+            $order,$trans,
+            $m,$n,
+            $scalars->buffer(),0,
+            $AA,$offA,$ldA,
+            $XX,$offX,$incX,
+            $scalars->buffer(),1,
+            $YY,$offY,$incY,
+            $queue,$events,
+        );
+        $events->wait();
+        $this->assertEquals([249,915],$Y->toArray());
+
+        // float32 transpose
+        $Y = $this->ones([3],dtype:$dtype);
+        $X = $this->array([10,1],dtype:$dtype);
+        [ $order,$trans,$m,$n,$alpha,$AA,$offA,$ldA,
+          $XX,$offX,$incX,$beta,$YY,$offY,$incY,$queue,$events] =
+            $this->translate_gemv($A,$X,Y:$Y,trans:true);
+
+        $blas->gemvDeviceScalar(
+            $order,$trans,
+            $m,$n,
+            $scalars->buffer(),0,
+            $AA,$offA,$ldA,
+            $XX,$offX,$incX,
+            $scalars->buffer(),1,
+            $YY,$offY,$incY,
+            $queue,$events,
+        );
+        $events->wait();
+        $this->assertEquals([31,53,75],$Y->toArray());
+    }
+
     //
     //  gemm
     //
@@ -3369,6 +3519,402 @@ class BlasTest extends TestCase
         $this->assertTrue(true);
     }
 
+    public function testGemmDeviceScalarNormal()
+    {
+        $blas = $this->getBlas();
+
+        // float32: scalars = [alpha, beta]
+        $dtype = NDArray::float32;
+        $scalars = $this->array([2,0.5],dtype:$dtype);
+        $A = $this->array([[1,2,3],[4,5,6]],dtype:$dtype);
+        $B = $this->array([[1,0],[0,1],[1,1]],dtype:$dtype);
+        $C = $this->array([[2,4],[6,8]],dtype:$dtype);
+
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,C:$C);
+
+        $blas->gemmDeviceScalar(
+            $order,$transA,$transB,
+            $M,$N,$K,
+            $scalars->buffer(),0,
+            $AA,$offA,$lda,
+            $BB,$offB,$ldb,
+            $scalars->buffer(),1,
+            $CC,$offC,$ldc,
+            $queue,$events
+        );
+        $events->wait();
+        $this->assertEquals([[9,12],[23,26]],$C->toArray());
+
+        // k=0 gives C := beta*C
+        $events = $this->getOpenCL()->EventList();
+        $blas->gemmDeviceScalar(
+            $order,$transA,$transB,
+            $M,$N,0,
+            $scalars->buffer(),0,
+            $AA,$offA,$lda,
+            $BB,$offB,$ldb,
+            $scalars->buffer(),1,
+            $CC,$offC,$ldc,
+            $queue,$events
+        );
+        $events->wait();
+        $this->assertEquals([[4.5,6],[11.5,13]],$C->toArray());
+
+        if($this->fp64()) {
+            // float64 with transposed A
+            $dtype = NDArray::float64;
+            $scalars = $this->array([2,0.5],dtype:$dtype);
+            $A = $this->array([[1,4],[2,5],[3,6]],dtype:$dtype);
+            $B = $this->array([[1,0],[0,1],[1,1]],dtype:$dtype);
+            $C = $this->array([[2,4],[6,8]],dtype:$dtype);
+
+            [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+              $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+                $this->translate_gemm($A,$B,C:$C,transA:true);
+
+            $blas->gemmDeviceScalar(
+                $order,$transA,$transB,
+                $M,$N,$K,
+                $scalars->buffer(),0,
+                $AA,$offA,$lda,
+                $BB,$offB,$ldb,
+                $scalars->buffer(),1,
+                $CC,$offC,$ldc,
+                $queue,$events
+            );
+            $events->wait();
+            $this->assertEquals([[9,12],[23,26]],$C->toArray());
+        }
+    }
+
+    public function testGemmEpilogueNormal()
+    {
+        $blas = $this->getBlas();
+        $dtype = NDArray::float32;
+        // A*B = [[4,5],[10,11]]
+        $cases = [
+            [OpenBLAS::EPILOGUE_BIAS_ROW,[-5,1],OpenBLAS::ACTIVATION_RELU,[[0,0],[11,12]]],
+            [OpenBLAS::EPILOGUE_BIAS_COLUMN,[-4,-6],OpenBLAS::ACTIVATION_RELU,[[0,0],[6,5]]],
+            [OpenBLAS::EPILOGUE_BIAS_COLUMN,[-4,-6],OpenBLAS::ACTIVATION_GELU,[[0,-0.158655],[6.0,5.0]]],
+            [OpenBLAS::EPILOGUE_BIAS_NONE,null,OpenBLAS::ACTIVATION_NONE,[[4,5],[10,11]]],
+        ];
+        foreach($cases as [$biasMode,$biasValues,$activation,$trues]) {
+            $A = $this->array([[1,2,3],[4,5,6]],dtype:$dtype);
+            $B = $this->array([[1,0],[0,1],[1,1]],dtype:$dtype);
+            $C = $this->array([[0,0],[0,0]],dtype:$dtype);
+            $bias = ($biasValues===null) ? null : $this->array($biasValues,dtype:$dtype);
+
+            [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+              $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+                $this->translate_gemm($A,$B,C:$C);
+
+            $blas->gemmEpilogue(
+                $order,$transA,$transB,
+                $M,$N,$K,
+                $alpha,
+                $AA,$offA,$lda,
+                $BB,$offB,$ldb,
+                $beta,
+                $CC,$offC,$ldc,
+                $biasMode,
+                $bias?->buffer(),0,
+                $activation,
+                $queue,$events
+            );
+            $events->wait();
+            $results = $C->toArray();
+            for($i=0;$i<2;$i++) {
+                for($j=0;$j<2;$j++) {
+                    $this->assertEqualsWithDelta($trues[$i][$j],$results[$i][$j],1e-4);
+                }
+            }
+        }
+    }
+
+    public function testGemmEpilogueShortBias()
+    {
+        $blas = $this->getBlas();
+        $dtype = NDArray::float32;
+        $A = $this->array([[1,2,3],[4,5,6]],dtype:$dtype);
+        $B = $this->array([[1,0],[0,1],[1,1]],dtype:$dtype);
+        $C = $this->array([[7,7],[7,7]],dtype:$dtype);
+        // a row bias needs m=2 values
+        $bias = $this->array([1],dtype:$dtype);
+
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,C:$C);
+
+        $thrown = false;
+        try {
+            $blas->gemmEpilogue(
+                $order,$transA,$transB,
+                $M,$N,$K,
+                $alpha,
+                $AA,$offA,$lda,
+                $BB,$offB,$ldb,
+                $beta,
+                $CC,$offC,$ldc,
+                OpenBLAS::EPILOGUE_BIAS_ROW,
+                $bias->buffer(),0,
+                OpenBLAS::ACTIVATION_NONE,
+                $queue,$events
+            );
+        } catch(RuntimeException $e) {
+            $thrown = true;
+        }
+        $this->assertTrue($thrown);
+        // C is left as it was
+        $this->assertEquals([[7,7],[7,7]],$C->toArray());
+    }
+
+    public function testGemm3mNormal()
+    {
+        $blas = $this->getBlas();
+
+        // complex64 check imag has beta 1.0
+        $dtype = NDArray::complex64;
+        $A = $this->array([[C(1,i:1),C(2,i:1),C(3,i:1)],[C(4),C(5),C(6)],[C(7),C(8),C(9)]],dtype:$dtype);
+        $B = $this->array([[C(1,i:1),C(0,i:1),C(0,i:1)],[C(0),C(1),C(0)],[C(0),C(0),C(1)]],dtype:$dtype);
+        $alpha = null;
+        $beta  = C(1.0);
+        $C = $this->ones([3,3],dtype:$dtype);
+        $transA = false;
+        $transB = false;
+
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,alpha:$alpha,beta:$beta,C:$C,transA:$transA,transB:$transB);
+
+        $blas->gemm3m(
+            $order,$transA,$transB,
+            $M,$N,$K,
+            $alpha,
+            $AA,$offA,$lda,
+            $BB,$offB,$ldb,
+            $beta,
+            $CC,$offC,$ldc,
+            $queue,$events
+        );
+        $events->wait();
+
+        $this->assertEquals($this->toComplex([
+            [C(1,i:2),C(2,i:2),C(3,i:2)],
+            [C(5,i:4),C(6,i:4),C(7,i:4)],
+            [C(8,i:7),C(9,i:7),C(10,i:7)]
+        ]),$this->toComplex($C->toArray()));
+
+        // complex64 conjugate transpose with complex alpha
+        $dtype = NDArray::complex64;
+        $A = $this->array([[C(1,i:1),C(2)],[C(3),C(4,i:-1)]],dtype:$dtype);
+        $B = $this->array([[C(1),C(0)],[C(0),C(1)]],dtype:$dtype);
+        $alpha = C(0,i:1);
+        $beta  = C(0.0);
+        $C = $this->ones([2,2],dtype:$dtype);
+        $transA = true;
+        $transB = false;
+
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,alpha:$alpha,beta:$beta,C:$C,transA:$transA,transB:$transB);
+
+        $blas->gemm3m(
+            $order,$transA,$transB,
+            $M,$N,$K,
+            $alpha,
+            $AA,$offA,$lda,
+            $BB,$offB,$ldb,
+            $beta,
+            $CC,$offC,$ldc,
+            $queue,$events
+        );
+        $events->wait();
+
+        // i * [[1-i, 3],[2, 4+i]]
+        $this->assertEquals($this->toComplex([
+            [C(1,i:1),C(0,i:3)],
+            [C(0,i:2),C(-1,i:4)],
+        ]),$this->toComplex($C->toArray()));
+
+        // float32 is calculated by gemm
+        $dtype = NDArray::float32;
+        $A = $this->array([[1,2,3],[4,5,6],[7,8,9]],dtype:$dtype);
+        $B = $this->array([[1,0,0],[0,1,0],[0,0,1]],dtype:$dtype);
+        $C = $this->ones([3,3],dtype:$dtype);
+
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,C:$C);
+
+        $blas->gemm3m(
+            $order,$transA,$transB,
+            $M,$N,$K,
+            $alpha,
+            $AA,$offA,$lda,
+            $BB,$offB,$ldb,
+            $beta,
+            $CC,$offC,$ldc,
+            $queue,$events
+        );
+        $events->wait();
+
+        $this->assertEquals([
+            [1,2,3],
+            [4,5,6],
+            [7,8,9]
+        ],$C->toArray());
+
+        if($this->fp64()) {
+            // complex128 check imag has beta 1.0
+            $dtype = NDArray::complex128;
+            $A = $this->array([[C(1,i:1),C(2,i:1),C(3,i:1)],[C(4),C(5),C(6)],[C(7),C(8),C(9)]],dtype:$dtype);
+            $B = $this->array([[C(1,i:1),C(0,i:1),C(0,i:1)],[C(0),C(1),C(0)],[C(0),C(0),C(1)]],dtype:$dtype);
+            $alpha = null;
+            $beta  = C(1.0);
+            $C = $this->ones([3,3],dtype:$dtype);
+            $transA = false;
+            $transB = false;
+
+            [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+              $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+                $this->translate_gemm($A,$B,alpha:$alpha,beta:$beta,C:$C,transA:$transA,transB:$transB);
+
+            $blas->gemm3m(
+                $order,$transA,$transB,
+                $M,$N,$K,
+                $alpha,
+                $AA,$offA,$lda,
+                $BB,$offB,$ldb,
+                $beta,
+                $CC,$offC,$ldc,
+                $queue,$events
+            );
+            $events->wait();
+
+            $this->assertEquals($this->toComplex([
+                [C(1,i:2),C(2,i:2),C(3,i:2)],
+                [C(5,i:4),C(6,i:4),C(7,i:4)],
+                [C(8,i:7),C(9,i:7),C(10,i:7)]
+            ]),$this->toComplex($C->toArray()));
+        }
+    }
+
+    public function testGemm3mSpeed()
+    {
+        if($this->skipDisplayInfo) {
+            $this->markTestSkipped('Skip Display time to calculate.');
+            return;
+        }
+        $blas = $this->getBlas();
+        $n = 1024;
+        $dtype = NDArray::complex64;
+        $A = $this->ones([$n,$n],dtype:$dtype);
+        $B = $this->ones([$n,$n],dtype:$dtype);
+        $C = $this->ones([$n,$n],dtype:$dtype);
+        [ $order,$transA,$transB,$M,$N,$K,$alpha,$AA,$offA,$lda,
+          $BB,$offB,$ldb,$beta,$CC,$offC,$ldc,$queue,$events] =
+            $this->translate_gemm($A,$B,C:$C);
+
+        foreach(['gemm','gemm3m'] as $func) {
+            // preloading
+            $blas->$func(
+                $order,$transA,$transB,$M,$N,$K,
+                $alpha,$AA,$offA,$lda,$BB,$offB,$ldb,$beta,$CC,$offC,$ldc,
+                $queue);
+            $queue->finish();
+            $start = microtime(true);
+            for($i=0;$i<5;$i++) {
+                $blas->$func(
+                    $order,$transA,$transB,$M,$N,$K,
+                    $alpha,$AA,$offA,$lda,$BB,$offB,$ldb,$beta,$CC,$offC,$ldc,
+                    $queue);
+            }
+            $queue->finish();
+            $end = microtime(true);
+            echo "\n";
+            echo "==$func==\n";
+            echo "total time=".($end-$start)."\n";
+        }
+        $this->assertTrue(true);
+    }
+
+    public function testGemmStrassenFullRange()
+    {
+        // odd sizes are peeled off at the first level
+        $m = 515;
+        $n = 258;
+        $k = 261;
+        [
+            $queue,$blas,$events,$bufferA,$bufferB,$bufferC,
+            $hostBufferA,$hostBufferB,$hostBufferC,$testTruesR,$alpha,$beta,
+        ] = $this->getGemmTestEnv($m,$n,$k);
+        $blas->gemmStrassen(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+            $alpha,
+            $bufferA,$offsetA=0,$ldA=$k,
+            $bufferB,$offsetB=0,$ldA=$n,
+            $beta,
+            $bufferC,$offsetC=0,$ldC=$n,
+            $depth=2,
+            $queue,$events);
+        $events->wait();
+        $bufferC->read($queue,$hostBufferC);
+        $equals = true;
+        for($i=0;$i<$m*$n;$i++) {
+            if(abs($hostBufferC[$i]-$testTruesR[$i])>1e-3*abs($testTruesR[$i])+1e-4) {
+                $equals = false;
+                break;
+            }
+        }
+        $this->assertTrue($equals);
+    }
+
+    public function testGemmStrassenSpeed()
+    {
+        if($this->skipDisplayInfo) {
+            $this->markTestSkipped('Skip Display time to calculate.');
+            return;
+        }
+        $m = 4096;
+        $n = 4096;
+        $k = 4096;
+        [
+            $queue,$blas,$events,$bufferA,$bufferB,$bufferC,
+            $hostBufferA,$hostBufferB,$hostBufferC,$testTruesR,$alpha,$beta,
+        ] = $this->getGemmTestEnv($m,$n,$k);
+
+        foreach([0,1,2,3] as $depth) {
+            // preloading
+            $blas->gemmStrassen(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+                $alpha,
+                $bufferA,$offsetA=0,$ldA=$k,
+                $bufferB,$offsetB=0,$ldA=$n,
+                $beta,
+                $bufferC,$offsetC=0,$ldC=$n,
+                $depth,
+                $queue);
+            $queue->finish();
+            $start = microtime(true);
+            for($i=0;$i<3;$i++) {
+                $blas->gemmStrassen(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+                    $alpha,
+                    $bufferA,$offsetA=0,$ldA=$k,
+                    $bufferB,$offsetB=0,$ldA=$n,
+                    $beta,
+                    $bufferC,$offsetC=0,$ldC=$n,
+                    $depth,
+                    $queue);
+            }
+            $queue->finish();
+            $end = microtime(true);
+            echo "\n";
+            echo "==depth=$depth==\n";
+            echo "total time=".($end-$start)."\n";
+        }
+        $this->assertTrue(true);
+    }
+
     //
     //  symm
     //
@@ -1025,6 +1025,150 @@ class MathTest extends TestCase
         $this->assertTrue($equals);
     }
 
+    public function testIm2colCol2imBatchedAsymmetric()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch=2; $channels=2; $height=5; $width=6;
+        $kernel_h=2; $kernel_w=3;
+        // [pad_h,pad_w,stride_h,stride_w,dilation_h,dilation_w]
+        // the second differs only in the dilation
+        $params = [
+            [0,1,1,2,2,1],
+            [1,1,1,1,2,1],
+        ];
+        foreach($params as [$pad_h,$pad_w,$stride_h,$stride_w,$dilation_h,$dilation_w]) {
+            $out_h = intdiv($height+2*$pad_h-($dilation_h*($kernel_h-1)+1),$stride_h)+1;
+            $out_w = intdiv($width+2*$pad_w-($dilation_w*($kernel_w-1)+1),$stride_w)+1;
+            $imSize = $channels*$height*$width;
+            $colSize = $channels*$kernel_h*$kernel_w*$out_h*$out_w;
+            $hostIm = $this->newHostBuffer($batch*$imSize,$dtype);
+            for($i=0;$i<count($hostIm);$i++) {
+                $hostIm[$i] = $i+1;
+            }
+            foreach([Math::CROSS_CORRELATION,Math::CONVOLUTION] as $kernel_mode) {
+                // the position of each column in the image, or -1 for the padding
+                $index = [];
+                for($b=0;$b<$batch;$b++) {
+                    for($c=0;$c<$channels;$c++) {
+                        for($kh=0;$kh<$kernel_h;$kh++) {
+                            for($kw=0;$kw<$kernel_w;$kw++) {
+                                $k = ($kernel_mode==Math::CONVOLUTION) ?
+                                    $kernel_h*$kernel_w-1-($kh*$kernel_w+$kw) : $kh*$kernel_w+$kw;
+                                for($oh=0;$oh<$out_h;$oh++) {
+                                    for($ow=0;$ow<$out_w;$ow++) {
+                                        $y = $oh*$stride_h-$pad_h+$kh*$dilation_h;
+                                        $x = $ow*$stride_w-$pad_w+$kw*$dilation_w;
+                                        $col = $b*$colSize+(($c*$kernel_h*$kernel_w+$k)*$out_h+$oh)*$out_w+$ow;
+                                        $index[$col] = ($y>=0 && $y<$height && $x>=0 && $x<$width) ?
+                                            $b*$imSize+($c*$height+$y)*$width+$x : -1;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                $imBuffer = $ocl->Buffer($context,$batch*$imSize*4,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostIm);
+                $colBuffer = $ocl->Buffer($context,$batch*$colSize*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->im2colBatched($kernel_mode,$batch,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $imBuffer,0,
+                    $colBuffer,0,
+                    $queue,$events
+                );
+                $events->wait();
+                $hostCol = $this->newHostBuffer($batch*$colSize,$dtype);
+                $colBuffer->read($queue,$hostCol);
+                for($i=0;$i<$batch*$colSize;$i++) {
+                    $true = ($index[$i]<0) ? 0 : $hostIm[$index[$i]];
+                    $this->assertEquals($true,$hostCol[$i]);
+                }
+
+                // the single image api routes to the same kernel
+                $colBuffer1 = $ocl->Buffer($context,$colSize*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->im2col($kernel_mode,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $imBuffer,$imSize,
+                    $colBuffer1,0,
+                    $queue,$events
+                );
+                $events->wait();
+                $hostCol1 = $this->newHostBuffer($colSize,$dtype);
+                $colBuffer1->read($queue,$hostCol1);
+                for($i=0;$i<$colSize;$i++) {
+                    $this->assertEquals($hostCol[$colSize+$i],$hostCol1[$i]);
+                }
+
+                // col2im adds the columns back to the image
+                $hostOut = $this->newHostBuffer($batch*$imSize,$dtype);
+                $trues = [];
+                for($i=0;$i<$batch*$imSize;$i++) {
+                    $hostOut[$i] = 1000;
+                    $trues[$i] = 1000;
+                }
+                for($i=0;$i<$batch*$colSize;$i++) {
+                    if($index[$i]>=0) {
+                        $trues[$index[$i]] += $hostCol[$i];
+                    }
+                }
+                $outBuffer = $ocl->Buffer($context,$batch*$imSize*4,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostOut);
+                $events = $ocl->EventList();
+                $math->col2imBatched($kernel_mode,$batch,
+                    $channels,$height,$width,
+                    $kernel_h,$kernel_w,
+                    $pad_h,$pad_w,
+                    $stride_h,$stride_w,
+                    $dilation_h,$dilation_w,
+                    $colBuffer,0,
+                    $outBuffer,0,
+                    $queue,$events
+                );
+                $events->wait();
+                $outBuffer->read($queue,$hostOut);
+                for($i=0;$i<$batch*$imSize;$i++) {
+                    $this->assertEquals($trues[$i],$hostOut[$i]);
+                }
+            }
+        }
+
+        // the columns past the end of the buffer
+        $imBuffer = $ocl->Buffer($context,$imSize*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostIm);
+        $colBuffer = $ocl->Buffer($context,$colSize*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostCol1);
+        $thrown = false;
+        try {
+            $math->im2colBatched(Math::CROSS_CORRELATION,2,
+                $channels,$height,$width,
+                $kernel_h,$kernel_w,
+                $pad_h,$pad_w,
+                $stride_h,$stride_w,
+                $dilation_h,$dilation_w,
+                $imBuffer,0,
+                $colBuffer,0,
+                $queue
+            );
+        } catch(RuntimeException $e) {
+            $thrown = true;
+        }
+        $this->assertTrue($thrown);
+    }
+
     //
     //  convgemm
     //
@@ -1187,6 +1331,465 @@ class MathTest extends TestCase
         $this->assertTrue($equals);
     }
 
+    public function testconvgemmBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $kernel_mode = Math::CONVOLUTION;
+        $channels = 3; $height = 6; $width = 5;
+        $kernel_h = 3; $kernel_w = 3;
+        $pad_h = 1; $pad_w = 1;
+        $stride_h = 2; $stride_w = 1;
+        $dilation_h = 1; $dilation_w = 1;
+        $num_kernels = 4; $batch_count = 2;
+        $out_h = intdiv($height+2*$pad_h-$kernel_h,$stride_h)+1;
+        $out_w = intdiv($width+2*$pad_w-$kernel_w,$stride_w)+1;
+        $sizeX = $batch_count*$channels*$height*$width;
+        $sizeW = $num_kernels*$channels*$kernel_h*$kernel_w;
+        $sizeY = $batch_count*$num_kernels*$out_h*$out_w;
+        $hostX = $this->newHostBuffer($sizeX,$dtype);
+        $hostW = $this->newHostBuffer($sizeW,$dtype);
+        $hostDY = $this->newHostBuffer($sizeY,$dtype);
+        for($i=0;$i<$sizeX;$i++) { $hostX[$i] = ($i*7)%5-2; }
+        for($i=0;$i<$sizeW;$i++) { $hostW[$i] = ($i*3)%4-1; }
+        for($i=0;$i<$sizeY;$i++) { $hostDY[$i] = ($i*5)%3-1; }
+        $bufX = $ocl->Buffer($context,$sizeX*4,OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufW = $ocl->Buffer($context,$sizeW*4,OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+        $bufDY = $ocl->Buffer($context,$sizeY*4,OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostDY);
+        $bufY = $ocl->Buffer($context,$sizeY*4,OpenCL::CL_MEM_READ_WRITE);
+        $bufDX = $ocl->Buffer($context,$sizeX*4,OpenCL::CL_MEM_READ_WRITE);
+        $bufDW = $ocl->Buffer($context,$sizeW*4,OpenCL::CL_MEM_READ_WRITE);
+        $args = [$kernel_mode,$channels,$height,$width,$kernel_h,$kernel_w,
+            $pad_h,$pad_w,$stride_h,$stride_w,$dilation_h,$dilation_w,
+            $num_kernels,$batch_count];
+        $events = $ocl->EventList();
+        $math->convgemm(...[...$args,$bufX,0,$bufW,0,$bufY,0,$queue,$events]);
+        $math->convgemmBackwardData(...[...$args,$bufDY,0,$bufW,0,$bufDX,0,$queue,$events]);
+        $math->convgemmBackwardFilter(...[...$args,$bufX,0,$bufDY,0,$bufDW,0,$queue,$events]);
+        $events->wait();
+        $hostY = $this->newHostBuffer($sizeY,$dtype);
+        $hostDX = $this->newHostBuffer($sizeX,$dtype);
+        $hostDW = $this->newHostBuffer($sizeW,$dtype);
+        $bufY->read($queue,$hostY);
+        $bufDX->read($queue,$hostDX);
+        $bufDW->read($queue,$hostDW);
+        // the backward passes are the adjoints of the forward convolution
+        // <conv(X,W),DY> = <X,dX> = <W,dW>
+        $forward = 0;
+        for($i=0;$i<$sizeY;$i++) { $forward += $hostY[$i]*$hostDY[$i]; }
+        $data = 0;
+        for($i=0;$i<$sizeX;$i++) { $data += $hostX[$i]*$hostDX[$i]; }
+        $filter = 0;
+        for($i=0;$i<$sizeW;$i++) { $filter += $hostW[$i]*$hostDW[$i]; }
+        $this->assertNotEquals(0,$forward);
+        $this->assertEquals($forward,$data);
+        $this->assertEquals($forward,$filter);
+    }
+
+    public function testConvgemmAsymmetric()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $channels = 2; $height = 6; $width = 9;
+        $num_kernels = 3; $batch_count = 2;
+        $cases = [
+            // kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w
+            [1,7,0,3,1,2],
+            [3,1,1,0,2,1],
+        ];
+        $hostX = $this->newHostBuffer($batch_count*$channels*$height*$width,$dtype);
+        for($i=0;$i<count($hostX);$i++) { $hostX[$i] = ($i*7)%5-2; }
+        $bufX = $ocl->Buffer($context,count($hostX)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        foreach($cases as [$kernel_h,$kernel_w,$pad_h,$pad_w,$stride_h,$stride_w]) {
+            $out_h = intdiv($height+2*$pad_h-$kernel_h,$stride_h)+1;
+            $out_w = intdiv($width+2*$pad_w-$kernel_w,$stride_w)+1;
+            $hostW = $this->newHostBuffer($num_kernels*$channels*$kernel_h*$kernel_w,$dtype);
+            for($i=0;$i<count($hostW);$i++) { $hostW[$i] = ($i*3)%4-1; }
+            $bufW = $ocl->Buffer($context,count($hostW)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+            $size = $batch_count*$num_kernels*$out_h*$out_w;
+            $bufY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->convgemm(Math::CROSS_CORRELATION,
+                $channels,$height,$width,
+                $kernel_h,$kernel_w,
+                $pad_h,$pad_w,
+                $stride_h,$stride_w,
+                $dilation_h=1,$dilation_w=1,
+                $num_kernels,$batch_count,
+                $bufX,0,
+                $bufW,0,
+                $bufY,0,
+                $queue,$events);
+            $events->wait();
+            $hostY = $this->newHostBuffer($size,$dtype);
+            $bufY->read($queue,$hostY);
+            for($b=0;$b<$batch_count;$b++) {
+                for($k=0;$k<$num_kernels;$k++) {
+                    for($oh=0;$oh<$out_h;$oh++) {
+                        for($ow=0;$ow<$out_w;$ow++) {
+                            $true = 0;
+                            for($c=0;$c<$channels;$c++) {
+                                for($kh=0;$kh<$kernel_h;$kh++) {
+                                    for($kw=0;$kw<$kernel_w;$kw++) {
+                                        $y = $oh*$stride_h-$pad_h+$kh;
+                                        $x = $ow*$stride_w-$pad_w+$kw;
+                                        if($y<0 || $y>=$height || $x<0 || $x>=$width) {
+                                            continue;
+                                        }
+                                        $true += $hostW[(($k*$channels+$c)*$kernel_h+$kh)*$kernel_w+$kw]*
+                                            $hostX[(($b*$channels+$c)*$height+$y)*$width+$x];
+                                    }
+                                }
+                            }
+                            $this->assertEquals($true,
+                                $hostY[(($b*$num_kernels+$k)*$out_h+$oh)*$out_w+$ow]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    public function testConvgemmWinograd()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $channels = Math::WINOGRAD_MIN_CHANNELS;
+        $num_kernels = Math::WINOGRAD_MIN_CHANNELS;
+        $batch_count = 2;
+        $height = 6; $width = 9;
+        $pad_h = 1; $pad_w = 0;
+        $out_h = $height+2*$pad_h-2;
+        $out_w = $width+2*$pad_w-2;
+        $hostX = $this->newHostBuffer($batch_count*$channels*$height*$width,$dtype);
+        $hostW = $this->newHostBuffer($num_kernels*$channels*9,$dtype);
+        for($i=0;$i<count($hostX);$i++) { $hostX[$i] = (($i*7)%11)/4-1; }
+        for($i=0;$i<count($hostW);$i++) { $hostW[$i] = (($i*5)%9)/8-0.5; }
+        $bufX = $ocl->Buffer($context,count($hostX)*4,
+            OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufW = $ocl->Buffer($context,count($hostW)*4,
+            OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+        $size = $batch_count*$num_kernels*$out_h*$out_w;
+        foreach([Math::CROSS_CORRELATION,Math::CONVOLUTION] as $kernel_mode) {
+            $trues = array_fill(0,$size,0);
+            for($b=0;$b<$batch_count;$b++) {
+                for($k=0;$k<$num_kernels;$k++) {
+                    for($c=0;$c<$channels;$c++) {
+                        for($i=0;$i<3;$i++) {
+                            for($j=0;$j<3;$j++) {
+                                $kp = ($kernel_mode==Math::CONVOLUTION) ? 8-($i*3+$j) : $i*3+$j;
+                                $w = $hostW[($k*$channels+$c)*9+$kp];
+                                for($oh=0;$oh<$out_h;$oh++) {
+                                    $y = $oh-$pad_h+$i;
+                                    if($y<0 || $y>=$height) { continue; }
+                                    for($ow=0;$ow<$out_w;$ow++) {
+                                        $x = $ow-$pad_w+$j;
+                                        if($x<0 || $x>=$width) { continue; }
+                                        $trues[(($b*$num_kernels+$k)*$out_h+$oh)*$out_w+$ow] +=
+                                            $w*$hostX[(($b*$channels+$c)*$height+$y)*$width+$x];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            foreach([Math::WINOGRAD_F2X2,Math::WINOGRAD_F4X4] as $tile) {
+                // with the kernels as they are and transformed in advance
+                $bufU = $ocl->Buffer($context,($tile+2)*($tile+2)*$num_kernels*$channels*4,
+                    OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->winogradFilter($kernel_mode,$tile,$channels,$num_kernels,
+                    $bufW,0,$bufU,0,$queue,$events);
+                $events->wait();
+                foreach([[$bufW,false],[$bufU,true]] as [$kernel,$transformed]) {
+                    $bufY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+                    $events = $ocl->EventList();
+                    $math->convgemmWinograd($kernel_mode,$tile,
+                        $channels,$height,$width,$pad_h,$pad_w,
+                        $num_kernels,$batch_count,
+                        $bufX,0,$kernel,0,$transformed,$bufY,0,
+                        $queue,$events);
+                    $events->wait();
+                    $hostY = $this->newHostBuffer($size,$dtype);
+                    $bufY->read($queue,$hostY);
+                    for($i=0;$i<$size;$i++) {
+                        $this->assertEqualsWithDelta($trues[$i],$hostY[$i],1e-3);
+                    }
+                }
+            }
+            // convgemm chooses Winograd for this shape
+            $bufY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->convgemm($kernel_mode,
+                $channels,$height,$width,
+                3,3,$pad_h,$pad_w,1,1,1,1,
+                $num_kernels,$batch_count,
+                $bufX,0,$bufW,0,$bufY,0,
+                $queue,$events);
+            $events->wait();
+            $hostY = $this->newHostBuffer($size,$dtype);
+            $bufY->read($queue,$hostY);
+            for($i=0;$i<$size;$i++) {
+                $this->assertEqualsWithDelta($trues[$i],$hostY[$i],1e-3);
+            }
+        }
+    }
+
+    public function testConvgemmNdForwardBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $channels = 2;
+        $num_kernels = 3;
+        $batch_count = 2;
+        $cases = [
+            // input_shape, kernel_shape, pads, strides, dilations
+            [[7],[3],[1],[2],[1]],
+            [[3,4,5],[2,2,3],[1,0,1],[1,2,1],[1,1,2]],
+        ];
+        foreach($cases as [$input_shape,$kernel_shape,$pads,$strides,$dilations]) {
+            $rank = count($input_shape);
+            $output_shape = [];
+            for($d=0;$d<$rank;$d++) {
+                $span = $dilations[$d]*($kernel_shape[$d]-1)+1;
+                $output_shape[] = intdiv($input_shape[$d]+2*$pads[$d]-$span,$strides[$d])+1;
+            }
+            $inSize = array_product($input_shape);
+            $kSize = array_product($kernel_shape);
+            $outSize = array_product($output_shape);
+            $hostX = $this->newHostBuffer($batch_count*$channels*$inSize,$dtype);
+            $hostW = $this->newHostBuffer($num_kernels*$channels*$kSize,$dtype);
+            $hostDY = $this->newHostBuffer($batch_count*$num_kernels*$outSize,$dtype);
+            for($i=0;$i<count($hostX);$i++) { $hostX[$i] = ($i*7)%5-2; }
+            for($i=0;$i<count($hostW);$i++) { $hostW[$i] = ($i*3)%4-1; }
+            for($i=0;$i<count($hostDY);$i++) { $hostDY[$i] = ($i*5)%3-1; }
+            $bufX = $ocl->Buffer($context,count($hostX)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $bufW = $ocl->Buffer($context,count($hostW)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+            $bufDY = $ocl->Buffer($context,count($hostDY)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostDY);
+            foreach([Math::CROSS_CORRELATION,Math::CONVOLUTION] as $kernel_mode) {
+                $trueY = array_fill(0,$batch_count*$num_kernels*$outSize,0);
+                $trueDX = array_fill(0,$batch_count*$channels*$inSize,0);
+                $trueDW = array_fill(0,$num_kernels*$channels*$kSize,0);
+                for($o=0;$o<$outSize;$o++) {
+                    for($kp=0;$kp<$kSize;$kp++) {
+                        // image position read by output o at kernel position kp
+                        $oo = $o; $kk = $kp; $p = 0; $step = 1; $inside = true;
+                        for($d=$rank-1;$d>=0;$d--) {
+                            $pos = ($oo%$output_shape[$d])*$strides[$d]-$pads[$d]+($kk%$kernel_shape[$d])*$dilations[$d];
+                            $oo = intdiv($oo,$output_shape[$d]);
+                            $kk = intdiv($kk,$kernel_shape[$d]);
+                            $inside = $inside && $pos>=0 && $pos<$input_shape[$d];
+                            $p += $pos*$step;
+                            $step *= $input_shape[$d];
+                        }
+                        if(!$inside) {
+                            continue;
+                        }
+                        $wp = ($kernel_mode==Math::CONVOLUTION) ? $kSize-1-$kp : $kp;
+                        for($b=0;$b<$batch_count;$b++) {
+                            for($k=0;$k<$num_kernels;$k++) {
+                                for($c=0;$c<$channels;$c++) {
+                                    $xi = ($b*$channels+$c)*$inSize+$p;
+                                    $wi = ($k*$channels+$c)*$kSize+$wp;
+                                    $yi = ($b*$num_kernels+$k)*$outSize+$o;
+                                    $trueY[$yi] += $hostW[$wi]*$hostX[$xi];
+                                    $trueDX[$xi] += $hostW[$wi]*$hostDY[$yi];
+                                    $trueDW[$wi] += $hostDY[$yi]*$hostX[$xi];
+                                }
+                            }
+                        }
+                    }
+                }
+                $args = [$kernel_mode,$channels,$input_shape,$kernel_shape,$pads,$strides,$dilations,
+                    $num_kernels,$batch_count];
+
+                $bufY = $ocl->Buffer($context,count($trueY)*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->convgemmNd(...[...$args,$bufX,0,$bufW,0,$bufY,0,$queue,$events]);
+                $events->wait();
+                $hostY = $this->newHostBuffer(count($trueY),$dtype);
+                $bufY->read($queue,$hostY);
+                for($i=0;$i<count($trueY);$i++) {
+                    $this->assertEquals($trueY[$i],$hostY[$i]);
+                }
+
+                $bufDX = $ocl->Buffer($context,count($trueDX)*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->convgemmNdBackwardData(...[...$args,$bufDY,0,$bufW,0,$bufDX,0,$queue,$events]);
+                $events->wait();
+                $hostDX = $this->newHostBuffer(count($trueDX),$dtype);
+                $bufDX->read($queue,$hostDX);
+                for($i=0;$i<count($trueDX);$i++) {
+                    $this->assertEquals($trueDX[$i],$hostDX[$i]);
+                }
+
+                $bufDW = $ocl->Buffer($context,count($trueDW)*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->convgemmNdBackwardFilter(...[...$args,$bufX,0,$bufDY,0,$bufDW,0,$queue,$events]);
+                $events->wait();
+                $hostDW = $this->newHostBuffer(count($trueDW),$dtype);
+                $bufDW->read($queue,$hostDW);
+                for($i=0;$i<count($trueDW);$i++) {
+                    $this->assertEquals($trueDW[$i],$hostDW[$i]);
+                }
+            }
+        }
+
+        // the 1D api is the same as convgemmNd of rank 1
+        $hostX = $this->newHostBuffer(1*1*5,$dtype);
+        for($i=0;$i<5;$i++) { $hostX[$i] = $i+1; }
+        $hostW = $this->newHostBuffer(1*1*2,$dtype);
+        $hostW[0] = 1; $hostW[1] = 10;
+        $bufX = $ocl->Buffer($context,5*4,OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufW = $ocl->Buffer($context,2*4,OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+        $bufY = $ocl->Buffer($context,2*4,OpenCL::CL_MEM_READ_WRITE);
+        $events = $ocl->EventList();
+        $math->convgemm1d(Math::CROSS_CORRELATION,
+            $channels=1,$width=5,$kernel_w=2,$pad_w=0,$stride_w=3,$dilation_w=1,
+            $num_kernels=1,$batch_count=1,
+            $bufX,0,$bufW,0,$bufY,0,$queue,$events);
+        $events->wait();
+        $hostY = $this->newHostBuffer(2,$dtype);
+        $bufY->read($queue,$hostY);
+        $this->assertEquals([21,54],[$hostY[0],$hostY[1]]);
+
+        // the image, the kernel or the result past the end of its buffer
+        $args = [Math::CROSS_CORRELATION,1,[5],[2],[0],[3],[1],1];
+        $calls = [
+            // two images in a buffer of one
+            fn() => $math->convgemmNd(...[...$args,2,$bufX,0,$bufW,0,$bufY,0,$queue]),
+            fn() => $math->convgemmNd(...[...$args,1,$bufX,0,$bufW,1,$bufY,0,$queue]),
+            fn() => $math->convgemmNdBackwardData(...[...$args,1,$bufY,1,$bufW,0,$bufX,0,$queue]),
+            fn() => $math->convgemmNdBackwardFilter(...[...$args,1,$bufX,1,$bufY,0,$bufW,0,$queue]),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testConvgemmGroupedForwardBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch_count = 2;
+        $height = 5; $width = 6;
+        $kernel_h = 3; $kernel_w = 2;
+        $pad_h = 1; $pad_w = 0;
+        $stride_h = 1; $stride_w = 2;
+        $dilation_h = 1; $dilation_w = 1;
+        $out_h = intdiv($height+2*$pad_h-$kernel_h,$stride_h)+1;
+        $out_w = intdiv($width+2*$pad_w-$kernel_w,$stride_w)+1;
+        $inSize = $height*$width;
+        $kSize = $kernel_h*$kernel_w;
+        $outSize = $out_h*$out_w;
+        // [channels, num_kernels, groups]: depthwise with a multiplier of 2, and groups by GEMM
+        foreach([[6,12,6],[10,4,2]] as [$channels,$num_kernels,$groups]) {
+            $cg = intdiv($channels,$groups);
+            $kg = intdiv($num_kernels,$groups);
+            $hostX = $this->newHostBuffer($batch_count*$channels*$inSize,$dtype);
+            $hostW = $this->newHostBuffer($num_kernels*$cg*$kSize,$dtype);
+            $hostDY = $this->newHostBuffer($batch_count*$num_kernels*$outSize,$dtype);
+            for($i=0;$i<count($hostX);$i++) { $hostX[$i] = ($i*7)%5-2; }
+            for($i=0;$i<count($hostW);$i++) { $hostW[$i] = ($i*3)%4-1; }
+            for($i=0;$i<count($hostDY);$i++) { $hostDY[$i] = ($i*5)%3-1; }
+            $bufX = $ocl->Buffer($context,count($hostX)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $bufW = $ocl->Buffer($context,count($hostW)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostW);
+            $bufDY = $ocl->Buffer($context,count($hostDY)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostDY);
+            $kernel_mode = Math::CONVOLUTION;
+            $trueY = array_fill(0,count($hostDY),0);
+            $trueDX = array_fill(0,count($hostX),0);
+            $trueDW = array_fill(0,count($hostW),0);
+            for($b=0;$b<$batch_count;$b++) {
+                for($k=0;$k<$num_kernels;$k++) {
+                    for($c=0;$c<$cg;$c++) {
+                        $ch = intdiv($k,$kg)*$cg+$c;
+                        for($kh=0;$kh<$kernel_h;$kh++) {
+                            for($kw=0;$kw<$kernel_w;$kw++) {
+                                $wi = ($k*$cg+$c)*$kSize+$kSize-1-($kh*$kernel_w+$kw);
+                                for($oh=0;$oh<$out_h;$oh++) {
+                                    $y = $oh*$stride_h-$pad_h+$kh*$dilation_h;
+                                    if($y<0 || $y>=$height) { continue; }
+                                    for($ow=0;$ow<$out_w;$ow++) {
+                                        $x = $ow*$stride_w-$pad_w+$kw*$dilation_w;
+                                        if($x<0 || $x>=$width) { continue; }
+                                        $xi = ($b*$channels+$ch)*$inSize+$y*$width+$x;
+                                        $yi = ($b*$num_kernels+$k)*$outSize+$oh*$out_w+$ow;
+                                        $trueY[$yi] += $hostW[$wi]*$hostX[$xi];
+                                        $trueDX[$xi] += $hostW[$wi]*$hostDY[$yi];
+                                        $trueDW[$wi] += $hostDY[$yi]*$hostX[$xi];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            $args = [$kernel_mode,$channels,$height,$width,$kernel_h,$kernel_w,
+                $pad_h,$pad_w,$stride_h,$stride_w,$dilation_h,$dilation_w,
+                $num_kernels,$groups,$batch_count];
+
+            $bufY = $ocl->Buffer($context,count($trueY)*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->convgemmGrouped(...[...$args,$bufX,0,$bufW,0,$bufY,0,$queue,$events]);
+            $events->wait();
+            $hostY = $this->newHostBuffer(count($trueY),$dtype);
+            $bufY->read($queue,$hostY);
+            for($i=0;$i<count($trueY);$i++) {
+                $this->assertEquals($trueY[$i],$hostY[$i]);
+            }
+
+            $bufDX = $ocl->Buffer($context,count($trueDX)*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->convgemmGroupedBackwardData(...[...$args,$bufDY,0,$bufW,0,$bufDX,0,$queue,$events]);
+            $events->wait();
+            $hostDX = $this->newHostBuffer(count($trueDX),$dtype);
+            $bufDX->read($queue,$hostDX);
+            for($i=0;$i<count($trueDX);$i++) {
+                $this->assertEquals($trueDX[$i],$hostDX[$i]);
+            }
+
+            $bufDW = $ocl->Buffer($context,count($trueDW)*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->convgemmGroupedBackwardFilter(...[...$args,$bufX,0,$bufDY,0,$bufDW,0,$queue,$events]);
+            $events->wait();
+            $hostDW = $this->newHostBuffer(count($trueDW),$dtype);
+            $bufDW->read($queue,$hostDW);
+            for($i=0;$i<count($trueDW);$i++) {
+                $this->assertEquals($trueDW[$i],$hostDW[$i]);
+            }
+        }
+    }
+
     //
     //  axpyBatched
     //
@@ -1402,6 +2005,84 @@ class MathTest extends TestCase
         $this->assertTrue($equals);
     }
 
+    //
+    //  gemmGrouped
+    //
+
+    public function testgemmGroupedNormal()
+    {
+        // [m,n,k] of each problem; the 1st and 3rd are bucketed together
+        // and the last with k=0 gives C := beta*C
+        $shapes = [[2,3,4],[1,2,3],[2,3,4],[3,1,2],[2,2,0]];
+        $group_count = count($shapes);
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $dtype = NDArray::float32;
+        $m = $this->newHostBuffer($group_count,NDArray::int64);
+        $n = $this->newHostBuffer($group_count,NDArray::int64);
+        $k = $this->newHostBuffer($group_count,NDArray::int64);
+        $ldA = $this->newHostBuffer($group_count,NDArray::int64);
+        $ldB = $this->newHostBuffer($group_count,NDArray::int64);
+        $ldC = $this->newHostBuffer($group_count,NDArray::int64);
+        $offsetsA = $this->newHostBuffer($group_count,NDArray::int64);
+        $offsetsB = $this->newHostBuffer($group_count,NDArray::int64);
+        $offsetsC = $this->newHostBuffer($group_count,NDArray::int64);
+        $alpha = $this->newHostBuffer($group_count,$dtype);
+        $beta = $this->newHostBuffer($group_count,$dtype);
+        $sizeA = $sizeB = $sizeC = 0;
+        foreach($shapes as $i => [$mm,$nn,$kk]) {
+            $m[$i] = $mm; $n[$i] = $nn; $k[$i] = $kk;
+            $ldA[$i] = $kk; $ldB[$i] = $nn; $ldC[$i] = $nn;
+            $offsetsA[$i] = $sizeA; $offsetsB[$i] = $sizeB; $offsetsC[$i] = $sizeC;
+            $sizeA += $mm*$kk; $sizeB += $kk*$nn; $sizeC += $mm*$nn;
+            $alpha[$i] = $i+1;
+            $beta[$i] = 0.5;
+        }
+        $hostA = $this->newHostBuffer($sizeA,$dtype);
+        $hostB = $this->newHostBuffer($sizeB,$dtype);
+        $hostC = $this->newHostBuffer($sizeC,$dtype);
+        for($i=0;$i<$sizeA;$i++) { $hostA[$i] = $i%7; }
+        for($i=0;$i<$sizeB;$i++) { $hostB[$i] = $i%5; }
+        for($i=0;$i<$sizeC;$i++) { $hostC[$i] = 2; }
+        $trues = [];
+        foreach($shapes as $g => [$mm,$nn,$kk]) {
+            for($i=0;$i<$mm;$i++) {
+                for($j=0;$j<$nn;$j++) {
+                    $sum = 0;
+                    for($l=0;$l<$kk;$l++) {
+                        $sum += $hostA[$offsetsA[$g]+$i*$kk+$l]*$hostB[$offsetsB[$g]+$l*$nn+$j];
+                    }
+                    $trues[] = $alpha[$g]*$sum + $beta[$g]*2;
+                }
+            }
+        }
+        $bufferA = $ocl->Buffer($context,$sizeA*4,
+            OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufferB = $ocl->Buffer($context,$sizeB*4,
+            OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+        $bufferC = $ocl->Buffer($context,$sizeC*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostC);
+        $math = $this->getMath();
+        $events = $ocl->EventList();
+
+        $math->gemmGrouped(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,
+            $m,$n,$k,
+            $alpha,$offsetAlpha=0,
+            $bufferA,$offsetsA,$offsetA=0,$ldA,
+            $bufferB,$offsetsB,$offsetB=0,$ldB,
+            $beta,$offsetBeta=0,
+            $bufferC,$offsetsC,$offsetC=0,$ldC,
+            $group_count,
+            $queue,$events
+        );
+        $events->wait();
+        $bufferC->read($queue,$hostC);
+        for($i=0;$i<$sizeC;$i++) {
+            $this->assertEquals($trues[$i],$hostC[$i]);
+        }
+    }
+
     //
     //  gemmStridedBatched
     //
@@ -1719,8 +2400,16 @@ class MathTest extends TestCase
         $m,
         $n,
         $k,
+        $order=BLAS::RowMajor,
+        $transA=BLAS::NoTrans,
+        $transB=BLAS::NoTrans,
     )
     {
+        $rowMajor = ($order==BLAS::RowMajor);
+        // leading dimensions of the stored A (m x k), B (k x n) and C (m x n)
+        $ldA = ($rowMajor xor $transA==BLAS::Trans) ? $k : $m;
+        $ldB = ($rowMajor xor $transB==BLAS::Trans) ? $n : $k;
+        $ldC = $rowMajor ? $n : $m;
         $strideA = $m*$k;
         $strideB = $k*$n;
         $strideC = $m*$n;
@@ -1751,12 +2440,12 @@ class MathTest extends TestCase
                 
         $openblas = $this->getOpenBLAS();
         for($ii=0;$ii<$batch_count;$ii++) {
-            $openblas->gemm(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+            $openblas->gemm($order,$transA,$transB,$m,$n,$k,
                 $alpha,
-                $hostBufferA, $strideA*$ii, $k,
-                $hostBufferB, $strideB*$ii, $n,
+                $hostBufferA, $strideA*$ii, $ldA,
+                $hostBufferB, $strideB*$ii, $ldB,
                 $beta,
-                $testTruesR,  $strideC*$ii, $n
+                $testTruesR,  $strideC*$ii, $ldC
             );
         }
         
@@ -1774,6 +2463,7 @@ class MathTest extends TestCase
         return [
             $queue,$math,$events,$bufferA,$bufferB,$bufferC,
             $hostBufferC,$alpha,$beta,$strideA,$strideB,$strideC,$testTruesR,
+            $ldA,$ldB,$ldC,
         ];
     }
 
@@ -1819,4 +2509,1897 @@ class MathTest extends TestCase
         }
         $this->assertTrue($equals);
     }
-}
\ No newline at end of file
+
+    public function testgemmStridedBatchedSmallShapes()
+    {
+        // the last one is larger than the specialized kernels
+        $shapes = [[4,4,4],[5,7,3],[16,16,16],[32,32,32],[8,33,4]];
+        $variants = [
+            [BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans],
+            [BLAS::RowMajor,BLAS::Trans,BLAS::NoTrans],
+            [BLAS::RowMajor,BLAS::NoTrans,BLAS::Trans],
+            [BLAS::ColMajor,BLAS::NoTrans,BLAS::NoTrans],
+            [BLAS::ColMajor,BLAS::Trans,BLAS::Trans],
+        ];
+        foreach($variants as [$order,$transA,$transB]) {
+            foreach($shapes as [$m,$n,$k]) {
+                $batch_count = 37;
+                [
+                    $queue,$math,$events,$bufferA,$bufferB,$bufferC,
+                    $hostBufferC,$alpha,$beta,$strideA,$strideB,$strideC,$testTruesR,
+                    $ldA,$ldB,$ldC,
+                ] = $this->getgemmStridedBatchedTestEnv(
+                    $batch_count,
+                    $m,
+                    $n,
+                    $k,
+                    $order,
+                    $transA,
+                    $transB,
+                );
+                $math->gemmStridedBatched($order,$transA,$transB,$m,$n,$k,
+                    $alpha,
+                    $bufferA,$offsetA=0,$ldA,$strideA,
+                    $bufferB,$offsetB=0,$ldB,$strideB,
+                    $beta,
+                    $bufferC,$offsetC=0,$ldC,$strideC,
+                    $batch_count,
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferC->read($queue,$hostBufferC);
+                for($i=0;$i<$batch_count*$m*$n;$i++) {
+                    $this->assertEqualsWithDelta($testTruesR[$i],$hostBufferC[$i],1e-4);
+                }
+            }
+        }
+
+        // the small kernels check the buffers as CLBlast does
+        [$m,$n,$k] = [4,4,4];
+        $batch_count = 3;
+        [
+            $queue,$math,$events,$bufferA,$bufferB,$bufferC,
+            $hostBufferC,$alpha,$beta,$strideA,$strideB,$strideC,$testTruesR,
+        ] = $this->getgemmStridedBatchedTestEnv($batch_count,$m,$n,$k);
+        $cases = [
+            // [batch_count, offsetA, ldA, expected status]
+            [$batch_count+1, 0, $k, -1011],   // CLBlastInsufficientMemoryA
+            [$batch_count, 1, $k, -1011],     // CLBlastInsufficientMemoryA
+            [$batch_count, 0, $k-1, -1016],   // CLBlastInvalidLeadDimA
+        ];
+        foreach($cases as [$count,$offsetA,$ldA,$expected]) {
+            $code = 0;
+            try {
+                $math->gemmStridedBatched(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+                    $alpha,
+                    $bufferA,$offsetA,$ldA,$strideA,
+                    $bufferB,0,$n,$strideB,
+                    $beta,
+                    $bufferC,0,$n,$strideC,
+                    $count,
+                    $queue
+                );
+            } catch(RuntimeException $e) {
+                $code = $e->getCode();
+            }
+            $this->assertEquals($expected,$code);
+        }
+    }
+
+    public function testgemmStridedBatchedSmallSpeed()
+    {
+        if($this->skipDisplayInfo) {
+            $this->markTestSkipped('Skip Display time to calculate.');
+            return;
+        }
+        // CLBlast's own batched kernel for comparison
+        new CLBlastFactory();
+        $prop = new \ReflectionProperty(CLBlastFactory::class,'ffi');
+        $prop->setAccessible(true);
+        $ffi = $prop->getValue();
+        $generic = new Math($ffi,$ffi);
+
+        $batch_count = 10000;
+        foreach([4,8,16,32] as $size) {
+            [$m,$n,$k] = [$size,$size,$size];
+            [
+                $queue,$math,$events,$bufferA,$bufferB,$bufferC,
+                $hostBufferC,$alpha,$beta,$strideA,$strideB,$strideC,$testTruesR,
+            ] = $this->getgemmStridedBatchedTestEnv(
+                $batch_count,
+                $m,
+                $n,
+                $k,
+            );
+            foreach(['specialized'=>$math,'generic'=>$generic] as $name => $target) {
+                // warm up the kernel cache
+                $target->gemmStridedBatched(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+                    $alpha,
+                    $bufferA,0,$k,$strideA,
+                    $bufferB,0,$n,$strideB,
+                    0.0,
+                    $bufferC,0,$n,$strideC,
+                    $batch_count,
+                    $queue
+                );
+                $queue->finish();
+                $start = hrtime(true);
+                for($i=0;$i<10;$i++) {
+                    $target->gemmStridedBatched(BLAS::RowMajor,BLAS::NoTrans,BLAS::NoTrans,$m,$n,$k,
+                        $alpha,
+                        $bufferA,0,$k,$strideA,
+                        $bufferB,0,$n,$strideB,
+                        0.0,
+                        $bufferC,0,$n,$strideC,
+                        $batch_count,
+                        $queue
+                    );
+                }
+                $queue->finish();
+                $time = (hrtime(true)-$start)/1e9/10;
+                echo sprintf("\n%dx%d batch=%d %s: %8.3f ms",$size,$size,$batch_count,$name,$time*1e3);
+            }
+        }
+        echo "\n";
+        $this->assertTrue(true);
+    }
+
+    //
+    //  solve
+    //
+
+    public function testSolveNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $n = 32;
+        foreach([Math::SOLVER_CG,Math::SOLVER_BICGSTAB] as $method) {
+            // CG: symmetric and diagonally dominant
+            // BiCGSTAB: nonsymmetric and diagonally dominant
+            $hostA = $this->newHostBuffer($n*$n,$dtype);
+            for($i=0;$i<$n;$i++) {
+                for($j=0;$j<$n;$j++) {
+                    if($i==$j) {
+                        $v = 2*$n;
+                    } elseif($method==Math::SOLVER_CG) {
+                        $v = (($i+$j)%5)*0.25;
+                    } else {
+                        $v = (($i*3+$j)%7)*0.25-0.5;
+                    }
+                    $hostA[$i*$n+$j] = $v;
+                }
+            }
+            $trues = [];
+            for($i=0;$i<$n;$i++) {
+                $trues[] = ($i%4)-1.5;
+            }
+            $hostB = $this->newHostBuffer($n,$dtype);
+            for($i=0;$i<$n;$i++) {
+                $sum = 0;
+                for($j=0;$j<$n;$j++) {
+                    $sum += $hostA[$i*$n+$j]*$trues[$j];
+                }
+                $hostB[$i] = $sum;
+            }
+            $hostX = $this->newHostBuffer($n,$dtype);
+            for($i=0;$i<$n;$i++) {
+                $hostX[$i] = 0;
+            }
+            $bufferA = $ocl->Buffer($context,$n*$n*4,
+                OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferB = $ocl->Buffer($context,$n*4,
+                OpenCL::CL_MEM_READ_ONLY|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+            $bufferX = $ocl->Buffer($context,$n*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $events = $ocl->EventList();
+
+            [$iterations,$residual] = $math->solve($method,BLAS::RowMajor,$n,
+                $bufferA,$offsetA=0,$ldA=$n,
+                $bufferB,$offsetB=0,
+                $bufferX,$offsetX=0,
+                $tol=1e-5,$maxIterations=100,$checkInterval=4,
+                $queue,$events
+            );
+            $events->wait();
+            $this->assertLessThanOrEqual($maxIterations,$iterations);
+            $this->assertEquals(0,$iterations%$checkInterval);
+            $this->assertLessThan($tol,$residual);
+            $bufferX->read($queue,$hostX);
+            for($i=0;$i<$n;$i++) {
+                $this->assertEqualsWithDelta($trues[$i],$hostX[$i],1e-3);
+            }
+        }
+    }
+
+    //
+    //  potrf - potrs
+    //
+
+    public function testPotrfPotrsNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // spans three diagonal blocks
+        $n = 70;
+        $nrhs = 2;
+        foreach([BLAS::Lower,BLAS::Upper] as $uplo) {
+            $hostA = $this->newHostBuffer($n*$n,$dtype);
+            for($i=0;$i<$n;$i++) {
+                for($j=0;$j<$n;$j++) {
+                    $hostA[$i*$n+$j] = ($i==$j) ? $n : (($i+$j)%5)*0.25;
+                }
+            }
+            $trues = [];
+            $hostB = $this->newHostBuffer($n*$nrhs,$dtype);
+            for($i=0;$i<$n;$i++) {
+                for($r=0;$r<$nrhs;$r++) {
+                    $trues[$i*$nrhs+$r] = (($i+$r)%4)-1.5;
+                }
+            }
+            for($i=0;$i<$n;$i++) {
+                for($r=0;$r<$nrhs;$r++) {
+                    $sum = 0;
+                    for($j=0;$j<$n;$j++) {
+                        $sum += $hostA[$i*$n+$j]*$trues[$j*$nrhs+$r];
+                    }
+                    $hostB[$i*$nrhs+$r] = $sum;
+                }
+            }
+            $hostInfo = $this->newHostBuffer(1,NDArray::int32);
+            $hostInfo[0] = -1;
+            $bufferA = $ocl->Buffer($context,$n*$n*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferB = $ocl->Buffer($context,$n*$nrhs*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+            $bufferInfo = $ocl->Buffer($context,4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostInfo);
+            $events = $ocl->EventList();
+
+            $math->potrf(BLAS::RowMajor,$uplo,$n,
+                $bufferA,$offsetA=0,$ldA=$n,
+                $bufferInfo,$offsetInfo=0,
+                $queue
+            );
+            $math->potrs(BLAS::RowMajor,$uplo,$n,$nrhs,
+                $bufferA,$offsetA=0,$ldA=$n,
+                $bufferB,$offsetB=0,$ldB=$nrhs,
+                $queue,$events
+            );
+            $events->wait();
+            $bufferInfo->read($queue,$hostInfo);
+            $this->assertEquals(0,$hostInfo[0]);
+            $bufferB->read($queue,$hostB);
+            for($i=0;$i<$n*$nrhs;$i++) {
+                $this->assertEqualsWithDelta($trues[$i],$hostB[$i],1e-4);
+            }
+        }
+    }
+
+    public function testPotrfNotPositiveDefinite()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $n = 40;
+        $hostA = $this->newHostBuffer($n*$n,$dtype);
+        for($i=0;$i<$n*$n;$i++) {
+            $hostA[$i] = 0;
+        }
+        for($i=0;$i<$n;$i++) {
+            $hostA[$i*$n+$i] = ($i==35) ? -1 : 1;
+        }
+        $hostInfo = $this->newHostBuffer(1,NDArray::int32);
+        $bufferA = $ocl->Buffer($context,$n*$n*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufferInfo = $ocl->Buffer($context,4,OpenCL::CL_MEM_READ_WRITE);
+        $events = $ocl->EventList();
+
+        $math->potrf(BLAS::RowMajor,BLAS::Lower,$n,
+            $bufferA,$offsetA=0,$ldA=$n,
+            $bufferInfo,$offsetInfo=0,
+            $queue,$events
+        );
+        $events->wait();
+        $bufferInfo->read($queue,$hostInfo);
+        $this->assertEquals(36,$hostInfo[0]);
+    }
+
+    //
+    //  getrf - getrs
+    //
+
+    /**
+     * Rows of a diagonally dominant matrix in a shuffled order,
+     * so that the factorization has to pivot.
+     */
+    protected function pivotingMatrix(int $n, int $offset=0) : array
+    {
+        $a = [];
+        for($i=0;$i<$n;$i++) {
+            $src = ($i*13+$offset)%$n;
+            for($j=0;$j<$n;$j++) {
+                $a[$i*$n+$j] = ($src==$j) ? $n : (($src*3+$j)%7)*0.25-0.75;
+            }
+        }
+        return $a;
+    }
+
+    public function testGetrfGetrsNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // spans three panels
+        $n = 70;
+        $nrhs = 2;
+        foreach([BLAS::NoTrans,BLAS::Trans] as $trans) {
+            $a = $this->pivotingMatrix($n);
+            $hostA = $this->newHostBuffer($n*$n,$dtype);
+            for($i=0;$i<$n*$n;$i++) {
+                $hostA[$i] = $a[$i];
+            }
+            $trues = [];
+            for($i=0;$i<$n*$nrhs;$i++) {
+                $trues[$i] = ($i%4)-1.5;
+            }
+            $hostB = $this->newHostBuffer($n*$nrhs,$dtype);
+            for($i=0;$i<$n;$i++) {
+                for($r=0;$r<$nrhs;$r++) {
+                    $sum = 0;
+                    for($j=0;$j<$n;$j++) {
+                        $aij = ($trans==BLAS::NoTrans) ? $a[$i*$n+$j] : $a[$j*$n+$i];
+                        $sum += $aij*$trues[$j*$nrhs+$r];
+                    }
+                    $hostB[$i*$nrhs+$r] = $sum;
+                }
+            }
+            $hostInfo = $this->newHostBuffer(1,NDArray::int32);
+            $bufferA = $ocl->Buffer($context,$n*$n*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferB = $ocl->Buffer($context,$n*$nrhs*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+            $bufferIpiv = $ocl->Buffer($context,$n*4,OpenCL::CL_MEM_READ_WRITE);
+            $bufferInfo = $ocl->Buffer($context,4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+
+            $math->getrf(BLAS::RowMajor,$n,$n,
+                $bufferA,$offsetA=0,$ldA=$n,
+                $bufferIpiv,$offsetIpiv=0,
+                $bufferInfo,$offsetInfo=0,
+                $queue
+            );
+            $math->getrs(BLAS::RowMajor,$trans,$n,$nrhs,
+                $bufferA,$offsetA=0,$ldA=$n,
+                $bufferIpiv,$offsetIpiv=0,
+                $bufferB,$offsetB=0,$ldB=$nrhs,
+                $queue,$events
+            );
+            $events->wait();
+            $bufferInfo->read($queue,$hostInfo);
+            $this->assertEquals(0,$hostInfo[0]);
+            $bufferB->read($queue,$hostB);
+            for($i=0;$i<$n*$nrhs;$i++) {
+                $this->assertEqualsWithDelta($trues[$i],$hostB[$i],1e-4);
+            }
+        }
+    }
+
+    public function testGetrfBatchedNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $n = 8;
+        $nrhs = 3;
+        $batch_count = 5;
+        $hostA = $this->newHostBuffer($n*$n*$batch_count,$dtype);
+        $hostB = $this->newHostBuffer($n*$nrhs*$batch_count,$dtype);
+        $trues = [];
+        for($b=0;$b<$batch_count;$b++) {
+            $a = $this->pivotingMatrix($n,$b);
+            for($i=0;$i<$n*$n;$i++) {
+                $hostA[$b*$n*$n+$i] = $a[$i];
+            }
+            for($i=0;$i<$n*$nrhs;$i++) {
+                $trues[$b*$n*$nrhs+$i] = (($i+$b)%5)-2;
+            }
+            for($i=0;$i<$n;$i++) {
+                for($r=0;$r<$nrhs;$r++) {
+                    $sum = 0;
+                    for($j=0;$j<$n;$j++) {
+                        $sum += $a[$i*$n+$j]*$trues[$b*$n*$nrhs+$j*$nrhs+$r];
+                    }
+                    $hostB[$b*$n*$nrhs+$i*$nrhs+$r] = $sum;
+                }
+            }
+        }
+        $hostInfo = $this->newHostBuffer($batch_count,NDArray::int32);
+        $bufferA = $ocl->Buffer($context,$n*$n*$batch_count*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufferB = $ocl->Buffer($context,$n*$nrhs*$batch_count*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+        $bufferIpiv = $ocl->Buffer($context,$n*$batch_count*4,OpenCL::CL_MEM_READ_WRITE);
+        $bufferInfo = $ocl->Buffer($context,$batch_count*4,OpenCL::CL_MEM_READ_WRITE);
+        $events = $ocl->EventList();
+
+        $math->getrfBatched(BLAS::RowMajor,$n,
+            $bufferA,$offsetA=0,$ldA=$n,$strideA=$n*$n,
+            $bufferIpiv,$offsetIpiv=0,$strideIpiv=$n,
+            $bufferInfo,$offsetInfo=0,
+            $batch_count,
+            $queue
+        );
+        $math->getrsBatched(BLAS::RowMajor,BLAS::NoTrans,$n,$nrhs,
+            $bufferA,$offsetA=0,$ldA=$n,$strideA=$n*$n,
+            $bufferIpiv,$offsetIpiv=0,$strideIpiv=$n,
+            $bufferB,$offsetB=0,$ldB=$nrhs,$strideB=$n*$nrhs,
+            $batch_count,
+            $queue,$events
+        );
+        $events->wait();
+        $bufferInfo->read($queue,$hostInfo);
+        for($b=0;$b<$batch_count;$b++) {
+            $this->assertEquals(0,$hostInfo[$b]);
+        }
+        $bufferB->read($queue,$hostB);
+        for($i=0;$i<$n*$nrhs*$batch_count;$i++) {
+            $this->assertEqualsWithDelta($trues[$i],$hostB[$i],1e-4);
+        }
+    }
+
+    public function testTrmmTrsmStridedBatched()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch_count = 3;
+        // the second size is larger than the triangular kernel
+        foreach([[6,4],[70,3]] as [$t,$v]) {
+            foreach([BLAS::Left,BLAS::Right] as $side) {
+                foreach([[BLAS::Lower,BLAS::NoTrans],[BLAS::Upper,BLAS::Trans]] as [$uplo,$trans]) {
+                    [$m,$n] = ($side==BLAS::Left) ? [$t,$v] : [$v,$t];
+                    $hostA = $this->newHostBuffer($t*$t*$batch_count,$dtype);
+                    for($b=0;$b<$batch_count;$b++) {
+                        for($i=0;$i<$t;$i++) {
+                            for($j=0;$j<$t;$j++) {
+                                $hostA[$b*$t*$t+$i*$t+$j] = ($i==$j) ? 2+$b : ((($i+$j+$b)%3)-1)*0.1;
+                            }
+                        }
+                    }
+                    $hostB = $this->newHostBuffer($m*$n*$batch_count,$dtype);
+                    $trues = [];
+                    for($i=0;$i<$m*$n*$batch_count;$i++) {
+                        $trues[$i] = $hostB[$i] = ($i%7)-3;
+                    }
+                    $bufferA = $ocl->Buffer($context,$t*$t*$batch_count*4,
+                        OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+                    $bufferB = $ocl->Buffer($context,$m*$n*$batch_count*4,
+                        OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+                    $events = $ocl->EventList();
+
+                    // op(A) of the first batch on the host
+                    $opA = function($i,$k) use ($hostA,$t,$uplo,$trans) {
+                        [$r,$c] = ($trans==BLAS::NoTrans) ? [$i,$k] : [$k,$i];
+                        if(($uplo==BLAS::Lower) ? ($c>$r) : ($c<$r)) {
+                            return 0;
+                        }
+                        return $hostA[$r*$t+$c];
+                    };
+                    $math->trmmStridedBatched(BLAS::RowMajor,$side,$uplo,$trans,BLAS::NonUnit,$m,$n,
+                        2.0,
+                        $bufferA,$offsetA=0,$ldA=$t,$strideA=$t*$t,
+                        $bufferB,$offsetB=0,$ldB=$n,$strideB=$m*$n,
+                        $batch_count,
+                        $queue,$events
+                    );
+                    $events->wait();
+                    $bufferB->read($queue,$hostB);
+                    for($i=0;$i<$m;$i++) {
+                        for($j=0;$j<$n;$j++) {
+                            $sum = 0;
+                            for($k=0;$k<$t;$k++) {
+                                $sum += ($side==BLAS::Left) ?
+                                    $opA($i,$k)*$trues[$k*$n+$j] :
+                                    $trues[$i*$n+$k]*$opA($k,$j);
+                            }
+                            $this->assertEqualsWithDelta(2*$sum,$hostB[$i*$n+$j],1e-3);
+                        }
+                    }
+
+                    $events = $ocl->EventList();
+                    $math->trsmStridedBatched(BLAS::RowMajor,$side,$uplo,$trans,BLAS::NonUnit,$m,$n,
+                        0.5,
+                        $bufferA,$offsetA=0,$ldA=$t,$strideA=$t*$t,
+                        $bufferB,$offsetB=0,$ldB=$n,$strideB=$m*$n,
+                        $batch_count,
+                        $queue,$events
+                    );
+                    $events->wait();
+                    $bufferB->read($queue,$hostB);
+                    for($i=0;$i<$m*$n*$batch_count;$i++) {
+                        $this->assertEqualsWithDelta($trues[$i],$hostB[$i],1e-3);
+                    }
+                }
+            }
+        }
+    }
+
+    public function testSyrkStridedBatchedNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $n = 3;
+        $k = 4;
+        $batch_count = 4;
+        $hostA = $this->newHostBuffer($n*$k*$batch_count,$dtype);
+        for($i=0;$i<$n*$k*$batch_count;$i++) {
+            $hostA[$i] = ($i%5)-2;
+        }
+        $hostC = $this->newHostBuffer($n*$n*$batch_count,$dtype);
+        for($i=0;$i<$n*$n*$batch_count;$i++) {
+            $hostC[$i] = 0;
+        }
+        $bufferA = $ocl->Buffer($context,$n*$k*$batch_count*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufferC = $ocl->Buffer($context,$n*$n*$batch_count*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostC);
+        $events = $ocl->EventList();
+
+        $math->syrkStridedBatched(BLAS::RowMajor,BLAS::Upper,BLAS::NoTrans,$n,$k,
+            1.0,
+            $bufferA,$offsetA=0,$ldA=$k,$strideA=$n*$k,
+            0.0,
+            $bufferC,$offsetC=0,$ldC=$n,$strideC=$n*$n,
+            $batch_count,
+            $queue,$events
+        );
+        $events->wait();
+        $bufferC->read($queue,$hostC);
+        for($b=0;$b<$batch_count;$b++) {
+            for($i=0;$i<$n;$i++) {
+                for($j=$i;$j<$n;$j++) {
+                    $sum = 0;
+                    for($l=0;$l<$k;$l++) {
+                        $sum += $hostA[$b*$n*$k+$i*$k+$l]*$hostA[$b*$n*$k+$j*$k+$l];
+                    }
+                    $this->assertEqualsWithDelta($sum,$hostC[$b*$n*$n+$i*$n+$j],1e-4);
+                }
+            }
+        }
+    }
+
+    public function testGemvStridedBatchedNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $m = 5;
+        $n = 3;
+        $batch_count = 6;
+        foreach([BLAS::NoTrans,BLAS::Trans] as $trans) {
+            [$rows,$cols] = ($trans==BLAS::NoTrans) ? [$m,$n] : [$n,$m];
+            $hostA = $this->newHostBuffer($m*$n*$batch_count,$dtype);
+            for($i=0;$i<$m*$n*$batch_count;$i++) {
+                $hostA[$i] = ($i%7)-3;
+            }
+            $hostX = $this->newHostBuffer($cols*$batch_count,$dtype);
+            for($i=0;$i<$cols*$batch_count;$i++) {
+                $hostX[$i] = ($i%3)+1;
+            }
+            // y is strided by incY=2
+            $hostY = $this->newHostBuffer($rows*2*$batch_count,$dtype);
+            for($i=0;$i<$rows*2*$batch_count;$i++) {
+                $hostY[$i] = 1;
+            }
+            $bufferA = $ocl->Buffer($context,$m*$n*$batch_count*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferX = $ocl->Buffer($context,$cols*$batch_count*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $bufferY = $ocl->Buffer($context,$rows*2*$batch_count*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostY);
+            $events = $ocl->EventList();
+
+            $math->gemvStridedBatched(BLAS::RowMajor,$trans,$m,$n,
+                2.0,
+                $bufferA,$offsetA=0,$ldA=$n,$strideA=$m*$n,
+                $bufferX,$offsetX=0,$incX=1,$strideX=$cols,
+                3.0,
+                $bufferY,$offsetY=0,$incY=2,$strideY=$rows*2,
+                $batch_count,
+                $queue,$events
+            );
+            $events->wait();
+            $bufferY->read($queue,$hostY);
+            for($b=0;$b<$batch_count;$b++) {
+                for($i=0;$i<$rows;$i++) {
+                    $sum = 0;
+                    for($l=0;$l<$cols;$l++) {
+                        $aij = ($trans==BLAS::NoTrans) ?
+                            $hostA[$b*$m*$n+$i*$n+$l] : $hostA[$b*$m*$n+$l*$n+$i];
+                        $sum += $aij*$hostX[$b*$cols+$l];
+                    }
+                    $this->assertEqualsWithDelta(2*$sum+3,$hostY[$b*$rows*2+$i*2],1e-4);
+                    $this->assertEquals(1,$hostY[$b*$rows*2+$i*2+1]);
+                }
+            }
+        }
+    }
+
+    public function testReduceNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // rows, columns, a 3D middle axis and a long axis for the work-group kernel
+        foreach([[4,7,1],[1,7,5],[3,6,4],[2,1000,1]] as [$m,$n,$k]) {
+            $size = $m*$n*$k;
+            $hostA = $this->newHostBuffer($size,$dtype);
+            for($i=0;$i<$size;$i++) {
+                $hostA[$i] = (($i*7)%11)-5;
+            }
+            $bufferA = $ocl->Buffer($context,$size*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $ops = [
+                Math::REDUCE_SUM, Math::REDUCE_MEAN, Math::REDUCE_MAX,
+                Math::REDUCE_MIN, Math::REDUCE_ARGMAX, Math::REDUCE_ARGMIN,
+            ];
+            foreach($ops as $op) {
+                $arg = ($op==Math::REDUCE_ARGMAX || $op==Math::REDUCE_ARGMIN);
+                $hostB = $this->newHostBuffer($m*$k,$arg ? NDArray::int32 : $dtype);
+                $bufferB = $ocl->Buffer($context,$m*$k*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->reduce($op,$m,$n,$k,
+                    $bufferA,$offsetA=0,
+                    $bufferB,$offsetB=0,
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferB->read($queue,$hostB);
+                for($i=0;$i<$m;$i++) {
+                    for($j=0;$j<$k;$j++) {
+                        $values = [];
+                        for($l=0;$l<$n;$l++) {
+                            $values[] = $hostA[$i*$n*$k+$l*$k+$j];
+                        }
+                        switch($op) {
+                            case Math::REDUCE_SUM: $true = array_sum($values); break;
+                            case Math::REDUCE_MEAN: $true = array_sum($values)/$n; break;
+                            case Math::REDUCE_MAX: $true = max($values); break;
+                            case Math::REDUCE_MIN: $true = min($values); break;
+                            // the first one among equal values
+                            case Math::REDUCE_ARGMAX: $true = array_search(max($values),$values); break;
+                            case Math::REDUCE_ARGMIN: $true = array_search(min($values),$values); break;
+                        }
+                        $this->assertEqualsWithDelta($true,$hostB[$i*$k+$j],1e-3);
+                    }
+                }
+            }
+        }
+
+        // A or B past the end of its buffer
+        [$m,$n,$k] = [2,3,4];
+        $hostA = $this->newHostBuffer($m*$n*$k,$dtype);
+        $hostB = $this->newHostBuffer($m*$k,$dtype);
+        $hostI = $this->newHostBuffer($m*$k,NDArray::int32);
+        $bufferA = $ocl->Buffer($context,count($hostA)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufferB = $ocl->Buffer($context,count($hostB)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+        $bufferI = $ocl->Buffer($context,count($hostI)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostI);
+        $cases = [
+            [Math::REDUCE_SUM,1,$bufferB,0],
+            [Math::REDUCE_MAX,0,$bufferB,1],
+            [Math::REDUCE_ARGMAX,0,$bufferI,1],
+        ];
+        foreach($cases as [$op,$offsetA,$bufferOut,$offsetB]) {
+            $thrown = false;
+            try {
+                $math->reduce($op,$m,$n,$k,
+                    $bufferA,$offsetA,
+                    $bufferOut,$offsetB,
+                    $queue
+                );
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testReduceStatsNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // layer norm rows, batch norm columns and a long axis for the work-group kernel
+        foreach([[4,9,1],[1,9,6],[3,500,1]] as [$m,$n,$k]) {
+            $size = $m*$n*$k;
+            $hostA = $this->newHostBuffer($size,$dtype);
+            for($i=0;$i<$size;$i++) {
+                $hostA[$i] = ((($i*5)%13)-6)*0.5;
+            }
+            $hostB = $this->newHostBuffer($m*$k*4,$dtype);
+            $bufferA = $ocl->Buffer($context,$size*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferB = $ocl->Buffer($context,$m*$k*4*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->reduceStats($m,$n,$k,
+                $bufferA,$offsetA=0,
+                $bufferB,$offsetB=0,
+                $queue,$events
+            );
+            $events->wait();
+            $bufferB->read($queue,$hostB);
+            for($i=0;$i<$m;$i++) {
+                for($j=0;$j<$k;$j++) {
+                    $values = [];
+                    for($l=0;$l<$n;$l++) {
+                        $values[] = $hostA[$i*$n*$k+$l*$k+$j];
+                    }
+                    $sumsq = array_sum(array_map(fn($x)=>$x*$x,$values));
+                    $o = ($i*$k+$j)*4;
+                    $this->assertEqualsWithDelta(array_sum($values),$hostB[$o],1e-3);
+                    $this->assertEqualsWithDelta($sumsq,$hostB[$o+1],1e-2);
+                    $this->assertEquals(min($values),$hostB[$o+2]);
+                    $this->assertEquals(max($values),$hostB[$o+3]);
+                }
+            }
+        }
+
+        // B of [m,k,4] past the end of its buffer
+        $thrown = false;
+        try {
+            $math->reduceStats($m,$n,$k,$bufferA,0,$bufferB,1,$queue);
+        } catch(RuntimeException $e) {
+            $thrown = true;
+        }
+        $this->assertTrue($thrown);
+    }
+
+    public function testReduceNaN()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // one row of each length, with NaN at 2 and 4; the long one uses the work-group kernels
+        foreach([6,300] as $n) {
+            $hostA = $this->newHostBuffer($n,$dtype);
+            for($i=0;$i<$n;$i++) {
+                $hostA[$i] = ($i%5)-2;
+            }
+            $hostA[2] = NAN;
+            $hostA[4] = NAN;
+            $bufferA = $ocl->Buffer($context,$n*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            foreach([Math::REDUCE_MAX,Math::REDUCE_MIN] as $op) {
+                $hostB = $this->newHostBuffer(1,$dtype);
+                $bufferB = $ocl->Buffer($context,4,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+                $math->reduce($op,1,$n,1,$bufferA,0,$bufferB,0,$queue);
+                $queue->finish();
+                $bufferB->read($queue,$hostB);
+                $this->assertNan($hostB[0]);
+            }
+            foreach([Math::REDUCE_ARGMAX,Math::REDUCE_ARGMIN] as $op) {
+                $hostI = $this->newHostBuffer(1,NDArray::int32);
+                $bufferI = $ocl->Buffer($context,4,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostI);
+                $math->reduce($op,1,$n,1,$bufferA,0,$bufferI,0,$queue);
+                $queue->finish();
+                $bufferI->read($queue,$hostI);
+                $this->assertEquals(2,$hostI[0]);
+            }
+            $hostS = $this->newHostBuffer(4,$dtype);
+            $bufferS = $ocl->Buffer($context,4*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostS);
+            $math->reduceStats(1,$n,1,$bufferA,0,$bufferS,0,$queue);
+            $queue->finish();
+            $bufferS->read($queue,$hostS);
+            $this->assertNan($hostS[2]);
+            $this->assertNan($hostS[3]);
+        }
+    }
+
+    public function testUnaryNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        // [dtype, bytes, delta]; float16 is computed in float and stored as half
+        $dtypes = [[NDArray::float32,4,1e-5],[NDArray::float16,2,1e-2]];
+        foreach($dtypes as [$dtype,$bytes,$delta]) {
+            $rows = 3;
+            $cols = 4;
+            $hostX = $this->newHostBuffer($rows*$cols,$dtype);
+            for($i=0;$i<$rows*$cols;$i++) {
+                $hostX[$i] = ($i-5)*0.25;
+            }
+            $bufferX = $ocl->Buffer($context,$rows*$cols*$bytes,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $cases = [
+                [Math::UNARY_EXP,0.0,0.0,fn($x)=>exp($x)],
+                [Math::UNARY_TANH,0.0,0.0,fn($x)=>tanh($x)],
+                [Math::UNARY_RELU,0.0,0.0,fn($x)=>max($x,0)],
+                [Math::UNARY_CLAMP,-0.5,0.5,fn($x)=>min(max($x,-0.5),0.5)],
+                [Math::UNARY_AFFINE,2.0,1.0,fn($x)=>2*$x+1],
+            ];
+            foreach($cases as [$op,$alpha,$beta,$func]) {
+                // Y of [cols,rows] is the transpose of X of [rows,cols]
+                $hostY = $this->newHostBuffer($rows*$cols,$dtype);
+                $bufferY = $ocl->Buffer($context,$rows*$cols*$bytes,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostY);
+                $events = $ocl->EventList();
+                $math->unary($op,$alpha,$beta,[$rows,$cols],
+                    $bufferX,$offsetX=0,$stridesX=null,
+                    $bufferY,$offsetY=0,$stridesY=[1,$rows],
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferY->read($queue,$hostY);
+                for($i=0;$i<$rows;$i++) {
+                    for($j=0;$j<$cols;$j++) {
+                        $this->assertEqualsWithDelta($func($hostX[$i*$cols+$j]),$hostY[$j*$rows+$i],$delta);
+                    }
+                }
+            }
+        }
+    }
+
+    public function testBinaryBroadcast()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        // [dtype, bytes, delta]; float16 is computed in float and stored as half
+        $dtypes = [[NDArray::float32,4,1e-4],[NDArray::float16,2,1e-2]];
+        foreach($dtypes as [$dtype,$bytes,$delta]) {
+            $batch = 2;
+            $rows = 3;
+            $cols = 4;
+            $size = $batch*$rows*$cols;
+            $hostA = $this->newHostBuffer($size,$dtype);
+            for($i=0;$i<$size;$i++) {
+                $hostA[$i] = $i+1;
+            }
+            $hostB = $this->newHostBuffer($rows,$dtype);
+            for($i=0;$i<$rows;$i++) {
+                $hostB[$i] = ($i+1)*10;
+            }
+            $bufferA = $ocl->Buffer($context,$size*$bytes,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+            $bufferB = $ocl->Buffer($context,$rows*$bytes,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostB);
+            $cases = [
+                [Math::BINARY_ADD,fn($a,$b)=>$a+$b],
+                [Math::BINARY_MUL,fn($a,$b)=>$a*$b],
+                [Math::BINARY_DIV,fn($a,$b)=>$a/$b],
+                [Math::BINARY_MAX,fn($a,$b)=>max($a,$b)],
+            ];
+            foreach($cases as [$op,$func]) {
+                $hostC = $this->newHostBuffer($size,$dtype);
+                $bufferC = $ocl->Buffer($context,$size*$bytes,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostC);
+                $events = $ocl->EventList();
+                // [batch,rows,cols] op [rows,1]
+                $math->binary($op,
+                    [$batch,$rows,$cols],$bufferA,$offsetA=0,$stridesA=null,
+                    [$rows,1],$bufferB,$offsetB=0,$stridesB=null,
+                    $bufferC,$offsetC=0,$stridesC=null,
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferC->read($queue,$hostC);
+                for($i=0;$i<$size;$i++) {
+                    $r = intdiv($i,$cols)%$rows;
+                    $this->assertEqualsWithDelta($func($hostA[$i],$hostB[$r]),$hostC[$i],$delta);
+                }
+            }
+        }
+    }
+
+    public function testUnaryBinaryBufferCheck()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $rows = 3;
+        $cols = 4;
+        $size = $rows*$cols;
+        $hostX = $this->newHostBuffer($size,$dtype);
+        for($i=0;$i<$size;$i++) {
+            $hostX[$i] = $i;
+        }
+        $bufferX = $ocl->Buffer($context,$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufferY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+
+        // a negative stride from the last row reverses the rows
+        $events = $ocl->EventList();
+        $math->unary(Math::UNARY_COPY,0.0,0.0,[$rows,$cols],
+            $bufferX,$offsetX=($rows-1)*$cols,$stridesX=[-$cols,1],
+            $bufferY,$offsetY=0,$stridesY=null,
+            $queue,$events
+        );
+        $events->wait();
+        $hostY = $this->newHostBuffer($size,$dtype);
+        $bufferY->read($queue,$hostY);
+        for($i=0;$i<$rows;$i++) {
+            for($j=0;$j<$cols;$j++) {
+                $this->assertEquals($hostX[($rows-1-$i)*$cols+$j],$hostY[$i*$cols+$j]);
+            }
+        }
+
+        $calls = [
+            // X ends past the buffer
+            fn() => $math->unary(Math::UNARY_COPY,0.0,0.0,[$rows,$cols],
+                $bufferX,1,null,$bufferY,0,null,$queue),
+            // X starts before the buffer
+            fn() => $math->unary(Math::UNARY_COPY,0.0,0.0,[$rows,$cols],
+                $bufferX,0,[-$cols,1],$bufferY,0,null,$queue),
+            // every row of Y is the same location
+            fn() => $math->unary(Math::UNARY_COPY,0.0,0.0,[$rows,$cols],
+                $bufferX,0,null,$bufferY,0,[0,1],$queue),
+            // C ends past the buffer
+            fn() => $math->binary(Math::BINARY_ADD,
+                [$rows,$cols],$bufferX,0,null,
+                [$rows,$cols],$bufferX,0,null,
+                $bufferY,0,[$cols+1,1],$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testFusedExpression()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $rows = 5;
+        $cols = 6;
+        $size = $rows*$cols;
+        $hostX = $this->newHostBuffer($size,$dtype);
+        $hostMask = $this->newHostBuffer($size,$dtype);
+        for($i=0;$i<$size;$i++) {
+            $hostX[$i] = ($i-12)*0.5;
+            $hostMask[$i] = $i%2;
+        }
+        $hostBias = $this->newHostBuffer($cols,$dtype);
+        for($j=0;$j<$cols;$j++) {
+            $hostBias[$j] = $j-3;
+        }
+        $hostY = $this->newHostBuffer($size,$dtype);
+        $bufferX = $ocl->Buffer($context,$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufferMask = $ocl->Buffer($context,$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostMask);
+        $bufferBias = $ocl->Buffer($context,$cols*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostBias);
+        $bufferY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+        $events = $ocl->EventList();
+
+        // y = relu(a*x + b) * mask, with b broadcasted over the rows
+        $math->fused('t0 = s0*x0 + x1; relu(t0)*x2',[$rows,$cols],
+            [[$bufferX,0],[$bufferBias,0,[$cols]],[$bufferMask,0]],
+            [2.0],
+            $bufferY,$offsetY=0,$stridesY=null,
+            $queue,$events
+        );
+        $events->wait();
+        $bufferY->read($queue,$hostY);
+        for($i=0;$i<$rows;$i++) {
+            for($j=0;$j<$cols;$j++) {
+                $k = $i*$cols+$j;
+                $true = max(2.0*$hostX[$k]+$hostBias[$j],0)*$hostMask[$k];
+                $this->assertEqualsWithDelta($true,$hostY[$k],1e-5);
+            }
+        }
+
+        // an input that ends past its buffer is an error, not an out-of-bounds read
+        $thrown = false;
+        try {
+            $math->fused('x0 + x1',[$rows,$cols],
+                [[$bufferX,0],[$bufferMask,1]],
+                [],
+                $bufferY,0,null,
+                $queue
+            );
+        } catch(RuntimeException $e) {
+            $thrown = true;
+        }
+        $this->assertTrue($thrown);
+
+        // only the inputs, scalars, temporaries and known functions are accepted
+        $this->expectException(RuntimeException::class);
+        $math->fused('x0 + x1',[$rows,$cols],
+            [[$bufferX,0]],
+            [],
+            $bufferY,0,null,
+            $queue
+        );
+    }
+
+    public function testSoftmaxNormal()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // short rows per work-item and long rows per work-group
+        foreach([[4,10],[3,300]] as [$m,$n]) {
+            $ld = $n+2;
+            $hostX = $this->newHostBuffer($m*$ld,$dtype);
+            for($i=0;$i<$m*$ld;$i++) {
+                // large values must not overflow
+                $hostX[$i] = (($i*7)%13)+($i%$ld==0 ? 100 : 0);
+            }
+            $bufferX = $ocl->Buffer($context,$m*$ld*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            foreach(['softmax','logSoftmax'] as $func) {
+                $hostY = $this->newHostBuffer($m*$n,$dtype);
+                $bufferY = $ocl->Buffer($context,$m*$n*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->$func($m,$n,
+                    $bufferX,$offsetX=0,$ldX=$ld,
+                    $bufferY,$offsetY=0,$ldY=$n,
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferY->read($queue,$hostY);
+                for($i=0;$i<$m;$i++) {
+                    $max = -INF;
+                    for($j=0;$j<$n;$j++) {
+                        $max = max($max,$hostX[$i*$ld+$j]);
+                    }
+                    $sum = 0;
+                    for($j=0;$j<$n;$j++) {
+                        $sum += exp($hostX[$i*$ld+$j]-$max);
+                    }
+                    for($j=0;$j<$n;$j++) {
+                        $x = $hostX[$i*$ld+$j];
+                        $true = ($func=='softmax') ? exp($x-$max)/$sum : $x-$max-log($sum);
+                        $this->assertEqualsWithDelta($true,$hostY[$i*$n+$j],1e-4);
+                    }
+                }
+            }
+        }
+
+        // the last row of X or Y past the end of its buffer
+        [$m,$n] = [4,10];
+        $hostX = $this->newHostBuffer($m*$n,$dtype);
+        $bufferX = $ocl->Buffer($context,$m*$n*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $calls = [
+            fn() => $math->softmax($m,$n,$bufferX,1,$n,$bufferX,0,$n,$queue),
+            fn() => $math->softmax($m,$n,$bufferX,0,$n,$bufferX,0,$n+1,$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testSoftmaxMasked()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $m = 3;
+        // short rows per work-item and long rows per work-group
+        foreach([10,300] as $n) {
+            $hostX = $this->newHostBuffer($m*$n,$dtype);
+            for($i=0;$i<$m;$i++) {
+                for($j=0;$j<$n;$j++) {
+                    $hostX[$i*$n+$j] = ($i*$n+$j)*7%13;
+                }
+            }
+            // -INF at the start of the first row (left padding)
+            for($j=0;$j<3;$j++) {
+                $hostX[$j] = -INF;
+            }
+            // the second row is masked entirely
+            for($j=0;$j<$n;$j++) {
+                $hostX[$n+$j] = -INF;
+            }
+            // the end of the third row is masked (causal)
+            for($j=intdiv($n,2);$j<$n;$j++) {
+                $hostX[2*$n+$j] = -INF;
+            }
+            $bufferX = $ocl->Buffer($context,$m*$n*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            foreach(['softmax','logSoftmax'] as $func) {
+                $hostY = $this->newHostBuffer($m*$n,$dtype);
+                $bufferY = $ocl->Buffer($context,$m*$n*4,OpenCL::CL_MEM_READ_WRITE);
+                $events = $ocl->EventList();
+                $math->$func($m,$n,
+                    $bufferX,$offsetX=0,$ldX=$n,
+                    $bufferY,$offsetY=0,$ldY=$n,
+                    $queue,$events
+                );
+                $events->wait();
+                $bufferY->read($queue,$hostY);
+                for($i=0;$i<$m;$i++) {
+                    $max = -INF;
+                    for($j=0;$j<$n;$j++) {
+                        $max = max($max,$hostX[$i*$n+$j]);
+                    }
+                    $sum = 0;
+                    for($j=0;$j<$n;$j++) {
+                        if($hostX[$i*$n+$j]!=-INF) {
+                            $sum += exp($hostX[$i*$n+$j]-$max);
+                        }
+                    }
+                    for($j=0;$j<$n;$j++) {
+                        $x = $hostX[$i*$n+$j];
+                        if($func=='softmax') {
+                            $true = ($sum>0) ? exp($x-$max)/$sum : 0.0;
+                        } else {
+                            $true = ($sum>0 && $x!=-INF) ? $x-$max-log($sum) : -INF;
+                        }
+                        if($true==-INF) {
+                            $this->assertEquals(-INF,$hostY[$i*$n+$j]);
+                        } else {
+                            $this->assertEqualsWithDelta($true,$hostY[$i*$n+$j],1e-4);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    public function testPool2dForwardBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch_count = 2; $channels = 3;
+        $height = 5; $width = 6;
+        $pool_h = 3; $pool_w = 2;
+        $pad_h = 1; $pad_w = 0;
+        $stride_h = 2; $stride_w = 2;
+        $out_h = intdiv($height+2*$pad_h-$pool_h,$stride_h)+1;
+        $out_w = intdiv($width+2*$pad_w-$pool_w,$stride_w)+1;
+        $planes = $batch_count*$channels;
+        $inSize = $height*$width;
+        $outSize = $out_h*$out_w;
+        $hostX = $this->newHostBuffer($planes*$inSize,$dtype);
+        $hostDY = $this->newHostBuffer($planes*$outSize,$dtype);
+        // distinct values so that the maximum is unique
+        for($i=0;$i<count($hostX);$i++) { $hostX[$i] = ($i*37)%181; }
+        for($i=0;$i<count($hostDY);$i++) { $hostDY[$i] = ($i*5)%3-1; }
+        $bufX = $ocl->Buffer($context,count($hostX)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufDY = $ocl->Buffer($context,count($hostDY)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostDY);
+        $args = [$batch_count,$channels,$height,$width,
+            $pool_h,$pool_w,$pad_h,$pad_w,$stride_h,$stride_w];
+
+        foreach([Math::POOL_MAX,Math::POOL_AVG] as $mode) {
+            $trueY = array_fill(0,$planes*$outSize,0);
+            $trueI = array_fill(0,$planes*$outSize,0);
+            $trueDX = array_fill(0,$planes*$inSize,0);
+            for($p=0;$p<$planes;$p++) {
+                for($oh=0;$oh<$out_h;$oh++) {
+                    for($ow=0;$ow<$out_w;$ow++) {
+                        $positions = [];
+                        for($kh=0;$kh<$pool_h;$kh++) {
+                            $y = $oh*$stride_h-$pad_h+$kh;
+                            for($kw=0;$kw<$pool_w;$kw++) {
+                                $x = $ow*$stride_w-$pad_w+$kw;
+                                if($y>=0 && $y<$height && $x>=0 && $x<$width) {
+                                    $positions[] = $y*$width+$x;
+                                }
+                            }
+                        }
+                        $yi = $p*$outSize+$oh*$out_w+$ow;
+                        if($mode==Math::POOL_MAX) {
+                            $pos = $positions[0];
+                            foreach($positions as $q) {
+                                if($hostX[$p*$inSize+$q]>$hostX[$p*$inSize+$pos]) { $pos = $q; }
+                            }
+                            $trueY[$yi] = $hostX[$p*$inSize+$pos];
+                            $trueI[$yi] = $pos;
+                            $trueDX[$p*$inSize+$pos] += $hostDY[$yi];
+                        } else {
+                            // the padding is not counted
+                            foreach($positions as $q) {
+                                $trueY[$yi] += $hostX[$p*$inSize+$q]/count($positions);
+                                $trueDX[$p*$inSize+$q] += $hostDY[$yi]/count($positions);
+                            }
+                        }
+                    }
+                }
+            }
+            $hostY = $this->newHostBuffer($planes*$outSize,$dtype);
+            $hostI = $this->newHostBuffer($planes*$outSize,NDArray::int32);
+            $bufY = $ocl->Buffer($context,count($hostY)*4,OpenCL::CL_MEM_READ_WRITE);
+            $bufI = $ocl->Buffer($context,count($hostI)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostI);
+            $indices = ($mode==Math::POOL_MAX) ? $bufI : null;
+            $events = $ocl->EventList();
+            $math->pool2d($mode,...[...$args,$bufX,0,$bufY,0,$indices,0,$queue,$events]);
+            $events->wait();
+            $bufY->read($queue,$hostY);
+            for($i=0;$i<count($trueY);$i++) {
+                $this->assertEqualsWithDelta($trueY[$i],$hostY[$i],1e-4);
+            }
+            if($mode==Math::POOL_MAX) {
+                $bufI->read($queue,$hostI);
+                for($i=0;$i<count($trueI);$i++) {
+                    $this->assertEquals($trueI[$i],$hostI[$i]);
+                }
+            }
+
+            $hostDX = $this->newHostBuffer($planes*$inSize,$dtype);
+            $bufDX = $ocl->Buffer($context,count($hostDX)*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->pool2dBackward($mode,...[...$args,$bufDY,0,$indices,0,$bufDX,0,$queue,$events]);
+            $events->wait();
+            $bufDX->read($queue,$hostDX);
+            for($i=0;$i<count($trueDX);$i++) {
+                $this->assertEqualsWithDelta($trueDX[$i],$hostDX[$i],1e-4);
+            }
+
+            // global pooling
+            $hostGY = $this->newHostBuffer($planes,$dtype);
+            $hostGI = $this->newHostBuffer($planes,NDArray::int32);
+            $bufGY = $ocl->Buffer($context,$planes*4,OpenCL::CL_MEM_READ_WRITE);
+            $bufGI = $ocl->Buffer($context,$planes*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostGI);
+            $gindices = ($mode==Math::POOL_MAX) ? $bufGI : null;
+            $events = $ocl->EventList();
+            $math->globalPool2d($mode,$batch_count,$channels,$height,$width,
+                $bufX,0,$bufGY,0,$gindices,0,$queue,$events);
+            $events->wait();
+            $bufGY->read($queue,$hostGY);
+            $bufGI->read($queue,$hostGI);
+            for($p=0;$p<$planes;$p++) {
+                $values = [];
+                for($i=0;$i<$inSize;$i++) {
+                    $values[] = $hostX[$p*$inSize+$i];
+                }
+                if($mode==Math::POOL_MAX) {
+                    $this->assertEquals(max($values),$hostGY[$p]);
+                    $this->assertEquals(array_search(max($values),$values),$hostGI[$p]);
+                } else {
+                    $this->assertEqualsWithDelta(array_sum($values)/$inSize,$hostGY[$p],1e-3);
+                }
+            }
+            $events = $ocl->EventList();
+            $math->globalPool2dBackward($mode,$batch_count,$channels,$height,$width,
+                $bufGY,0,$gindices,0,$bufDX,0,$queue,$events);
+            $events->wait();
+            $bufDX->read($queue,$hostDX);
+            for($p=0;$p<$planes;$p++) {
+                for($i=0;$i<$inSize;$i++) {
+                    if($mode==Math::POOL_MAX) {
+                        $true = ($i==$hostGI[$p]) ? $hostGY[$p] : 0;
+                    } else {
+                        $true = $hostGY[$p]/$inSize;
+                    }
+                    $this->assertEqualsWithDelta($true,$hostDX[$p*$inSize+$i],1e-4);
+                }
+            }
+        }
+    }
+
+    public function testBatchNormForwardBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        // [dtype, bytes, delta]; float16 is computed in float and stored as half
+        $dtypes = [[NDArray::float32,4,1e-4],[NDArray::float16,2,1e-2]];
+        foreach($dtypes as [$dtype,$bytes,$delta]) {
+            // NCHW with 2 images, 3 channels and 10 pixels
+            $m = 2; $n = 3; $k = 10;
+            $epsilon = 1e-3; $momentum = 0.9;
+            $count = $m*$k;
+            $hostX = $this->newHostBuffer($m*$n*$k,$dtype);
+            $hostDY = $this->newHostBuffer($m*$n*$k,$dtype);
+            $hostGamma = $this->newHostBuffer($n,$dtype);
+            $hostBeta = $this->newHostBuffer($n,$dtype);
+            $hostRunning = $this->newHostBuffer($n,$dtype);
+            for($i=0;$i<count($hostX);$i++) { $hostX[$i] = (($i*7)%11)*0.5; }
+            for($i=0;$i<count($hostDY);$i++) { $hostDY[$i] = ($i*5)%3-1; }
+            for($j=0;$j<$n;$j++) { $hostGamma[$j] = 1+$j*0.5; $hostBeta[$j] = $j-1; $hostRunning[$j] = 1; }
+            $newBuffer = function($host) use ($ocl,$context,$bytes) {
+                return $ocl->Buffer($context,count($host)*$bytes,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$host);
+            };
+            $bufX = $newBuffer($hostX);
+            $bufDY = $newBuffer($hostDY);
+            $bufGamma = $newBuffer($hostGamma);
+            $bufBeta = $newBuffer($hostBeta);
+            $bufRunningMean = $newBuffer($hostRunning);
+            $bufRunningVar = $newBuffer($hostRunning);
+            $bufY = $newBuffer($this->newHostBuffer(count($hostX),$dtype));
+            $bufDX = $newBuffer($this->newHostBuffer(count($hostX),$dtype));
+            $bufSavedMean = $newBuffer($this->newHostBuffer($n,$dtype));
+            $bufSavedInvStd = $newBuffer($this->newHostBuffer($n,$dtype));
+            $bufDGamma = $newBuffer($this->newHostBuffer($n,$dtype));
+            $bufDBeta = $newBuffer($this->newHostBuffer($n,$dtype));
+
+            $events = $ocl->EventList();
+            $math->batchNormTraining($m,$n,$k,$epsilon,$momentum,
+                $bufX,0,$bufGamma,0,$bufBeta,0,$bufY,0,
+                $bufRunningMean,0,$bufRunningVar,0,$bufSavedMean,0,$bufSavedInvStd,0,
+                $queue,$events);
+            $events->wait();
+            $events = $ocl->EventList();
+            $math->batchNormBackward($m,$n,$k,
+                $bufX,0,$bufGamma,0,$bufSavedMean,0,$bufSavedInvStd,0,
+                $bufDY,0,$bufDX,0,$bufDGamma,0,$bufDBeta,0,
+                $queue,$events);
+            $events->wait();
+            $hostY = $this->newHostBuffer(count($hostX),$dtype);
+            $hostDX = $this->newHostBuffer(count($hostX),$dtype);
+            $hostRunningMean = $this->newHostBuffer($n,$dtype);
+            $hostRunningVar = $this->newHostBuffer($n,$dtype);
+            $hostDGamma = $this->newHostBuffer($n,$dtype);
+            $hostDBeta = $this->newHostBuffer($n,$dtype);
+            $bufY->read($queue,$hostY);
+            $bufDX->read($queue,$hostDX);
+            $bufRunningMean->read($queue,$hostRunningMean);
+            $bufRunningVar->read($queue,$hostRunningVar);
+            $bufDGamma->read($queue,$hostDGamma);
+            $bufDBeta->read($queue,$hostDBeta);
+            for($j=0;$j<$n;$j++) {
+                $idx = [];
+                for($i=0;$i<$m;$i++) {
+                    for($l=0;$l<$k;$l++) {
+                        $idx[] = ($i*$n+$j)*$k+$l;
+                    }
+                }
+                $mean = 0;
+                foreach($idx as $p) { $mean += $hostX[$p]/$count; }
+                $var = 0;
+                foreach($idx as $p) { $var += ($hostX[$p]-$mean)**2/$count; }
+                $invstd = 1/sqrt($var+$epsilon);
+                $this->assertEqualsWithDelta($momentum+(1-$momentum)*$mean,$hostRunningMean[$j],$delta);
+                $this->assertEqualsWithDelta($momentum+(1-$momentum)*$var,$hostRunningVar[$j],$delta);
+                $dBeta = 0;
+                $dGamma = 0;
+                foreach($idx as $p) {
+                    $xhat = ($hostX[$p]-$mean)*$invstd;
+                    $this->assertEqualsWithDelta($hostGamma[$j]*$xhat+$hostBeta[$j],$hostY[$p],$delta);
+                    $dBeta += $hostDY[$p];
+                    $dGamma += $hostDY[$p]*$xhat;
+                }
+                $this->assertEqualsWithDelta($dBeta,$hostDBeta[$j],$delta);
+                $this->assertEqualsWithDelta($dGamma,$hostDGamma[$j],$delta);
+                foreach($idx as $p) {
+                    $xhat = ($hostX[$p]-$mean)*$invstd;
+                    $true = $hostGamma[$j]*$invstd*($hostDY[$p]-($dBeta+$xhat*$dGamma)/$count);
+                    $this->assertEqualsWithDelta($true,$hostDX[$p],$delta);
+                }
+            }
+
+            // inference with the running statistics
+            $events = $ocl->EventList();
+            $math->batchNormInference($m,$n,$k,$epsilon,
+                $bufX,0,$bufGamma,0,$bufBeta,0,$bufRunningMean,0,$bufRunningVar,0,$bufY,0,
+                $queue,$events);
+            $events->wait();
+            $bufY->read($queue,$hostY);
+            for($p=0;$p<count($hostX);$p++) {
+                $j = intdiv($p,$k)%$n;
+                $true = $hostGamma[$j]*($hostX[$p]-$hostRunningMean[$j])/sqrt($hostRunningVar[$j]+$epsilon)+$hostBeta[$j];
+                $this->assertEqualsWithDelta($true,$hostY[$p],$delta);
+            }
+        }
+
+        // an operand past the end of its buffer
+        [$m,$n,$k] = [2,3,10];
+        $hostX = $this->newHostBuffer($m*$n*$k,NDArray::float32);
+        $hostV = $this->newHostBuffer($n,NDArray::float32);
+        $bufX = $ocl->Buffer($context,count($hostX)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufV = $ocl->Buffer($context,count($hostV)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostV);
+        $calls = [
+            fn() => $math->batchNormInference($m,$n,$k,1e-3,
+                $bufX,1,$bufV,0,$bufV,0,$bufV,0,$bufV,0,$bufX,0,$queue),
+            fn() => $math->batchNormInference($m,$n,$k,1e-3,
+                $bufX,0,$bufV,1,$bufV,0,$bufV,0,$bufV,0,$bufX,0,$queue),
+            fn() => $math->batchNormBackward($m,$n,$k,
+                $bufX,0,$bufV,0,$bufV,0,$bufV,0,$bufX,0,$bufX,0,$bufV,0,$bufV,1,$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testLayerNormRmsNormForwardBackward()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        // [dtype, bytes, delta]; float16 is computed in float and stored as half
+        $dtypes = [[NDArray::float32,4,1e-4],[NDArray::float16,2,1e-2]];
+        foreach($dtypes as [$dtype,$bytes,$delta]) {
+            $m = 3; $n = 300;
+            $epsilon = 1e-5;
+            $hostX = $this->newHostBuffer($m*$n,$dtype);
+            $hostDY = $this->newHostBuffer($m*$n,$dtype);
+            $hostGamma = $this->newHostBuffer($n,$dtype);
+            $hostBeta = $this->newHostBuffer($n,$dtype);
+            for($i=0;$i<$m*$n;$i++) { $hostX[$i] = (($i*7)%13)*0.25+intdiv($i,$n); }
+            for($i=0;$i<$m*$n;$i++) { $hostDY[$i] = (($i*5)%3-1)*0.5; }
+            for($j=0;$j<$n;$j++) { $hostGamma[$j] = 1+($j%4)*0.25; $hostBeta[$j] = ($j%3)-1; }
+            $newBuffer = function($host) use ($ocl,$context,$bytes) {
+                return $ocl->Buffer($context,count($host)*$bytes,
+                    OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$host);
+            };
+            $bufX = $newBuffer($hostX);
+            $bufDY = $newBuffer($hostDY);
+            $bufGamma = $newBuffer($hostGamma);
+            $bufBeta = $newBuffer($hostBeta);
+            $bufY = $newBuffer($this->newHostBuffer($m*$n,$dtype));
+            $bufDX = $newBuffer($this->newHostBuffer($m*$n,$dtype));
+            $bufSavedMean = $newBuffer($this->newHostBuffer($m,$dtype));
+            $bufSavedInvStd = $newBuffer($this->newHostBuffer($m,$dtype));
+            $bufDGamma = $newBuffer($this->newHostBuffer($n,$dtype));
+            $bufDBeta = $newBuffer($this->newHostBuffer($n,$dtype));
+
+            foreach([false,true] as $rms) {
+                $events = $ocl->EventList();
+                if($rms) {
+                    $math->rmsNorm($m,$n,$epsilon,
+                        $bufX,0,$bufGamma,0,$bufY,0,$bufSavedInvStd,0,$queue,$events);
+                    $events->wait();
+                    $events = $ocl->EventList();
+                    $math->rmsNormBackward($m,$n,
+                        $bufX,0,$bufGamma,0,$bufSavedInvStd,0,
+                        $bufDY,0,$bufDX,0,$bufDGamma,0,$queue,$events);
+                } else {
+                    $math->layerNorm($m,$n,$epsilon,
+                        $bufX,0,$bufGamma,0,$bufBeta,0,$bufY,0,
+                        $bufSavedMean,0,$bufSavedInvStd,0,$queue,$events);
+                    $events->wait();
+                    $events = $ocl->EventList();
+                    $math->layerNormBackward($m,$n,
+                        $bufX,0,$bufGamma,0,$bufSavedMean,0,$bufSavedInvStd,0,
+                        $bufDY,0,$bufDX,0,$bufDGamma,0,$bufDBeta,0,$queue,$events);
+                }
+                $events->wait();
+                $hostY = $this->newHostBuffer($m*$n,$dtype);
+                $hostDX = $this->newHostBuffer($m*$n,$dtype);
+                $hostDGamma = $this->newHostBuffer($n,$dtype);
+                $hostDBeta = $this->newHostBuffer($n,$dtype);
+                $bufY->read($queue,$hostY);
+                $bufDX->read($queue,$hostDX);
+                $bufDGamma->read($queue,$hostDGamma);
+                $bufDBeta->read($queue,$hostDBeta);
+                $trueDGamma = array_fill(0,$n,0);
+                $trueDBeta = array_fill(0,$n,0);
+                for($i=0;$i<$m;$i++) {
+                    $mean = 0;
+                    if(!$rms) {
+                        for($j=0;$j<$n;$j++) { $mean += $hostX[$i*$n+$j]/$n; }
+                    }
+                    $var = 0;
+                    for($j=0;$j<$n;$j++) { $var += ($hostX[$i*$n+$j]-$mean)**2/$n; }
+                    $invstd = 1/sqrt($var+$epsilon);
+                    $sg = 0;
+                    $sgx = 0;
+                    for($j=0;$j<$n;$j++) {
+                        $xhat = ($hostX[$i*$n+$j]-$mean)*$invstd;
+                        $true = $hostGamma[$j]*$xhat + ($rms ? 0 : $hostBeta[$j]);
+                        $this->assertEqualsWithDelta($true,$hostY[$i*$n+$j],$delta);
+                        $g = $hostDY[$i*$n+$j]*$hostGamma[$j];
+                        $sg += $g;
+                        $sgx += $g*$xhat;
+                        $trueDGamma[$j] += $hostDY[$i*$n+$j]*$xhat;
+                        $trueDBeta[$j] += $hostDY[$i*$n+$j];
+                    }
+                    if($rms) {
+                        $sg = 0;
+                    }
+                    for($j=0;$j<$n;$j++) {
+                        $xhat = ($hostX[$i*$n+$j]-$mean)*$invstd;
+                        $g = $hostDY[$i*$n+$j]*$hostGamma[$j];
+                        $true = $invstd*($g-($sg+$xhat*$sgx)/$n);
+                        $this->assertEqualsWithDelta($true,$hostDX[$i*$n+$j],$delta);
+                    }
+                }
+                for($j=0;$j<$n;$j++) {
+                    $this->assertEqualsWithDelta($trueDGamma[$j],$hostDGamma[$j],$delta);
+                    if(!$rms) {
+                        $this->assertEqualsWithDelta($trueDBeta[$j],$hostDBeta[$j],$delta);
+                    }
+                }
+            }
+        }
+
+        // an operand past the end of its buffer
+        [$m,$n] = [3,300];
+        $hostX = $this->newHostBuffer($m*$n,NDArray::float32);
+        $hostV = $this->newHostBuffer($n,NDArray::float32);
+        $bufX = $ocl->Buffer($context,count($hostX)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $bufV = $ocl->Buffer($context,count($hostV)*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostV);
+        $calls = [
+            fn() => $math->layerNorm($m,$n,1e-5,
+                $bufX,0,$bufV,1,$bufV,0,$bufX,0,$bufV,0,$bufV,0,$queue),
+            fn() => $math->rmsNorm($m,$n,1e-5,
+                $bufX,0,$bufV,0,$bufX,1,$bufV,0,$queue),
+            fn() => $math->rmsNormBackward($m,$n,
+                $bufX,0,$bufV,0,$bufV,$n-$m+1,$bufX,0,$bufX,0,$bufV,0,$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testScaledDotProductAttention()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch_count = 2; $heads = 3;
+        // [batch][seq][heads][dim]; more queries than a work-group and keys than a block,
+        // and a value_dim shared by several work-items per query
+        foreach([
+            [false,5,7,8,4],
+            [true,5,7,8,4],
+            [true,70,70,8,4],
+            [true,9,20,40,36],
+        ] as [$causal,$seqQ,$seqK,$headDim,$valueDim]) {
+            $scale = 1/sqrt($headDim);
+            $hostQ = $this->newHostBuffer($batch_count*$seqQ*$heads*$headDim,$dtype);
+            $hostK = $this->newHostBuffer($batch_count*$seqK*$heads*$headDim,$dtype);
+            $hostV = $this->newHostBuffer($batch_count*$seqK*$heads*$valueDim,$dtype);
+            for($i=0;$i<count($hostQ);$i++) { $hostQ[$i] = (($i*7)%11)*0.25-1; }
+            for($i=0;$i<count($hostK);$i++) { $hostK[$i] = (($i*5)%13)*0.25-1.5; }
+            for($i=0;$i<count($hostV);$i++) { $hostV[$i] = ($i*3)%7-3; }
+            $bufQ = $ocl->Buffer($context,count($hostQ)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostQ);
+            $bufK = $ocl->Buffer($context,count($hostK)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostK);
+            $bufV = $ocl->Buffer($context,count($hostV)*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostV);
+            $sizeO = $batch_count*$seqQ*$heads*$valueDim;
+            $bufO = $ocl->Buffer($context,$sizeO*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->scaledDotProductAttention($causal,$batch_count,$heads,
+                $seqQ,$seqK,$headDim,$valueDim,$scale,
+                $bufQ,0,$heads*$headDim,$seqQ*$heads*$headDim,$headDim,
+                $bufK,0,$heads*$headDim,$seqK*$heads*$headDim,$headDim,
+                $bufV,0,$heads*$valueDim,$seqK*$heads*$valueDim,$valueDim,
+                $bufO,0,$heads*$valueDim,$seqQ*$heads*$valueDim,$valueDim,
+                $queue,$events);
+            $events->wait();
+            $hostO = $this->newHostBuffer($sizeO,$dtype);
+            $bufO->read($queue,$hostO);
+            for($b=0;$b<$batch_count;$b++) {
+                for($h=0;$h<$heads;$h++) {
+                    for($i=0;$i<$seqQ;$i++) {
+                        $last = $causal ? $i+$seqK-$seqQ : $seqK-1;
+                        $scores = [];
+                        for($j=0;$j<=$last;$j++) {
+                            $s = 0;
+                            for($d=0;$d<$headDim;$d++) {
+                                $s += $hostQ[(($b*$seqQ+$i)*$heads+$h)*$headDim+$d]*
+                                      $hostK[(($b*$seqK+$j)*$heads+$h)*$headDim+$d];
+                            }
+                            $scores[] = $s*$scale;
+                        }
+                        $max = max($scores);
+                        $sum = 0;
+                        foreach($scores as $j => $s) {
+                            $scores[$j] = exp($s-$max);
+                            $sum += $scores[$j];
+                        }
+                        for($e=0;$e<$valueDim;$e++) {
+                            $true = 0;
+                            foreach($scores as $j => $p) {
+                                $true += $p*$hostV[(($b*$seqK+$j)*$heads+$h)*$valueDim+$e]/$sum;
+                            }
+                            $this->assertEqualsWithDelta($true,
+                                $hostO[(($b*$seqQ+$i)*$heads+$h)*$valueDim+$e],1e-4);
+                        }
+                    }
+                }
+            }
+        }
+
+        // [batch][heads][seq][dim] of 2 heads of 4 rows of 8, three of them in a buffer
+        $size = 2*2*4*8;
+        $hostX = $this->newHostBuffer(3*$size,$dtype);
+        $bufX = $ocl->Buffer($context,3*$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+        $attention = fn($offsetQ,$offsetK,$offsetV,$offsetO,$strideHeadO) =>
+            $math->scaledDotProductAttention(false,2,2,4,4,8,8,1.0,
+                $bufX,$offsetQ,8,64,32,
+                $bufX,$offsetK,8,64,32,
+                $bufX,$offsetV,8,64,32,
+                $bufX,$offsetO,8,64,$strideHeadO,
+                $queue);
+        $calls = [
+            // Q, K, V or O past the end of the buffer
+            fn() => $attention(2*$size+1,0,0,$size,32),
+            fn() => $attention(0,2*$size+1,0,$size,32),
+            fn() => $attention(0,0,2*$size+1,$size,32),
+            fn() => $attention(0,0,0,2*$size+1,32),
+            // the heads of O overlap
+            fn() => $attention(0,0,0,$size,16),
+            // O overlaps K or V
+            fn() => $attention(0,0,2*$size,$size-1,32),
+            fn() => $attention(0,2*$size,0,$size-1,32),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testPermute()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        // NCHW to NHWC, head splitting [b,s,h,d] to [b,h,s,d], a 2D transpose and a plain copy
+        foreach([
+            [[2,3,33,5],[0,2,3,1]],
+            [[2,40,3,8],[0,2,1,3]],
+            [[50,70],[1,0]],
+            [[4,5,6],[0,1,2]],
+        ] as [$shape,$perm]) {
+            $size = array_product($shape);
+            $hostX = $this->newHostBuffer($size,$dtype);
+            for($i=0;$i<$size;$i++) {
+                $hostX[$i] = $i;
+            }
+            $bufX = $ocl->Buffer($context,$size*4,
+                OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostX);
+            $bufY = $ocl->Buffer($context,$size*4,OpenCL::CL_MEM_READ_WRITE);
+            $events = $ocl->EventList();
+            $math->permute($shape,$perm,
+                $bufX,$offsetX=0,$stridesX=null,
+                $bufY,$offsetY=0,$stridesY=null,
+                $queue,$events);
+            $events->wait();
+            $hostY = $this->newHostBuffer($size,$dtype);
+            $bufY->read($queue,$hostY);
+            $rank = count($shape);
+            $stridesX = array_fill(0,$rank,1);
+            for($d=$rank-2;$d>=0;$d--) {
+                $stridesX[$d] = $stridesX[$d+1]*$shape[$d+1];
+            }
+            $shapeY = array_map(fn($axis)=>$shape[$axis],$perm);
+            for($i=0;$i<$size;$i++) {
+                // the index of Y to the offset of X
+                $rest = $i;
+                $offset = 0;
+                for($d=$rank-1;$d>=0;$d--) {
+                    $offset += ($rest%$shapeY[$d])*$stridesX[$perm[$d]];
+                    $rest = intdiv($rest,$shapeY[$d]);
+                }
+                $this->assertEquals($hostX[$offset],$hostY[$i]);
+            }
+        }
+
+        $bufX = $ocl->Buffer($context,6*4,OpenCL::CL_MEM_READ_WRITE);
+        $bufY = $ocl->Buffer($context,6*4,OpenCL::CL_MEM_READ_WRITE);
+        $calls = [
+            // Y ends past the buffer
+            fn() => $math->permute([2,3],[1,0],$bufX,0,null,$bufY,1,null,$queue),
+            // X starts before the buffer
+            fn() => $math->permute([2,3],[1,0],$bufX,0,[-3,1],$bufY,0,null,$queue),
+            // the columns of Y overlap
+            fn() => $math->permute([2,3],[1,0],$bufX,0,null,$bufY,0,[1,1],$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+
+    public function testOmatcopyBatchedAndTransposeInPlace()
+    {
+        $ocl = $this->getOpenCL();
+        $context = $this->newContextFromType($ocl);
+        $queue = $ocl->CommandQueue($context);
+        $math = $this->getMath();
+        $dtype = NDArray::float32;
+        $batch_count = 3;
+        $m = 37;
+        $n = 45;
+        $size = $m*$n;
+        $hostA = $this->newHostBuffer($batch_count*$size,$dtype);
+        for($i=0;$i<$batch_count*$size;$i++) {
+            $hostA[$i] = $i;
+        }
+        $bufA = $ocl->Buffer($context,$batch_count*$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostA);
+        $bufB = $ocl->Buffer($context,$batch_count*$size*4,OpenCL::CL_MEM_READ_WRITE);
+
+        // strided batched
+        foreach([BLAS::NoTrans,BLAS::Trans] as $trans) {
+            $ldB = ($trans==BLAS::Trans) ? $m : $n;
+            $events = $ocl->EventList();
+            $math->omatcopyStridedBatched(BLAS::RowMajor,$trans,$m,$n,$alpha=2.0,
+                $bufA,$offsetA=0,$ldA=$n,$strideA=$size,
+                $bufB,$offsetB=0,$ldB,$strideB=$size,
+                $batch_count,$queue,$events);
+            $events->wait();
+            $hostB = $this->newHostBuffer($batch_count*$size,$dtype);
+            $bufB->read($queue,$hostB);
+            for($b=0;$b<$batch_count;$b++) {
+                for($i=0;$i<$m;$i++) {
+                    for($j=0;$j<$n;$j++) {
+                        $idx = ($trans==BLAS::Trans) ? $j*$m+$i : $i*$n+$j;
+                        $this->assertEquals(2.0*$hostA[$b*$size+$i*$n+$j],$hostB[$b*$size+$idx]);
+                    }
+                }
+            }
+        }
+
+        // offsets array with an alpha per matrix, in reverse order
+        $alphas = $this->newHostBuffer($batch_count,$dtype);
+        $offsetsA = $this->newHostBuffer($batch_count,NDArray::int64);
+        $offsetsB = $this->newHostBuffer($batch_count,NDArray::int64);
+        for($b=0;$b<$batch_count;$b++) {
+            $alphas[$b] = $b+1;
+            $offsetsA[$b] = ($batch_count-1-$b)*$size;
+            $offsetsB[$b] = $b*$size;
+        }
+        $events = $ocl->EventList();
+        $math->omatcopyBatched(BLAS::RowMajor,BLAS::Trans,$m,$n,
+            $alphas,$offsetAlpha=0,
+            $bufA,$offsetsA,$offsetA=0,$ldA=$n,
+            $bufB,$offsetsB,$offsetB=0,$ldB=$m,
+            $batch_count,$queue,$events);
+        $events->wait();
+        $hostB = $this->newHostBuffer($batch_count*$size,$dtype);
+        $bufB->read($queue,$hostB);
+        for($b=0;$b<$batch_count;$b++) {
+            for($i=0;$i<$m;$i++) {
+                for($j=0;$j<$n;$j++) {
+                    $this->assertEquals(($b+1)*$hostA[($batch_count-1-$b)*$size+$i*$n+$j],
+                        $hostB[$b*$size+$j*$m+$i]);
+                }
+            }
+        }
+
+        // in-place transpose of square matrices
+        $n = 37;
+        $size = $n*$n;
+        $hostC = $this->newHostBuffer($batch_count*$size,$dtype);
+        for($i=0;$i<$batch_count*$size;$i++) {
+            $hostC[$i] = $i;
+        }
+        $bufC = $ocl->Buffer($context,$batch_count*$size*4,
+            OpenCL::CL_MEM_READ_WRITE|OpenCL::CL_MEM_COPY_HOST_PTR,$hostC);
+        $events = $ocl->EventList();
+        $math->transposeInPlace($n,$alpha=-1.0,
+            $bufC,$offsetC=0,$ldC=$n,$strideC=$size,
+            $batch_count,$queue,$events);
+        $events->wait();
+        $hostD = $this->newHostBuffer($batch_count*$size,$dtype);
+        $bufC->read($queue,$hostD);
+        for($b=0;$b<$batch_count;$b++) {
+            for($i=0;$i<$n;$i++) {
+                for($j=0;$j<$n;$j++) {
+                    $this->assertEquals(-$hostC[$b*$size+$i*$n+$j],$hostD[$b*$size+$j*$n+$i]);
+                }
+            }
+        }
+
+        // a matrix past the end of its buffer, matrices of B that overlap
+        // each other or A, and in-place matrices that overlap
+        [$m,$n,$size] = [37,45,37*45];
+        $newOffsets = function(array $offsets) {
+            $host = $this->newHostBuffer(count($offsets),NDArray::int64);
+            foreach($offsets as $i => $offset) {
+                $host[$i] = $offset;
+            }
+            return $host;
+        };
+        $strided = fn($bufB,$offsetA,$offsetB,$strideB) =>
+            $math->omatcopyStridedBatched(BLAS::RowMajor,BLAS::NoTrans,$m,$n,1.0,
+                $bufA,$offsetA,$n,$size,$bufB,$offsetB,$n,$strideB,$batch_count,$queue);
+        $batched = fn($offsetsB) =>
+            $math->omatcopyBatched(BLAS::RowMajor,BLAS::NoTrans,$m,$n,$alphas,0,
+                $bufA,$newOffsets([0,$size,2*$size]),0,$n,
+                $bufB,$newOffsets($offsetsB),0,$n,$batch_count,$queue);
+        $calls = [
+            fn() => $strided($bufB,1,0,$size),
+            fn() => $strided($bufB,0,1,$size),
+            fn() => $strided($bufB,0,0,$size-1),
+            fn() => $strided($bufA,0,0,$size),
+            fn() => $batched([0,$size,2*$size+1]),
+            fn() => $batched([$size,0,$size]),
+            fn() => $math->transposeInPlace(37,1.0,$bufC,1,37,37*37,$batch_count,$queue),
+            fn() => $math->transposeInPlace(37,1.0,$bufC,0,37,37*37-1,$batch_count,$queue),
+            fn() => $math->transposeInPlace(37,1.0,$bufC,0,37,0,$batch_count,$queue),
+        ];
+        foreach($calls as $call) {
+            $thrown = false;
+            try {
+                $call();
+            } catch(RuntimeException|InvalidArgumentException $e) {
+                $thrown = true;
+            }
+            $this->assertTrue($thrown);
+        }
+    }
+}